@@ -32,9 +32,13 @@ namespace psr {
 template <typename T> using ICFGSet = boost::container::flat_set<T>;
 // ----------------------------------------------------------------------------
 
-// define the set implementation to use for the flow functions
+// define the set implementation to use for the flow functions; the targets
+// of a flow function application are stored in place up to the given number
+// of facts, the preallocation size may be overridden at compile time
 // -------------
+#ifndef FFSetPreAllocSize
 #define FFSetPreAllocSize 10
+#endif
 
 template <typename T>
 using FFSet = boost::container::small_vector<T, FFSetPreAllocSize>;
@@ -12,6 +12,7 @@
 
 #include <iosfwd>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -21,6 +22,7 @@
 
 namespace psr {
 
+class JsonStreamWriter;
 class ProjectIRDB;
 
 WISE_ENUM_CLASS(ExportType, (JSON, 0))
@@ -33,13 +35,26 @@ public:
 
 private:
   json FinalResultsJson;
+  // the file the results are streamed to, empty if they are collected
+  std::string StreamFile;
+  // opened once the first results are streamed
+  std::unique_ptr<JsonStreamWriter> ResultsWriter;
+
+  JsonStreamWriter &getResultsWriter();
+
+  void addResults(json Results);
 
 public:
+  /**
+   * Performs the given analyses. If an OutputFile is given, the results are
+   * streamed to it while the analyses run instead of being collected in
+   * memory. The file is only opened once there are results to write.
+   */
   AnalysisController(ProjectIRDB &&IRDB,
                      std::vector<DataFlowAnalysisType> Analyses,
                      bool WPA_MODE = true, bool PrintEdgeRecorder = true,
-                     std::string graph_id = "");
-  ~AnalysisController() = default;
+                     std::string graph_id = "", std::string OutputFile = "");
+  ~AnalysisController();
   void writeResults(std::string filename);
 };
 
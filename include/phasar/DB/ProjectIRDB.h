@@ -21,6 +21,7 @@
 #include <llvm/IR/Module.h>
 
 #include <phasar/PhasarLLVM/Pointer/PointsToGraph.h>
+#include <phasar/Utils/FunctionSignatureIndex.h>
 
 namespace llvm {
 class Value;
@@ -74,6 +75,11 @@ private:
   // Maps a function to its points-to graph
   std::map<std::string, std::unique_ptr<PointsToGraph>> ptgs;
   std::set<const llvm::Type *> allocated_types;
+  // Indexes all functions resp. the address-taken ones by their signatures,
+  // built on demand
+  std::unique_ptr<FunctionSignatureIndex> SignatureIndex;
+  std::unique_ptr<FunctionSignatureIndex> AddressTakenSignatureIndex;
+  bool AddressTakenTargetsOnly = false;
 
   void buildFunctionModuleMapping(llvm::Module *M);
   void buildGlobalModuleMapping(llvm::Module *M);
@@ -121,6 +127,23 @@ public:
     return ModuleSet;
   }
   std::set<const llvm::Function *> getAllFunctions();
+  /**
+   * Returns the functions of getAllFunctions() indexed by their signatures.
+   * The index is built on the first call and rebuilt once modules have been
+   * inserted or linked. If AddressTakenOnly is set, the index only contains
+   * functions whose address is taken, see FunctionSignatureIndex.
+   */
+  const FunctionSignatureIndex &
+  getFunctionSignatureIndex(bool AddressTakenOnly = false);
+  /**
+   * Sets whether resolvers narrow the targets of function pointers to the
+   * functions whose address is taken. This is only sound once all uses of a
+   * function are visible, e.g. after linkForWPA(). It is off by default.
+   */
+  void setAddressTakenTargetsOnly(bool Enabled) {
+    AddressTakenTargetsOnly = Enabled;
+  }
+  bool addressTakenTargetsOnly() const { return AddressTakenTargetsOnly; }
   std::set<const llvm::Instruction *> getRetResInstructions();
   std::set<const llvm::Value *> getAllocaInstructions();
 
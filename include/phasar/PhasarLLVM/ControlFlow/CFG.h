@@ -54,6 +54,46 @@ public:
   virtual std::string getMethodName(M fun) = 0;
 };
 
+namespace detail {
+
+template <typename CFGT, typename N>
+auto getSuccsOfRef(CFGT &CF, N Stmt, int) -> decltype(CF.getSuccsOfRef(Stmt)) {
+  return CF.getSuccsOfRef(Stmt);
+}
+
+template <typename CFGT, typename N>
+std::vector<N> getSuccsOfRef(CFGT &CF, N Stmt, long) {
+  return CF.getSuccsOf(Stmt);
+}
+
+template <typename CFGT, typename N>
+auto getPredsOfRef(CFGT &CF, N Stmt, int) -> decltype(CF.getPredsOfRef(Stmt)) {
+  return CF.getPredsOfRef(Stmt);
+}
+
+template <typename CFGT, typename N>
+std::vector<N> getPredsOfRef(CFGT &CF, N Stmt, long) {
+  return CF.getPredsOf(Stmt);
+}
+
+} // namespace detail
+
+/**
+ * Returns the successors of Stmt in CF. If CF provides a non-allocating
+ * getSuccsOfRef(), its view is returned, a vector from getSuccsOf()
+ * otherwise. Solvers use this for their hot loops.
+ */
+template <typename CFGT, typename N> auto getSuccsOfRef(CFGT &CF, N Stmt) {
+  return detail::getSuccsOfRef(CF, Stmt, 0);
+}
+
+/**
+ * Returns the predecessors of Stmt in CF, see getSuccsOfRef().
+ */
+template <typename CFGT, typename N> auto getPredsOfRef(CFGT &CF, N Stmt) {
+  return detail::getPredsOfRef(CF, Stmt, 0);
+}
+
 } // namespace psr
 
 #endif
@@ -17,11 +17,13 @@
 #ifndef PHASAR_PHASARLLVM_CONTROLFLOW_LLVMBASEDCFG_H_
 #define PHASAR_PHASARLLVM_CONTROLFLOW_LLVMBASEDCFG_H_
 
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
 #include <phasar/PhasarLLVM/ControlFlow/CFG.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMCFGIndex.h>
 
 namespace llvm {
 class Function;
@@ -32,11 +34,33 @@ namespace psr {
 
 class LLVMBasedCFG
     : public virtual CFG<const llvm::Instruction *, const llvm::Function *> {
+private:
+  // shared by copies, the indices only depend on the IR
+  std::shared_ptr<LLVMCFGIndexCache> IndexCache =
+      std::make_shared<LLVMCFGIndexCache>();
+
 public:
   LLVMBasedCFG() = default;
 
   ~LLVMBasedCFG() override = default;
 
+  /**
+   * Returns the control-flow index of fun, which is built on the first
+   * request. The IR of fun must not be modified afterwards.
+   */
+  const LLVMCFGIndex &getCFGIndex(const llvm::Function *fun) const;
+
+  /**
+   * Non-allocating variants of getPredsOf(), getSuccsOf() and
+   * getAllInstructionsOf(). The views stay valid as long as this CFG.
+   */
+  LLVMCFGIndex::InstRef getPredsOfRef(const llvm::Instruction *stmt) const;
+
+  LLVMCFGIndex::InstRef getSuccsOfRef(const llvm::Instruction *stmt) const;
+
+  LLVMCFGIndex::InstRef
+  getAllInstructionsOfRef(const llvm::Function *fun) const;
+
   const llvm::Function *getMethodOf(const llvm::Instruction *stmt) override;
 
   std::vector<const llvm::Instruction *>
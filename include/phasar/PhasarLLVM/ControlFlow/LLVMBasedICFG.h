@@ -17,6 +17,7 @@
 #ifndef PHASAR_PHASARLLVM_CONTROLFLOW_LLVMBASEDICFG_H_
 #define PHASAR_PHASARLLVM_CONTROLFLOW_LLVMBASEDICFG_H_
 
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <map>
@@ -27,6 +28,8 @@
 
 #include <boost/graph/adjacency_list.hpp>
 
+#include <llvm/ADT/ArrayRef.h>
+
 #include <phasar/PhasarLLVM/ControlFlow/ICFG.h>
 #include <phasar/PhasarLLVM/ControlFlow/LLVMBasedCFG.h>
 #include <phasar/PhasarLLVM/Pointer/PointsToGraph.h>
@@ -102,20 +105,91 @@ private:
   /// Maps function names to the corresponding vertex id.
   std::unordered_map<std::string, vertex_t> function_vertex_map;
 
+  /// Frozen view of the call graph that answers the callee and caller
+  /// queries without walking cg. Functions are identified by their dense
+  /// vertex ids. The index has to be rebuilt whenever cg is changed.
+  struct CallGraphIndex {
+    /// Maps a call site to the offset and the number of its callees.
+    std::unordered_map<const llvm::Instruction *,
+                       std::pair<std::uint32_t, std::uint32_t>>
+        CallSites;
+    std::vector<const llvm::Function *> Callees;
+    /// Maps the functions of the vertices to their vertex ids.
+    std::unordered_map<const llvm::Function *, std::uint32_t> FunctionIds;
+    /// The call sites of the function with vertex id i are the entries
+    /// CallerOffsets[i] to CallerOffsets[i + 1] - 1 of Callers.
+    std::vector<std::uint32_t> CallerOffsets;
+    std::vector<const llvm::Instruction *> Callers;
+  };
+
+  CallGraphIndex CGIndex;
+
   void constructionWalker(const llvm::Function *F, Resolver *resolver);
 
+  /**
+   * Builds the call graph reachable from EntryFunctions like
+   * constructionWalker() does, but resolves the call sites of independent
+   * functions on NumThreads threads. Requires a parallelizable resolver.
+   */
+  void parallelConstructionWalker(
+      const std::vector<const llvm::Function *> &EntryFunctions,
+      Resolver *resolver, unsigned NumThreads);
+
+  std::set<const llvm::Function *>
+  resolveCallSite(llvm::ImmutableCallSite cs, Resolver *resolver);
+
+  void addFunctionVertex(const llvm::Function *F);
+
+  void addCallEdges(const llvm::Function *F, const llvm::Instruction *CallSite,
+                    const std::set<const llvm::Function *> &possible_targets);
+
+  void buildCallGraphIndex();
+
+  /**
+   * Writes the call graph to a binary cache file that records the hash of
+   * the modules, the analysis type and the entry points it was constructed
+   * for, the function names of the vertices and the ids of the call sites
+   * of the edges. Throws std::ios_base::failure if the file cannot be
+   * written.
+   */
+  void storeCallGraph(const std::string &Path,
+                      const std::vector<std::string> &EntryPoints);
+
+  /**
+   * Fills the empty call graph from a cache file written by storeCallGraph().
+   * Returns false and leaves the graph untouched if the file does not exist,
+   * is malformed or does not match the modules, the analysis type or the
+   * entry points.
+   */
+  bool loadCallGraph(const std::string &Path,
+                     const std::vector<std::string> &EntryPoints);
+
   struct dependency_visitor;
 
 public:
   LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB);
 
+  /**
+   * Constructs the call graph reachable from EntryPoints. If NumThreads is
+   * greater than one and the chosen analysis allows it (CHA, RTA), the call
+   * sites are resolved on that many threads; DTA and OTF always construct
+   * sequentially.
+   *
+   * If CacheFile is given, the call graph is loaded from it as long as it
+   * has been written for the same modules, analysis type, entry points and
+   * narrowing of function-pointer targets (see ProjectIRDB), which skips the
+   * resolution of call sites entirely. Otherwise the call graph is
+   * constructed and written to CacheFile.
+   */
   LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB,
                 CallGraphAnalysisType CGType,
-                const std::vector<std::string> &EntryPoints = {"main"});
+                const std::vector<std::string> &EntryPoints = {"main"},
+                unsigned NumThreads = 1, const std::string &CacheFile = "");
 
   LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB,
                 const llvm::Module &M, CallGraphAnalysisType CGType,
-                std::vector<std::string> EntryPoints = {});
+                std::vector<std::string> EntryPoints = {},
+                unsigned NumThreads = 1);
 
   ~LLVMBasedICFG() override = default;
 
@@ -131,6 +205,17 @@ public:
   std::set<const llvm::Instruction *>
   getCallersOf(const llvm::Function *m) override;
 
+  /**
+   * Non-allocating variants of getCalleesOfCallAt() and getCallersOf(). The
+   * elements are sorted and unique, the views stay valid until the call
+   * graph is changed.
+   */
+  llvm::ArrayRef<const llvm::Function *>
+  getCalleesOfCallAtRef(const llvm::Instruction *n) const;
+
+  llvm::ArrayRef<const llvm::Instruction *>
+  getCallersOfRef(const llvm::Function *m) const;
+
   std::set<const llvm::Instruction *>
   getCallsFromWithin(const llvm::Function *m) override;
 
@@ -173,6 +258,14 @@ public:
   PointsToGraph &getWholeModulePTG();
 
   std::vector<std::string> getDependencyOrderedFunctions();
+
+  /**
+   * Returns the strongly connected components of the call graph, i.e. the
+   * groups of functions that call each other, in bottom-up order: the
+   * functions of a component only call functions of the same or of preceding
+   * components. Declarations are omitted.
+   */
+  std::vector<std::vector<const llvm::Function *>> getCallGraphSCCs();
 };
 
 } // namespace psr
@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_CONTROLFLOW_LLVMCFGINDEX_H_
+#define PHASAR_PHASARLLVM_CONTROLFLOW_LLVMCFGINDEX_H_
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <llvm/ADT/ArrayRef.h>
+
+namespace llvm {
+class Function;
+class Instruction;
+} // namespace llvm
+
+namespace psr {
+
+/**
+ * A frozen control-flow index of a single function. The instructions are
+ * numbered in program order, and their successors and predecessors are
+ * stored in compressed sparse row form: the neighbours of the instruction
+ * with id i are the entries Offsets[i] to Offsets[i + 1] - 1 of a single
+ * array. Queries are therefore answered in constant time by views into
+ * these arrays, without any allocation.
+ *
+ * The neighbours are listed in the order in which LLVMBasedCFG reports
+ * them. The index reflects the function at the time of construction and
+ * has to be rebuilt if the function is modified.
+ */
+class LLVMCFGIndex {
+public:
+  using InstRef = llvm::ArrayRef<const llvm::Instruction *>;
+
+private:
+  std::vector<const llvm::Instruction *> Instructions;
+  std::unordered_map<const llvm::Instruction *, std::uint32_t> Ids;
+  std::vector<std::uint32_t> SuccOffsets;
+  std::vector<const llvm::Instruction *> Succs;
+  std::vector<std::uint32_t> PredOffsets;
+  std::vector<const llvm::Instruction *> Preds;
+
+public:
+  explicit LLVMCFGIndex(const llvm::Function &F);
+
+  LLVMCFGIndex(const LLVMCFGIndex &) = delete;
+
+  LLVMCFGIndex &operator=(const LLVMCFGIndex &) = delete;
+
+  /**
+   * Returns the id of I, which must be an instruction of the indexed
+   * function.
+   */
+  std::uint32_t getId(const llvm::Instruction *I) const;
+
+  const llvm::Instruction *getInstruction(std::uint32_t Id) const {
+    return Instructions[Id];
+  }
+
+  InstRef getSuccsOf(std::uint32_t Id) const {
+    return InstRef(Succs.data() + SuccOffsets[Id],
+                   SuccOffsets[Id + 1] - SuccOffsets[Id]);
+  }
+
+  InstRef getSuccsOf(const llvm::Instruction *I) const {
+    return getSuccsOf(getId(I));
+  }
+
+  InstRef getPredsOf(std::uint32_t Id) const {
+    return InstRef(Preds.data() + PredOffsets[Id],
+                   PredOffsets[Id + 1] - PredOffsets[Id]);
+  }
+
+  InstRef getPredsOf(const llvm::Instruction *I) const {
+    return getPredsOf(getId(I));
+  }
+
+  InstRef getInstructions() const { return Instructions; }
+
+  std::size_t size() const { return Instructions.size(); }
+
+  std::size_t getNumEdges() const { return Succs.size(); }
+};
+
+/**
+ * Builds the LLVMCFGIndex of a function on its first request and keeps it
+ * for all later ones. The cache may be shared by several threads.
+ *
+ * Every thread remembers the index it has requested last. Successive queries
+ * mostly stay within one function, hence they neither take the lock nor look
+ * the function up.
+ */
+class LLVMCFGIndexCache {
+private:
+  std::unordered_map<const llvm::Function *, std::unique_ptr<LLVMCFGIndex>>
+      Indices;
+  std::shared_mutex IndicesMutex;
+  // tells the caches apart in the per-thread memo, unlike their addresses it
+  // is never reused
+  const std::uint64_t Generation;
+
+  const LLVMCFGIndex &lookupOrBuild(const llvm::Function *F);
+
+public:
+  LLVMCFGIndexCache();
+
+  const LLVMCFGIndex &getIndex(const llvm::Function *F);
+};
+
+} // namespace psr
+
+#endif
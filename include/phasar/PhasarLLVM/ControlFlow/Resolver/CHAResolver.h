@@ -34,6 +34,8 @@ public:
 
   virtual std::set<std::string>
   resolveVirtualCall(const llvm::ImmutableCallSite &CS) override;
+
+  virtual bool isParallelizable() const override;
 };
 } // namespace psr
 
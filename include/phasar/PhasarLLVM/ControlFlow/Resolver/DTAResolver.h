@@ -62,6 +62,9 @@ public:
   virtual void OtherInst(const llvm::Instruction *Inst) override;
   virtual std::set<std::string>
   resolveVirtualCall(const llvm::ImmutableCallSite &CS) override;
+
+  // the type graph grows with every visited bitcast
+  virtual bool isParallelizable() const override;
 };
 } // namespace psr
 
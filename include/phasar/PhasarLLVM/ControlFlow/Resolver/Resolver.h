@@ -30,11 +30,15 @@ class StructType;
 namespace psr {
 class ProjectIRDB;
 class LLVMTypeHierarchy;
+class FunctionSignatureIndex;
 
 class Resolver {
 protected:
   ProjectIRDB &IRDB;
   LLVMTypeHierarchy &CH;
+  /// Candidate targets of indirect calls, built once per IRDB and narrowed
+  /// to address-taken functions if the IRDB says so
+  const FunctionSignatureIndex &FunctionSignatures;
 
 protected:
   int getVtableIndex(const llvm::ImmutableCallSite &CS) const;
@@ -64,6 +68,13 @@ public:
   resolveVirtualCall(const llvm::ImmutableCallSite &CS) = 0;
   virtual std::set<std::string>
   resolveFunctionPointer(const llvm::ImmutableCallSite &CS);
+  /**
+   * Returns true if the call sites of different functions can be resolved
+   * concurrently once firstFunction() has been called, i.e. if all other
+   * member functions are safe to call from several threads. Resolvers that
+   * learn from the instructions they visit must resolve sequentially.
+   */
+  virtual bool isParallelizable() const;
 };
 } // namespace psr
 
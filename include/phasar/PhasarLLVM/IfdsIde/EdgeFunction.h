@@ -17,6 +17,8 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTION_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTION_H_
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <ostream>
 #include <sstream>
@@ -38,6 +40,16 @@ public:
 
   virtual bool equal_to(std::shared_ptr<EdgeFunction<V>> other) const = 0;
 
+  /**
+   * Functions that are equal_to() each other must have the same hash value.
+   * The default hashes the function's address, which fits functions that are
+   * only equal to themselves. Functions with a structural equal_to() should
+   * override it; otherwise, the EdgeFunctionInterner cannot share them.
+   */
+  virtual std::size_t hash() const {
+    return std::hash<const EdgeFunction<V> *>()(this);
+  }
+
   virtual void print(std::ostream &OS, bool isForDebug = false) const {
     OS << "EdgeFunction";
   }
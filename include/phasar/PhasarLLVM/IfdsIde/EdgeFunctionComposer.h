@@ -10,11 +10,14 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTIONCOMPOSER_H
 #define PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTIONCOMPOSER_H
 
+#include <atomic>
 #include <gtest/gtest_prod.h>
 #include <memory>
+#include <typeinfo>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/AllBottom.h>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/EdgeIdentity.h>
+#include <phasar/Utils/HashedTuple.h>
 
 namespace psr {
 
@@ -39,7 +42,7 @@ class EdgeFunctionComposer
 private:
   // For debug purpose only
   const unsigned EFComposer_Id;
-  static unsigned CurrEFComposer_Id;
+  static std::atomic<unsigned> CurrEFComposer_Id;
 
 protected:
   /// First edge function
@@ -78,11 +81,27 @@ public:
   // virtual std::shared_ptr<EdgeFunction<V>>
   // joinWith(std::shared_ptr<EdgeFunction<V>> otherFunction) = 0;
 
+  /**
+   * Composers are equal if they are of the same type, since subclasses
+   * differ in their joins, and if their parts are equal. Parts only count as
+   * equal if their hash values agree as well, such that equal composers
+   * always have the same hash value, even if a part's equal_to() is more
+   * lenient than its hash().
+   */
   bool equal_to(std::shared_ptr<EdgeFunction<V>> other) const override {
-    if (auto EFC = dynamic_cast<EdgeFunctionComposer<V> *>(other.get())) {
-      return F->equal_to(EFC->F) && G->equal_to(EFC->G);
+    if (typeid(*other) != typeid(*this)) {
+      return false;
     }
-    return false;
+    auto EFC = static_cast<EdgeFunctionComposer<V> *>(other.get());
+    return F->hash() == EFC->F->hash() && G->hash() == EFC->G->hash() &&
+           F->equal_to(EFC->F) && G->equal_to(EFC->G);
+  }
+
+  std::size_t hash() const override {
+    std::size_t Hash = typeid(*this).hash_code();
+    hashCombine(Hash, F->hash());
+    hashCombine(Hash, G->hash());
+    return Hash;
   }
 
   void print(std::ostream &OS, bool isForDebug = false) const override {
@@ -91,7 +110,8 @@ public:
   }
 };
 
-template <typename V> unsigned EdgeFunctionComposer<V>::CurrEFComposer_Id = 0;
+template <typename V>
+std::atomic<unsigned> EdgeFunctionComposer<V>::CurrEFComposer_Id(0);
 
 } // namespace psr
 
@@ -0,0 +1,158 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTIONINTERNER_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_EDGEFUNCTIONINTERNER_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+
+namespace psr {
+
+/**
+ * Hash-conses edge functions: every function that passes the interner is
+ * replaced by a canonical representative, such that functions that are equal
+ * with respect to EdgeFunction::hash() and EdgeFunction::equal_to() are
+ * stored only once. As a consequence, canonical functions that are equal are
+ * identical, and comparing pointers suffices in most cases.
+ *
+ * The results of composeWith() and joinWith() on canonical functions are
+ * memoized, keyed by the addresses of the operands. This requires the edge
+ * functions to be pure, i.e. composing or joining the same functions twice
+ * must yield equal results. The interner keeps all canonical functions alive
+ * for its entire lifetime, hence their addresses are never reused.
+ *
+ * All operations are safe to use from multiple threads. The edge functions'
+ * composeWith() and joinWith() are called without holding a lock.
+ *
+ * @param <V> The type of values the edge functions operate on.
+ */
+template <typename V> class EdgeFunctionInterner {
+public:
+  using EdgeFunctionPtr = std::shared_ptr<EdgeFunction<V>>;
+
+private:
+  using OperandPair =
+      std::pair<const EdgeFunction<V> *, const EdgeFunction<V> *>;
+
+  struct OperandPairHash {
+    std::size_t operator()(const OperandPair &Operands) const {
+      std::hash<const EdgeFunction<V> *> Hasher;
+      return Hasher(Operands.first) * 31 + Hasher(Operands.second);
+    }
+  };
+
+  std::mutex Mutex;
+  // canonical functions bucketed by their hash values
+  std::unordered_map<std::size_t, std::vector<EdgeFunctionPtr>> Canonicals;
+  std::unordered_map<OperandPair, EdgeFunctionPtr, OperandPairHash>
+      Compositions;
+  std::unordered_map<OperandPair, EdgeFunctionPtr, OperandPairHash> Joins;
+  std::size_t NumCanonicals = 0;
+
+  // expects Mutex to be held by the caller
+  EdgeFunctionPtr internLocked(const EdgeFunctionPtr &F) {
+    std::vector<EdgeFunctionPtr> &Bucket = Canonicals[F->hash()];
+    for (const EdgeFunctionPtr &Canonical : Bucket) {
+      if (Canonical == F || Canonical->equal_to(F)) {
+        return Canonical;
+      }
+    }
+    Bucket.push_back(F);
+    ++NumCanonicals;
+    return F;
+  }
+
+  template <typename OperationT>
+  EdgeFunctionPtr memoize(
+      std::unordered_map<OperandPair, EdgeFunctionPtr, OperandPairHash> &Memo,
+      EdgeFunctionPtr F, EdgeFunctionPtr G, OperationT Operation) {
+    OperandPair Key;
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      F = internLocked(F);
+      G = internLocked(G);
+      Key = OperandPair(F.get(), G.get());
+      auto Search = Memo.find(Key);
+      if (Search != Memo.end()) {
+        return Search->second;
+      }
+    }
+    EdgeFunctionPtr Result = Operation(F, G);
+    std::lock_guard<std::mutex> Lock(Mutex);
+    // another thread may have computed the same result in the meantime
+    auto Inserted = Memo.try_emplace(Key, nullptr);
+    if (Inserted.second) {
+      Inserted.first->second = internLocked(Result);
+    }
+    return Inserted.first->second;
+  }
+
+public:
+  EdgeFunctionInterner() = default;
+
+  ~EdgeFunctionInterner() = default;
+
+  EdgeFunctionInterner(const EdgeFunctionInterner &) = delete;
+
+  EdgeFunctionInterner &operator=(const EdgeFunctionInterner &) = delete;
+
+  /**
+   * Returns the canonical representative of F, which is F itself if no equal
+   * function has been interned before.
+   */
+  EdgeFunctionPtr intern(const EdgeFunctionPtr &F) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    return internLocked(F);
+  }
+
+  /**
+   * Returns the canonical representative of F->composeWith(G).
+   */
+  EdgeFunctionPtr compose(EdgeFunctionPtr F, EdgeFunctionPtr G) {
+    return memoize(Compositions, std::move(F), std::move(G),
+                   [](const EdgeFunctionPtr &F, const EdgeFunctionPtr &G) {
+                     return F->composeWith(G);
+                   });
+  }
+
+  /**
+   * Returns the canonical representative of F->joinWith(G).
+   */
+  EdgeFunctionPtr join(EdgeFunctionPtr F, EdgeFunctionPtr G) {
+    return memoize(Joins, std::move(F), std::move(G),
+                   [](const EdgeFunctionPtr &F, const EdgeFunctionPtr &G) {
+                     return F->joinWith(G);
+                   });
+  }
+
+  std::size_t size() {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    return NumCanonicals;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Canonicals.clear();
+    Compositions.clear();
+    Joins.clear();
+    NumCanonicals = 0;
+  }
+};
+
+} // namespace psr
+
+#endif
@@ -21,6 +21,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <typeinfo>
 
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
 #include <phasar/Utils/Macros.h>
@@ -65,12 +66,17 @@ public:
   }
 
   bool equal_to(std::shared_ptr<EdgeFunction<V>> other) const override {
-    if (AllBottom<V> *allbottom = dynamic_cast<AllBottom<V> *>(other.get())) {
-      return (allbottom->bottomElement == bottomElement);
+    if (typeid(*other) != typeid(*this)) {
+      return false;
     }
-    return false;
+    return static_cast<AllBottom<V> *>(other.get())->bottomElement ==
+           bottomElement;
   }
 
+  // all instances of a given type compare by their bottomElement, which need not
+  // be hashable
+  std::size_t hash() const override { return typeid(*this).hash_code(); }
+
   void print(std::ostream &OS, bool isForDebug = false) const override {
     OS << "AllBottom";
   }
@@ -19,6 +19,7 @@
 
 #include <iosfwd>
 #include <memory>
+#include <typeinfo>
 
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
 
@@ -48,11 +49,16 @@ public:
   }
 
   bool equal_to(std::shared_ptr<EdgeFunction<V>> other) const override {
-    if (AllTop<V> *alltop = dynamic_cast<AllTop<V> *>(other.get()))
-      return (alltop->topElement == topElement);
-    return false;
+    if (typeid(*other) != typeid(*this)) {
+      return false;
+    }
+    return static_cast<AllTop<V> *>(other.get())->topElement == topElement;
   }
 
+  // all instances of a given type compare by their topElement, which need not
+  // be hashable
+  std::size_t hash() const override { return typeid(*this).hash_code(); }
+
   void print(std::ostream &OS, bool isForDebug = false) const override {
     OS << "AllTop";
   }
@@ -10,60 +10,157 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_FLOWEDGEFUNCTIONCACHE_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_FLOWEDGEFUNCTIONCACHE_H_
 
-#include <map>
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <set>
-#include <tuple>
+#include <shared_mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/IDETabulationProblem.h>
 #include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
+#include <phasar/Utils/HashedTuple.h>
+#include <phasar/Utils/LRUCache.h>
 #include <phasar/Utils/Logger.h>
 #include <phasar/Utils/PAMMMacros.h>
 
 namespace psr {
 
+/**
+ * Counts the lookups of one kind of cached function, and how many of them
+ * have been served from the cache. Independent of PAMM, such that the hit
+ * rates can be reported while the solver is running.
+ */
+struct FunctionCacheStatistics {
+  std::atomic<std::size_t> Lookups{0};
+  std::atomic<std::size_t> Hits{0};
+
+  void count(bool Hit) {
+    Lookups.fetch_add(1, std::memory_order_relaxed);
+    if (Hit) {
+      Hits.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  double getHitRate() const {
+    std::size_t NumLookups = Lookups;
+    return NumLookups ? static_cast<double>(Hits) / NumLookups : 0.0;
+  }
+};
+
 /**
  * This class caches flow and edge functions to avoid their reconstruction.
  * When a flow or edge function must be applied to multiple times, a cached
  * version is used if existend, otherwise a new one is created and inserted
  * into the cache.
+ *
+ * The caches are flat open-addressing tables whose keys carry their
+ * precomputed hash values, a lookup hashes the key once and probes a single
+ * array, and inserting does not allocate a node per entry. The edge function
+ * caches may be bounded by SolverConfiguration::edgeFunctionCacheSize, in
+ * which case the least recently used edge functions are evicted.
+ *
+ * The cache may be queried by multiple threads at the same time. Cache hits
+ * on unbounded caches are served in parallel, whereas hits on bounded caches
+ * update the order of use and are serialized. The construction of new flow
+ * and edge functions is serialized, such that the factory functions of the
+ * underlying problem are never called concurrently.
  */
 template <typename N, typename D, typename M, typename V, typename I>
 class FlowEdgeFunctionCache {
 private:
+  template <typename KeyT>
+  using FlowFunctionCacheT = LRUCache<KeyT, std::shared_ptr<FlowFunction<D>>>;
+  template <typename KeyT>
+  using EdgeFunctionCacheT = LRUCache<KeyT, std::shared_ptr<EdgeFunction<V>>>;
+  // call-to-return flow functions that belong to the same call and return
+  // site, but to different sets of callees; there is usually only one
+  using CallToRetFlowFunctions =
+      std::vector<std::pair<std::set<M>, std::shared_ptr<FlowFunction<D>>>>;
+
   IDETabulationProblem<N, D, M, V, I> &problem;
   // Auto add zero
   bool autoAddZero;
   D zeroValue;
   // Caches for the flow functions
-  std::map<std::tuple<N, N>, std::shared_ptr<FlowFunction<D>>>
-      NormalFlowFunctionCache;
-  std::map<std::tuple<N, M>, std::shared_ptr<FlowFunction<D>>>
-      CallFlowFunctionCache;
-  std::map<std::tuple<N, M, N, N>, std::shared_ptr<FlowFunction<D>>>
-      ReturnFlowFunctionCache;
-  std::map<std::tuple<N, N, std::set<M>>, std::shared_ptr<FlowFunction<D>>>
+  FlowFunctionCacheT<HashedTuple<N, N>> NormalFlowFunctionCache;
+  FlowFunctionCacheT<HashedTuple<N, M>> CallFlowFunctionCache;
+  FlowFunctionCacheT<HashedTuple<N, M, N, N>> ReturnFlowFunctionCache;
+  LRUCache<HashedTuple<N, N>, CallToRetFlowFunctions>
       CallToRetFlowFunctionCache;
   // Caches for the edge functions
-  std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      NormalEdgeFunctionCache;
-  std::map<std::tuple<N, D, M, D>, std::shared_ptr<EdgeFunction<V>>>
-      CallEdgeFunctionCache;
-  std::map<std::tuple<N, M, N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      ReturnEdgeFunctionCache;
-  std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      CallToRetEdgeFunctionCache;
-  std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      SummaryEdgeFunctionCache;
+  EdgeFunctionCacheT<HashedTuple<N, D, N, D>> NormalEdgeFunctionCache;
+  EdgeFunctionCacheT<HashedTuple<N, D, M, D>> CallEdgeFunctionCache;
+  EdgeFunctionCacheT<HashedTuple<N, M, N, D, N, D>> ReturnEdgeFunctionCache;
+  EdgeFunctionCacheT<HashedTuple<N, D, N, D>> CallToRetEdgeFunctionCache;
+  EdgeFunctionCacheT<HashedTuple<N, D, N, D>> SummaryEdgeFunctionCache;
+  // Guards all of the caches above
+  std::shared_mutex CacheMutex;
+  FunctionCacheStatistics FlowFunctionStatistics;
+  FunctionCacheStatistics EdgeFunctionStatistics;
+
+  static std::shared_ptr<FlowFunction<D>>
+  findCallToRetFlowFunction(const CallToRetFlowFunctions *Functions,
+                            const std::set<M> &Callees) {
+    if (Functions) {
+      for (auto &CalleesAndFunction : *Functions) {
+        if (CalleesAndFunction.first == Callees) {
+          return CalleesAndFunction.second;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  template <typename CacheT, typename KeyT, typename ConstructorT>
+  auto lookupOrConstruct(CacheT &Cache, const KeyT &Key,
+                         const std::string &CacheHitCounter,
+                         const std::string &ConstructionCounter,
+                         ConstructorT Construct) {
+    PAMM_GET_INSTANCE;
+    FunctionCacheStatistics &Statistics =
+        std::is_same<decltype(Construct()),
+                     std::shared_ptr<FlowFunction<D>>>::value
+            ? FlowFunctionStatistics
+            : EdgeFunctionStatistics;
+    if (!Cache.isBounded()) {
+      std::shared_lock<std::shared_mutex> Lock(CacheMutex);
+      if (auto *Function = Cache.find(Key)) {
+        INC_COUNTER(CacheHitCounter, 1, PAMM_SEVERITY_LEVEL::Full);
+        Statistics.count(true);
+        return *Function;
+      }
+    }
+    std::unique_lock<std::shared_mutex> Lock(CacheMutex);
+    // another thread may have constructed the function in the meantime
+    if (auto *Function = Cache.lookup(Key)) {
+      INC_COUNTER(CacheHitCounter, 1, PAMM_SEVERITY_LEVEL::Full);
+      Statistics.count(true);
+      return *Function;
+    }
+    INC_COUNTER(ConstructionCounter, 1, PAMM_SEVERITY_LEVEL::Full);
+    Statistics.count(false);
+    return Cache.insert(Key, Construct());
+  }
 
 public:
   // Ctor allows access to the IDEProblem in order to get access to flow and
   // edge function factory functions.
   FlowEdgeFunctionCache(IDETabulationProblem<N, D, M, V, I> &problem)
       : problem(problem), autoAddZero(problem.solver_config.autoAddZero),
-        zeroValue(problem.zeroValue()) {
+        zeroValue(problem.zeroValue()),
+        NormalEdgeFunctionCache(problem.solver_config.edgeFunctionCacheSize),
+        CallEdgeFunctionCache(problem.solver_config.edgeFunctionCacheSize),
+        ReturnEdgeFunctionCache(problem.solver_config.edgeFunctionCacheSize),
+        CallToRetEdgeFunctionCache(
+            problem.solver_config.edgeFunctionCacheSize),
+        SummaryEdgeFunctionCache(problem.solver_config.edgeFunctionCacheSize) {
     PAMM_GET_INSTANCE;
     REG_COUNTER("Normal-FF Construction", 0, PAMM_SEVERITY_LEVEL::Full);
     REG_COUNTER("Normal-FF Cache Hit", 0, PAMM_SEVERITY_LEVEL::Full);
@@ -98,176 +195,166 @@ public:
 
   ~FlowEdgeFunctionCache() = default;
 
-  FlowEdgeFunctionCache(const FlowEdgeFunctionCache &FEFC) = default;
+  FlowEdgeFunctionCache(const FlowEdgeFunctionCache &FEFC) = delete;
 
-  FlowEdgeFunctionCache(FlowEdgeFunctionCache &&FEFC) = default;
+  FlowEdgeFunctionCache(FlowEdgeFunctionCache &&FEFC) = delete;
+
+  const FunctionCacheStatistics &getFlowFunctionStatistics() const {
+    return FlowFunctionStatistics;
+  }
+
+  const FunctionCacheStatistics &getEdgeFunctionStatistics() const {
+    return EdgeFunctionStatistics;
+  }
 
   std::shared_ptr<FlowFunction<D>> getNormalFlowFunction(N curr, N succ) {
-    PAMM_GET_INSTANCE;
-    auto key = std::tie(curr, succ);
-    if (NormalFlowFunctionCache.count(key)) {
-      INC_COUNTER("Normal-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return NormalFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Normal-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ff = (autoAddZero)
-                    ? std::make_shared<ZeroedFlowFunction<D>>(
-                          problem.getNormalFlowFunction(curr, succ), zeroValue)
-                    : problem.getNormalFlowFunction(curr, succ);
-      NormalFlowFunctionCache.insert(make_pair(key, ff));
-      return ff;
-    }
+    return lookupOrConstruct(
+        NormalFlowFunctionCache, HashedTuple<N, N>(curr, succ),
+        "Normal-FF Cache Hit", "Normal-FF Construction",
+        [&]() -> std::shared_ptr<FlowFunction<D>> {
+          if (autoAddZero) {
+            return std::make_shared<ZeroedFlowFunction<D>>(
+                problem.getNormalFlowFunction(curr, succ), zeroValue);
+          }
+          return problem.getNormalFlowFunction(curr, succ);
+        });
   }
 
   std::shared_ptr<FlowFunction<D>> getCallFlowFunction(N callStmt, M destMthd) {
-    PAMM_GET_INSTANCE;
-    auto key = std::tie(callStmt, destMthd);
-    if (CallFlowFunctionCache.count(key)) {
-      INC_COUNTER("Call-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return CallFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Call-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ff =
-          (autoAddZero)
-              ? std::make_shared<ZeroedFlowFunction<D>>(
-                    problem.getCallFlowFunction(callStmt, destMthd), zeroValue)
-              : problem.getCallFlowFunction(callStmt, destMthd);
-      CallFlowFunctionCache.insert(std::make_pair(key, ff));
-      return ff;
-    }
+    return lookupOrConstruct(
+        CallFlowFunctionCache, HashedTuple<N, M>(callStmt, destMthd),
+        "Call-FF Cache Hit", "Call-FF Construction",
+        [&]() -> std::shared_ptr<FlowFunction<D>> {
+          if (autoAddZero) {
+            return std::make_shared<ZeroedFlowFunction<D>>(
+                problem.getCallFlowFunction(callStmt, destMthd), zeroValue);
+          }
+          return problem.getCallFlowFunction(callStmt, destMthd);
+        });
   }
 
   std::shared_ptr<FlowFunction<D>> getRetFlowFunction(N callSite, M calleeMthd,
                                                       N exitStmt, N retSite) {
-    PAMM_GET_INSTANCE;
-    auto key = std::tie(callSite, calleeMthd, exitStmt, retSite);
-    if (ReturnFlowFunctionCache.count(key)) {
-      INC_COUNTER("Return-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return ReturnFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Return-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ff = (autoAddZero)
-                    ? std::make_shared<ZeroedFlowFunction<D>>(
-                          problem.getRetFlowFunction(callSite, calleeMthd,
-                                                     exitStmt, retSite),
-                          zeroValue)
-                    : problem.getRetFlowFunction(callSite, calleeMthd, exitStmt,
-                                                 retSite);
-      ReturnFlowFunctionCache.insert(std::make_pair(key, ff));
-      return ff;
-    }
+    return lookupOrConstruct(
+        ReturnFlowFunctionCache,
+        HashedTuple<N, M, N, N>(callSite, calleeMthd, exitStmt, retSite),
+        "Return-FF Cache Hit", "Return-FF Construction",
+        [&]() -> std::shared_ptr<FlowFunction<D>> {
+          if (autoAddZero) {
+            return std::make_shared<ZeroedFlowFunction<D>>(
+                problem.getRetFlowFunction(callSite, calleeMthd, exitStmt,
+                                           retSite),
+                zeroValue);
+          }
+          return problem.getRetFlowFunction(callSite, calleeMthd, exitStmt,
+                                            retSite);
+        });
   }
 
+  /**
+   * The callees are only copied if a new flow function is constructed.
+   */
   std::shared_ptr<FlowFunction<D>>
-  getCallToRetFlowFunction(N callSite, N retSite, std::set<M> callees) {
+  getCallToRetFlowFunction(N callSite, N retSite, const std::set<M> &callees) {
     PAMM_GET_INSTANCE;
-    auto key = std::tie(callSite, retSite, callees);
-    if (CallToRetFlowFunctionCache.count(key)) {
+    HashedTuple<N, N> Key(callSite, retSite);
+    {
+      std::shared_lock<std::shared_mutex> Lock(CacheMutex);
+      if (auto Function = findCallToRetFlowFunction(
+              CallToRetFlowFunctionCache.find(Key), callees)) {
+        INC_COUNTER("CallToRet-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
+        FlowFunctionStatistics.count(true);
+        return Function;
+      }
+    }
+    std::unique_lock<std::shared_mutex> Lock(CacheMutex);
+    // another thread may have constructed the function in the meantime
+    if (auto Function = findCallToRetFlowFunction(
+            CallToRetFlowFunctionCache.find(Key), callees)) {
       INC_COUNTER("CallToRet-FF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return CallToRetFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("CallToRet-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ff =
-          (autoAddZero)
-              ? std::make_shared<ZeroedFlowFunction<D>>(
-                    problem.getCallToRetFlowFunction(callSite, retSite,
-                                                     callees),
-                    zeroValue)
-              : problem.getCallToRetFlowFunction(callSite, retSite, callees);
-      CallToRetFlowFunctionCache.insert(std::make_pair(key, ff));
-      return ff;
+      FlowFunctionStatistics.count(true);
+      return Function;
+    }
+    INC_COUNTER("CallToRet-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    FlowFunctionStatistics.count(false);
+    std::shared_ptr<FlowFunction<D>> Function =
+        problem.getCallToRetFlowFunction(callSite, retSite, callees);
+    if (autoAddZero) {
+      Function = std::make_shared<ZeroedFlowFunction<D>>(Function, zeroValue);
     }
+    CallToRetFlowFunctionCache.insert(Key, CallToRetFlowFunctions())
+        .emplace_back(callees, Function);
+    return Function;
   }
 
   std::shared_ptr<FlowFunction<D>> getSummaryFlowFunction(N callStmt,
                                                           M destMthd) {
     // PAMM_GET_INSTANCE;
     // INC_COUNTER("Summary-FF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    // summary flow functions are not cached, but we must not call into the
+    // problem concurrently
+    std::unique_lock<std::shared_mutex> Lock(CacheMutex);
     auto ff = problem.getSummaryFlowFunction(callStmt, destMthd);
     return ff;
   }
 
   std::shared_ptr<EdgeFunction<V>> getNormalEdgeFunction(N curr, D currNode,
                                                          N succ, D succNode) {
-    PAMM_GET_INSTANCE;
-    auto key = std::tie(curr, currNode, succ, succNode);
-    if (NormalEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Normal-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return NormalEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Normal-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getNormalEdgeFunction(curr, currNode, succ, succNode);
-      NormalEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
-    }
+    return lookupOrConstruct(
+        NormalEdgeFunctionCache,
+        HashedTuple<N, D, N, D>(curr, currNode, succ, succNode),
+        "Normal-EF Cache Hit", "Normal-EF Construction", [&]() {
+          return problem.getNormalEdgeFunction(curr, currNode, succ, succNode);
+        });
   }
 
   std::shared_ptr<EdgeFunction<V>>
   getCallEdgeFunction(N callStmt, D srcNode, M destinationMethod, D destNode) {
-    PAMM_GET_INSTANCE;
-    auto key = std::tie(callStmt, srcNode, destinationMethod, destNode);
-    if (CallEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Call-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return CallEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Call-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getCallEdgeFunction(callStmt, srcNode,
-                                            destinationMethod, destNode);
-      CallEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
-    }
+    return lookupOrConstruct(
+        CallEdgeFunctionCache,
+        HashedTuple<N, D, M, D>(callStmt, srcNode, destinationMethod,
+                                destNode),
+        "Call-EF Cache Hit", "Call-EF Construction", [&]() {
+          return problem.getCallEdgeFunction(callStmt, srcNode,
+                                             destinationMethod, destNode);
+        });
   }
 
   std::shared_ptr<EdgeFunction<V>> getReturnEdgeFunction(N callSite,
                                                          M calleeMethod,
                                                          N exitStmt, D exitNode,
                                                          N reSite, D retNode) {
-    PAMM_GET_INSTANCE;
-    auto key =
-        std::tie(callSite, calleeMethod, exitStmt, exitNode, reSite, retNode);
-    if (ReturnEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Return-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return ReturnEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Return-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getReturnEdgeFunction(callSite, calleeMethod, exitStmt,
-                                              exitNode, reSite, retNode);
-      ReturnEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
-    }
+    return lookupOrConstruct(
+        ReturnEdgeFunctionCache,
+        HashedTuple<N, M, N, D, N, D>(callSite, calleeMethod, exitStmt,
+                                      exitNode, reSite, retNode),
+        "Return-EF Cache Hit", "Return-EF Construction", [&]() {
+          return problem.getReturnEdgeFunction(callSite, calleeMethod, exitStmt,
+                                               exitNode, reSite, retNode);
+        });
   }
 
   std::shared_ptr<EdgeFunction<V>>
   getCallToRetEdgeFunction(N callSite, D callNode, N retSite, D retSiteNode,
-                           std::set<M> callees) {
-    PAMM_GET_INSTANCE;
-    auto key = std::tie(callSite, callNode, retSite, retSiteNode);
-    if (CallToRetEdgeFunctionCache.count(key)) {
-      INC_COUNTER("CallToRet-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return CallToRetEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("CallToRet-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getCallToRetEdgeFunction(callSite, callNode, retSite,
-                                                 retSiteNode, callees);
-      CallToRetEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
-    }
+                           const std::set<M> &callees) {
+    return lookupOrConstruct(
+        CallToRetEdgeFunctionCache,
+        HashedTuple<N, D, N, D>(callSite, callNode, retSite, retSiteNode),
+        "CallToRet-EF Cache Hit", "CallToRet-EF Construction", [&]() {
+          return problem.getCallToRetEdgeFunction(callSite, callNode, retSite,
+                                                  retSiteNode, callees);
+        });
   }
 
   std::shared_ptr<EdgeFunction<V>>
   getSummaryEdgeFunction(N callSite, D callNode, N retSite, D retSiteNode) {
-    PAMM_GET_INSTANCE;
-    auto key = std::tie(callSite, callNode, retSite, retSiteNode);
-    if (SummaryEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Summary-EF Cache Hit", 1, PAMM_SEVERITY_LEVEL::Full);
-      return SummaryEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Summary-EF Construction", 1, PAMM_SEVERITY_LEVEL::Full);
-      auto ef = problem.getSummaryEdgeFunction(callSite, callNode, retSite,
-                                               retSiteNode);
-      SummaryEdgeFunctionCache.insert(std::make_pair(key, ef));
-      return ef;
-    }
+    return lookupOrConstruct(
+        SummaryEdgeFunctionCache,
+        HashedTuple<N, D, N, D>(callSite, callNode, retSite, retSiteNode),
+        "Summary-EF Cache Hit", "Summary-EF Construction", [&]() {
+          return problem.getSummaryEdgeFunction(callSite, callNode, retSite,
+                                                retSiteNode);
+        });
   }
 
   void print() {
@@ -363,6 +450,15 @@ public:
                             "Return-EF Construction",
                             "CallToRet-EF Construction",
                             "Summary-EF Construction"}));
+      if (NormalEdgeFunctionCache.isBounded()) {
+        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                      << "Total edge function evictions: "
+                      << NormalEdgeFunctionCache.getNumEvictions() +
+                             CallEdgeFunctionCache.getNumEvictions() +
+                             ReturnEdgeFunctionCache.getNumEvictions() +
+                             CallToRetEdgeFunctionCache.getNumEvictions() +
+                             SummaryEdgeFunctionCache.getNumEvictions());
+      }
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                     << "----------------------------------------------");
     } else {
@@ -19,12 +19,40 @@
 
 #include <set>
 
+#include <phasar/Config/ContainerConfiguration.h>
+
 namespace psr {
 
 template <typename D> class FlowFunction {
 public:
+  using container_type = FFSet<D>;
+
   virtual ~FlowFunction() = default;
   virtual std::set<D> computeTargets(D source) = 0;
+
+  /**
+   * Appends the targets of source to Targets, each of them once. This is the
+   * variant the solvers use: Targets stores a few facts in place, whereas
+   * computeTargets() allocates tree nodes for every fact. The default
+   * implementation copies the result of computeTargets(); flow functions
+   * that produce few facts should override it.
+   */
+  virtual void computeTargetsInto(D source, container_type &Targets) {
+    std::set<D> Result = computeTargets(source);
+    Targets.insert(Targets.end(), Result.begin(), Result.end());
+  }
+
+  /**
+   * Returns true if the flow function maps every fact to itself. Solvers may
+   * then skip its application.
+   */
+  virtual bool isIdentity() const { return false; }
+
+  /**
+   * Returns true if the flow function maps every fact to the empty set.
+   * Solvers may then skip its application.
+   */
+  virtual bool isKillAll() const { return false; }
 };
 
 } // namespace psr
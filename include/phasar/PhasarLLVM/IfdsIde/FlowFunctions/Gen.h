@@ -37,6 +37,13 @@ public:
     else
       return {source};
   }
+  void computeTargetsInto(
+      D source, typename FlowFunction<D>::container_type &Targets) override {
+    Targets.push_back(source);
+    if (source == zeroValue && !(genValue == zeroValue)) {
+      Targets.push_back(genValue);
+    }
+  }
 };
 
 } // namespace psr
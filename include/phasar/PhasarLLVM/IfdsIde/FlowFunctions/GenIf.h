@@ -37,6 +37,13 @@ public:
     else
       return {source};
   }
+  void computeTargetsInto(
+      D source, typename FlowFunction<D>::container_type &Targets) override {
+    Targets.push_back(source);
+    if (Predicate(source) && !(genValue == source)) {
+      Targets.push_back(genValue);
+    }
+  }
 };
 
 } // namespace psr
@@ -34,6 +34,11 @@ public:
   Identity &operator=(const Identity &i) = delete;
   // simply return what the user provides
   std::set<D> computeTargets(D source) override { return {source}; }
+  void computeTargetsInto(
+      D source, typename FlowFunction<D>::container_type &Targets) override {
+    Targets.push_back(source);
+  }
+  bool isIdentity() const override { return true; }
   static std::shared_ptr<Identity> getInstance() {
     static std::shared_ptr<Identity> instance =
         std::shared_ptr<Identity>(new Identity);
@@ -36,6 +36,12 @@ public:
     else
       return {source};
   }
+  void computeTargetsInto(
+      D source, typename FlowFunction<D>::container_type &Targets) override {
+    if (!(source == killValue)) {
+      Targets.push_back(source);
+    }
+  }
 };
 
 } // namespace psr
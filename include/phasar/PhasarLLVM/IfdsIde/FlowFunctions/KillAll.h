@@ -33,6 +33,9 @@ public:
   KillAll(const KillAll &k) = delete;
   KillAll &operator=(const KillAll &k) = delete;
   std::set<D> computeTargets(D source) override { return std::set<D>(); }
+  void computeTargetsInto(
+      D source, typename FlowFunction<D>::container_type &Targets) override {}
+  bool isKillAll() const override { return true; }
   static std::shared_ptr<KillAll<D>> getInstance() {
     static std::shared_ptr<KillAll> instance =
         std::shared_ptr<KillAll>(new KillAll);
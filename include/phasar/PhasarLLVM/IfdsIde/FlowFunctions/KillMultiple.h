@@ -29,6 +29,12 @@ public:
     else
       return {source};
   }
+  void computeTargetsInto(
+      D source, typename FlowFunction<D>::container_type &Targets) override {
+    if (killValues.find(source) == killValues.end()) {
+      Targets.push_back(source);
+    }
+  }
 };
 
 } // namespace psr
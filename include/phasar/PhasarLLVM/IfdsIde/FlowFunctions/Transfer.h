@@ -39,6 +39,17 @@ public:
     else
       return {source};
   }
+  void computeTargetsInto(
+      D source, typename FlowFunction<D>::container_type &Targets) override {
+    if (source == fromValue) {
+      Targets.push_back(source);
+      if (!(toValue == fromValue)) {
+        Targets.push_back(toValue);
+      }
+    } else if (!(source == toValue)) {
+      Targets.push_back(source);
+    }
+  }
 };
 } // namespace psr
 
@@ -10,13 +10,53 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_IDESUMMARY_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_IDESUMMARY_H_
 
+#include <cstddef>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+
 namespace psr {
 
-// template <typename N, typename D, typename M, typename V, typename I>
+/**
+ * The end summaries of a single function in a form that outlives the
+ * analysis run that has computed them. Nodes and data-flow facts are encoded
+ * as strings that identify them within the function, e.g. as produced by
+ * FunctionLocalIDs. A summary only holds as long as neither the function nor
+ * any function it calls is changed, hence it is keyed by the function's name
+ * and by a hash that covers all of these functions.
+ */
 class IDESummary {
 public:
+  // <SourceFact> at the function's start point reaches <TargetFact> at
+  // <ExitStmt>; the edge function is the identity
+  struct Entry {
+    std::string SourceFact;
+    std::string ExitStmt;
+    std::string TargetFact;
+
+    friend bool operator<(const Entry &Lhs, const Entry &Rhs) {
+      return std::tie(Lhs.SourceFact, Lhs.ExitStmt, Lhs.TargetFact) <
+             std::tie(Rhs.SourceFact, Rhs.ExitStmt, Rhs.TargetFact);
+    }
+  };
+
+  std::string FunctionName;
+  std::size_t Hash = 0;
+  // all facts at the start point the function has been tabulated for, some
+  // of which may not reach any exit statement
+  std::set<std::string> SourceFacts;
+  std::set<Entry> Entries;
+  // the facts reached at all nodes of the function, which allow to restore
+  // the results within the function when its summaries are reused; empty if
+  // the solver does not persist them
+  std::set<Entry> ReachedFacts;
+
   IDESummary() {}
+  IDESummary(std::string FunctionName, std::size_t Hash)
+      : FunctionName(std::move(FunctionName)), Hash(Hash) {}
 };
+
 } // namespace psr
 
 #endif
@@ -49,6 +49,10 @@ public:
   N getStartNode() const { return StartNode; }
 
   N getEndNode() const { return EndNode; }
+
+  const std::vector<bool> &getContext() const { return Context; }
+
+  const std::set<D> &getOutputs() const { return Outputs; }
 };
 
 } // namespace psr
@@ -29,8 +29,10 @@ namespace psr {
 
 template <typename D, typename N> class IFDSSummaryPool {
 private:
-  /// Stores the summary that starts at a given node.
-  std::map<N, std::map<std::vector<bool>, IFDSSummary<D, N>>> SummaryMap;
+  /// Stores the summaries that start at a given node, by context and by the
+  /// node they end at.
+  std::map<N, std::map<std::vector<bool>, std::map<N, IFDSSummary<D, N>>>>
+      SummaryMap;
 
 public:
   IFDSSummaryPool() = default;
@@ -38,13 +40,31 @@ public:
 
   void insertSummary(N StartNode, std::vector<bool> Context,
                      IFDSSummary<D, N> Summary) {
-    SummaryMap[StartNode][Context] = Summary;
+    SummaryMap[StartNode][Context].insert_or_assign(Summary.getEndNode(),
+                                                    Summary);
   }
 
   bool containsSummary(N StartNode) { return SummaryMap.count(StartNode); }
 
-  std::set<D> getSummary(N StartNode, std::vector<bool> Context) {
-    return SummaryMap[StartNode][Context];
+  bool containsSummary(N StartNode, const std::vector<bool> &Context) {
+    auto search = SummaryMap.find(StartNode);
+    return search != SummaryMap.end() && search->second.count(Context);
+  }
+
+  IFDSSummary<D, N> getSummary(N StartNode, const std::vector<bool> &Context,
+                               N EndNode) {
+    return SummaryMap.at(StartNode).at(Context).at(EndNode);
+  }
+
+  /// Returns the summaries of the given start node and context, one for each
+  /// node they end at.
+  std::vector<IFDSSummary<D, N>>
+  getSummaries(N StartNode, const std::vector<bool> &Context) {
+    std::vector<IFDSSummary<D, N>> Summaries;
+    for (auto &entry : SummaryMap.at(StartNode).at(Context)) {
+      Summaries.push_back(entry.second);
+    }
+    return Summaries;
   }
 
   void print() {
@@ -56,12 +76,14 @@ public:
         for_each(context_summaries.first.begin(), context_summaries.first.end(),
                  [](bool b) { std::cout << b; });
         std::cout << "\n";
-        std::cout << "Beg results:\n";
-        for (auto &result : context_summaries.second) {
-          // result->dump();
-          std::cout << "fixme\n";
+        for (auto &end_summary : context_summaries.second) {
+          std::cout << "Beg results:\n";
+          for (auto &result : end_summary.second.getOutputs()) {
+            // result->dump();
+            std::cout << "fixme\n";
+          }
+          std::cout << "End results!\n";
         }
-        std::cout << "End results!\n";
       }
     }
   }
@@ -40,6 +40,20 @@ public:
   virtual std::map<N, std::set<D>> initialSeeds() = 0;
   virtual D zeroValue() = 0;
   virtual bool isZeroValue(D d) const = 0;
+  /**
+   * Returns true if the flow functions record results besides the facts they
+   * compute, e.g. in members of the problem. The persisted summaries of such
+   * a problem are never reused, since reusing them skips the flow functions
+   * within the methods they summarize. Problems whose flow functions only
+   * compute facts must opt in to the reuse by returning false.
+   */
+  virtual bool hasFlowFunctionSideEffects() const { return true; }
+  /**
+   * Returns true if the results depend on the order in which path edges are
+   * processed, e.g. if the flow functions read what other flow functions
+   * have recorded. Such a problem is always solved on a single thread.
+   */
+  virtual bool dependsOnProcessingOrder() const { return false; }
   void setSolverConfiguration(SolverConfiguration conf) {
     solver_config = conf;
   }
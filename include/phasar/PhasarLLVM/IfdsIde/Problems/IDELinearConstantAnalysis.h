@@ -10,6 +10,7 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_PROBLEMS_IDELINEARCONSTANTANALYSIS_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_PROBLEMS_IDELINEARCONSTANTANALYSIS_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -36,9 +37,9 @@ private:
   std::vector<std::string> EntryPoints;
 
   // For debug purpose only
-  static unsigned CurrGenConstant_Id;
-  static unsigned CurrLCAID_Id;
-  static unsigned CurrBinary_Id;
+  static std::atomic<unsigned> CurrGenConstant_Id;
+  static std::atomic<unsigned> CurrLCAID_Id;
+  static std::atomic<unsigned> CurrBinary_Id;
 
 public:
   typedef const llvm::Value *d_t;
@@ -83,6 +84,8 @@ public:
 
   bool isZeroValue(d_t d) const override;
 
+  bool hasFlowFunctionSideEffects() const override;
+
   // in addition provide specifications for the IDE parts
 
   std::shared_ptr<EdgeFunction<v_t>>
@@ -148,6 +151,8 @@ public:
 
     bool equal_to(std::shared_ptr<EdgeFunction<v_t>> other) const override;
 
+    std::size_t hash() const override;
+
     void print(std::ostream &OS, bool isForDebug = false) const override;
   };
 
@@ -72,6 +72,8 @@ public:
 
   bool isZeroValue(d_t d) const override;
 
+  bool hasFlowFunctionSideEffects() const override;
+
   // in addition provide specifications for the IDE parts
 
   std::shared_ptr<EdgeFunction<v_t>>
@@ -12,6 +12,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -54,6 +55,7 @@ private:
   std::vector<std::string> EntryPoints;
   // Holds all initialized variables and objects.
   std::set<d_t> Initialized;
+  mutable std::mutex InitializedMutex;
 
 public:
   IFDSConstAnalysis(i_t icfg, const LLVMTypeHierarchy &th,
@@ -159,6 +161,10 @@ public:
 
   bool isZeroValue(d_t d) const override;
 
+  bool hasFlowFunctionSideEffects() const override;
+
+  bool dependsOnProcessingOrder() const override;
+
   void printNode(std::ostream &os, n_t n) const override;
 
   void printDataFlowFact(std::ostream &os, d_t d) const override;
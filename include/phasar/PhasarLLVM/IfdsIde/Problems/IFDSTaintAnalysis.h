@@ -13,6 +13,7 @@
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <phasar/PhasarLLVM/IfdsIde/LLVMDefaultIFDSTabulationProblem.h>
 #include <phasar/PhasarLLVM/Utils/TaintConfiguration.h>
 #include <set>
@@ -51,6 +52,8 @@ public:
 private:
   TaintConfiguration<const llvm::Value *> SourceSinkFunctions;
   std::vector<std::string> EntryPoints;
+  // flow functions may be applied by multiple threads
+  std::mutex LeaksMutex;
 
 public:
   /// Holds all leaks found during the analysis
@@ -93,6 +96,8 @@ public:
 
   bool isZeroValue(d_t d) const override;
 
+  bool hasFlowFunctionSideEffects() const override;
+
   void printNode(std::ostream &os, n_t n) const override;
 
   void printDataFlowFact(std::ostream &os, d_t d) const override;
@@ -12,6 +12,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -37,6 +38,8 @@ public:
 
 private:
   std::map<n_t, std::set<d_t>> UndefValueUses;
+  // flow functions may be applied by multiple threads
+  std::mutex UndefValueUsesMutex;
   std::vector<std::string> EntryPoints;
 
 public:
@@ -70,6 +73,8 @@ public:
 
   bool isZeroValue(d_t d) const override;
 
+  bool hasFlowFunctionSideEffects() const override;
+
   void printNode(std::ostream &os, n_t n) const override;
 
   void printDataFlowFact(std::ostream &os, d_t d) const override;
@@ -17,4 +17,241 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_BIDIIDESOLVER_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_BIDIIDESOLVER_H_
 
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <phasar/PhasarLLVM/IfdsIde/IDETabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IDESolver.h>
+#include <phasar/Utils/Logger.h>
+#include <phasar/Utils/PAMMMacros.h>
+
+namespace psr {
+
+/**
+ * Lets the problems of a bidirectional analysis ask the other direction for
+ * facts while they are being solved, e.g. a forward taint analysis that
+ * starts a backward search for the aliases of a pointer at a store. Problems
+ * keep a reference to the solver through this interface and usually request
+ * facts from within their flow functions.
+ */
+template <typename N, typename D> class BiDiFactExchange {
+public:
+  virtual ~BiDiFactExchange() = default;
+
+  /**
+   * Requests the forward direction to tabulate d starting at n.
+   */
+  virtual void requestForward(N n, D d) = 0;
+
+  /**
+   * Requests the backward direction to tabulate d starting at n.
+   */
+  virtual void requestBackward(N n, D d) = 0;
+};
+
+/**
+ * One direction of a bidirectional solver: a solver whose path edges are
+ * processed one at a time by the bidirectional solver's scheduler rather
+ * than by the solver itself.
+ *
+ * @param <SolverT> The IDESolver or IFDSSolver that solves this direction.
+ */
+template <typename SolverT> class BiDiSolverDirection : public SolverT {
+public:
+  // both directions are driven by the same thread
+  template <typename ProblemT>
+  explicit BiDiSolverDirection(ProblemT &problem)
+      : SolverT(problem, SolverT::singleThreaded(problem.solver_config)) {}
+
+  ~BiDiSolverDirection() override = default;
+
+  /**
+   * Propagates the initial seeds. Counters are shared by both directions,
+   * hence only one of them may register them.
+   */
+  void seed(bool registerCounters) {
+    if (registerCounters) {
+      this->registerCounters();
+    } else {
+      this->countersRegistered = true;
+    }
+    this->startClock();
+    this->seedPathEdges();
+  }
+
+  // adds the facts requested by the other direction
+  using SolverT::addSeed;
+
+  /**
+   * Returns true if there are pending path edges and the direction's budget
+   * is not exceeded. The pending path edges of a direction that has
+   * exceeded its budget remain unprocessed, like the ones of an IDESolver.
+   */
+  bool hasPendingWork() {
+    return !this->WorkList.empty() && !this->budgetExceeded();
+  }
+
+  /**
+   * Processes the next pending path edge and reports the progress if a
+   * progress stream is configured.
+   */
+  void step() { this->pathEdgeProcessingTask(this->WorkList.pop()); }
+
+  /**
+   * Completes the direction once no direction has pending path edges.
+   */
+  void finish() {
+    this->finishTabulation();
+    if (this->computevalues) {
+      this->computeValues();
+      if (this->compactResults) {
+        this->compactResultTable();
+      }
+    }
+    this->restoreSpilledEdges();
+  }
+
+protected:
+  // the pending path edges of a method may still grow by requests of the
+  // other direction
+  bool evictsFinishedProcedures() override { return false; }
+};
+
+/**
+ * Drives a forward and a backward solver by a single scheduler that
+ * alternates between the pending path edges of both directions, such that
+ * facts that one direction requests from the other, see BiDiFactExchange,
+ * are tabulated while the requesting direction is still running. Requested
+ * facts are added as seeds of the other direction. Solving stops as soon as
+ * neither direction has pending path edges nor requests.
+ *
+ * Requests usually start in the middle of a method, hence the problems
+ * should follow returns past seeds to let requested facts leave it.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts shared by both directions.
+ * @param <SolverT> The type of solver used for each direction.
+ * @param <BackwardSolverT> The type of solver used for the backward
+ * direction, which differs from SolverT in its control-flow graph type.
+ */
+template <typename N, typename D, typename SolverT, typename BackwardSolverT>
+class BiDiSolver : public BiDiFactExchange<N, D> {
+protected:
+  BiDiSolverDirection<SolverT> fwSolver;
+  BiDiSolverDirection<BackwardSolverT> bwSolver;
+
+  // requests that have not been seeded yet, and all requests ever made
+  std::vector<std::pair<N, D>> fwRequests;
+  std::vector<std::pair<N, D>> bwRequests;
+  std::set<std::pair<N, D>> fwRequested;
+  std::set<std::pair<N, D>> bwRequested;
+
+  /**
+   * Adds the pending requests as seeds of the requested directions.
+   */
+  void seedRequests() {
+    PAMM_GET_INSTANCE;
+    INC_COUNTER("BiDi Requests", fwRequests.size() + bwRequests.size(),
+                PAMM_SEVERITY_LEVEL::Core);
+    for (auto &request : fwRequests) {
+      fwSolver.addSeed(request.first, request.second);
+    }
+    for (auto &request : bwRequests) {
+      bwSolver.addSeed(request.first, request.second);
+    }
+    fwRequests.clear();
+    bwRequests.clear();
+  }
+
+public:
+  template <typename ProblemT, typename BackwardProblemT>
+  BiDiSolver(ProblemT &fwProblem, BackwardProblemT &bwProblem)
+      : fwSolver(fwProblem), bwSolver(bwProblem) {}
+
+  ~BiDiSolver() override = default;
+
+  void requestForward(N n, D d) override {
+    if (fwRequested.insert(std::make_pair(n, d)).second) {
+      fwRequests.emplace_back(n, d);
+    }
+  }
+
+  void requestBackward(N n, D d) override {
+    if (bwRequested.insert(std::make_pair(n, d)).second) {
+      bwRequests.emplace_back(n, d);
+    }
+  }
+
+  /**
+   * Runs both directions until neither has pending work, then computes the
+   * values of both.
+   */
+  virtual void solve() {
+    PAMM_GET_INSTANCE;
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "BiDi solver is solving the specified problems");
+    fwSolver.seed(true);
+    bwSolver.seed(false);
+    REG_COUNTER("BiDi Requests", 0, PAMM_SEVERITY_LEVEL::Core);
+    START_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
+    while (true) {
+      seedRequests();
+      bool fwPending = fwSolver.hasPendingWork();
+      bool bwPending = bwSolver.hasPendingWork();
+      if (!fwPending && !bwPending) {
+        break;
+      }
+      // alternate single path edges, such that no direction runs ahead
+      // while the other one may still request facts from it
+      if (fwPending) {
+        fwSolver.step();
+      }
+      if (bwPending) {
+        bwSolver.step();
+      }
+    }
+    STOP_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
+    START_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
+    fwSolver.finish();
+    bwSolver.finish();
+    STOP_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Problems solved");
+  }
+
+  SolverT &getForwardSolver() { return fwSolver; }
+
+  BackwardSolverT &getBackwardSolver() { return bwSolver; }
+};
+
+/**
+ * Solves a forward and a backward IDETabulationProblem over the same facts
+ * in an interleaved manner, see BiDiSolver.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problems.
+ * @param <M> The type of objects used to represent methods.
+ * @param <V> The type of values to be computed along flow edges.
+ * @param <I> The type of inter-procedural control-flow graph used by the
+ * forward problem.
+ * @param <BackwardI> The type of inter-procedural control-flow graph used
+ * by the backward problem.
+ */
+template <typename N, typename D, typename M, typename V, typename I,
+          typename BackwardI = I>
+class BiDiIDESolver : public BiDiSolver<N, D, IDESolver<N, D, M, V, I>,
+                                        IDESolver<N, D, M, V, BackwardI>> {
+public:
+  BiDiIDESolver(IDETabulationProblem<N, D, M, V, I> &fwProblem,
+                IDETabulationProblem<N, D, M, V, BackwardI> &bwProblem)
+      : BiDiSolver<N, D, IDESolver<N, D, M, V, I>,
+                   IDESolver<N, D, M, V, BackwardI>>(fwProblem, bwProblem) {}
+
+  ~BiDiIDESolver() override = default;
+};
+
+} // namespace psr
+
 #endif
@@ -16,4 +16,52 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_BIDIIFDSSOLVER_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_BIDIIFDSSOLVER_H_
 
+#include <set>
+
+#include <phasar/PhasarLLVM/IfdsIde/IFDSTabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/BiDiIDESolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
+
+namespace psr {
+
+/**
+ * Solves a forward and a backward IFDSTabulationProblem over the same facts
+ * in an interleaved manner, see BiDiSolver. A typical use is an alias-aware
+ * taint analysis whose forward problem requests a backward search for the
+ * aliases of a tainted memory location, which in turn requests the forward
+ * direction to taint the aliases it finds.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problems.
+ * @param <M> The type of objects used to represent methods.
+ * @param <I> The type of inter-procedural control-flow graph used by the
+ * forward problem.
+ * @param <BackwardI> The type of inter-procedural control-flow graph used
+ * by the backward problem.
+ */
+template <typename N, typename D, typename M, typename I,
+          typename BackwardI = I>
+class BiDiIFDSSolver
+    : public BiDiSolver<N, D, IFDSSolver<N, D, M, I>,
+                        IFDSSolver<N, D, M, BackwardI>> {
+public:
+  BiDiIFDSSolver(IFDSTabulationProblem<N, D, M, I> &fwProblem,
+                 IFDSTabulationProblem<N, D, M, BackwardI> &bwProblem)
+      : BiDiSolver<N, D, IFDSSolver<N, D, M, I>,
+                   IFDSSolver<N, D, M, BackwardI>>(fwProblem, bwProblem) {}
+
+  ~BiDiIFDSSolver() override = default;
+
+  std::set<D> forwardResultsAt(N stmt) {
+    return this->fwSolver.ifdsResultsAt(stmt);
+  }
+
+  std::set<D> backwardResultsAt(N stmt) {
+    return this->bwSolver.ifdsResultsAt(stmt);
+  }
+};
+
+} // namespace psr
+
 #endif
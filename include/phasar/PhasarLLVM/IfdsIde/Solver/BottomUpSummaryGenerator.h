@@ -0,0 +1,360 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_BOTTOMUPSUMMARYGENERATOR_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_BOTTOMUPSUMMARYGENERATOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <llvm/IR/Argument.h>
+#include <llvm/IR/Function.h>
+
+#include <phasar/PhasarLLVM/IfdsIde/IDETabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/IFDSSummary.h>
+#include <phasar/PhasarLLVM/IfdsIde/IFDSSummaryPool.h>
+#include <phasar/PhasarLLVM/IfdsIde/IFDSTabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IDESolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
+#include <phasar/Utils/LLVMShorthands.h>
+#include <phasar/Utils/Logger.h>
+#include <phasar/Utils/PAMMMacros.h>
+#include <phasar/Utils/WorkStealingScheduler.h>
+
+namespace psr {
+
+/**
+ * Computes the end summaries of all methods of a program bottom-up over the
+ * strongly connected components of the call graph and persists them, such
+ * that later whole-program runs of the same problem reuse them rather than
+ * tabulating the methods again.
+ *
+ * Every method is tabulated for each of its inputs, by default its formal
+ * parameters and the globals it uses, and for the zero value, each in a
+ * solver run of its own. The summaries of IFDS problems, and of the IDE
+ * problems whose summaries can be persisted, distribute over the inputs,
+ * hence they cover every combination of inputs as well. The runs of a
+ * component start as soon as all components that it calls are completed,
+ * whose summaries are then found in the SummaryStore instead of being
+ * recomputed. Runs of independent components, and the runs of the different
+ * methods and inputs of a component, are distributed over a thread pool.
+ *
+ * Each run uses a fresh problem instance from the given factory, which is
+ * configured to persist its summaries to the given directory; later runs
+ * must use the same directory. The facts reached at the exits of each method
+ * are collected in an IFDSSummaryPool as well.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problem.
+ * @param <M> The type of objects used to represent methods.
+ * @param <I> The type of inter-procedural control-flow graph being used, which
+ * must provide getCallGraphSCCs() as LLVMBasedICFG does.
+ * @param <ProblemT> The type of the tabulation problem.
+ * @param <SolverT> The type of solver to tabulate ProblemT.
+ */
+template <typename N, typename D, typename M, typename I, typename ProblemT,
+          typename SolverT>
+class BottomUpSummaryGenerator {
+public:
+  using ProblemFactory = std::function<std::unique_ptr<ProblemT>()>;
+  using InputFunction = std::function<std::vector<D>(M)>;
+
+private:
+  // tabulates a single method for a single input
+  class SummarySolver : public SolverT {
+  public:
+    SummarySolver(ProblemT &problem) : SolverT(problem) {
+      // the method's contexts take the place of the problem's seeds
+      this->initialSeeds.clear();
+    }
+
+    void registerCountersOnce() { this->registerCounters(); }
+
+    /**
+     * Computes the end summaries of method for d3 at its start points and
+     * adds the facts reached at its exits to exits. Returns true if they have
+     * been reused from the summary store.
+     */
+    bool summarize(M method, D d3, std::map<N, std::set<D>> &exits) {
+      this->countersRegistered = true;
+      this->budget.start();
+      bool reused = true;
+      // reusing a summary records path edges within the method
+      this->restoreProcedure(method);
+      for (N sP : this->icfg.getStartPointsOf(method)) {
+        if (!this->reusePersistedSummary(method, sP, d3)) {
+          reused = false;
+          this->addSummaryContext(sP, d3);
+        }
+      }
+      this->processWorkList();
+      if (!this->isComplete()) {
+        return false;
+      }
+      this->restoreSpilledSummaries();
+      this->storePersistedSummaries();
+      for (N sP : this->icfg.getStartPointsOf(method)) {
+        if (!this->getPersistableEndSummary(sP, d3, exits)) {
+          exits.clear();
+          return reused;
+        }
+      }
+      return reused;
+    }
+  };
+
+  struct Task {
+    std::size_t SCC;
+    M Method;
+    // the input is the zero value if the context has no bit set
+    D Input;
+    std::vector<bool> Context;
+  };
+
+  I icfg;
+  ProblemFactory makeProblem;
+  std::string SummaryDirectory;
+  InputFunction InputsOf;
+  unsigned NumThreads;
+
+  // the zero value of the problem, which is the input of the tasks that have
+  // the empty context
+  D ZeroValue;
+
+  // the strongly connected components of the call graph, callees first
+  std::vector<std::vector<M>> SCCs;
+  // indices of the components that call each component
+  std::vector<std::vector<std::size_t>> CallerSCCs;
+
+  IFDSSummaryPool<D, N> SummaryPool;
+  // guards SummaryPool
+  std::mutex PoolMutex;
+
+  std::size_t NumRuns = 0;
+  std::atomic<std::size_t> NumReused;
+  std::atomic<std::size_t> NumIncomplete;
+
+  static constexpr bool IsLLVMProblem =
+      std::is_same<D, const llvm::Value *>::value &&
+      std::is_same<M, const llvm::Function *>::value;
+
+  std::vector<D> inputsOf(M method) {
+    if (InputsOf) {
+      return InputsOf(method);
+    }
+    std::vector<D> inputs;
+    if constexpr (IsLLVMProblem) {
+      for (const llvm::Argument &arg : method->args()) {
+        inputs.push_back(&arg);
+      }
+      for (const llvm::Value *global : globalValuesUsedinFunction(method)) {
+        inputs.push_back(global);
+      }
+    }
+    return inputs;
+  }
+
+  std::unique_ptr<ProblemT> createProblem() {
+    std::unique_ptr<ProblemT> problem = makeProblem();
+    SolverConfiguration &config = problem->solver_config;
+    // the runs are distributed over the threads rather than the path edges
+    config.numThreads = 1;
+    config.computeValues = false;
+    config.followReturnsPastSeeds = false;
+    config.recordEdges = false;
+    config.computePersistedSummaries = true;
+    config.summaryDirectory = SummaryDirectory;
+    config.progressDestination.clear();
+    return problem;
+  }
+
+  void scheduleSCC(std::size_t SCC, WorkStealingScheduler<Task> &Scheduler,
+                   std::vector<std::atomic<std::size_t>> &PendingRuns) {
+    std::vector<Task> tasks;
+    for (M method : SCCs[SCC]) {
+      std::vector<D> inputs = inputsOf(method);
+      // the zero value is represented by the empty context
+      tasks.push_back(
+          {SCC, method, ZeroValue, std::vector<bool>(inputs.size())});
+      for (std::size_t idx = 0; idx < inputs.size(); ++idx) {
+        std::vector<bool> context(inputs.size());
+        context[idx] = true;
+        tasks.push_back({SCC, method, inputs[idx], std::move(context)});
+      }
+    }
+    PendingRuns[SCC] = tasks.size();
+    for (Task &task : tasks) {
+      Scheduler.push(std::move(task));
+    }
+  }
+
+  void runTask(Task &task) {
+    auto &lg = lg::get();
+    std::unique_ptr<ProblemT> problem = createProblem();
+    SummarySolver solver(*problem);
+    D zero = problem->zeroValue();
+    bool isZero = std::find(task.Context.begin(), task.Context.end(), true) ==
+                  task.Context.end();
+    // every problem instance may create a zero value of its own
+    D d3 = isZero ? zero : task.Input;
+    std::map<N, std::set<D>> exits;
+    if (solver.summarize(task.Method, d3, exits)) {
+      ++NumReused;
+    }
+    if (!solver.isComplete()) {
+      ++NumIncomplete;
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                    << "Exceeded the " << solver.getExceededBudget()
+                    << " budget, no summaries for "
+                    << icfg.getMethodName(task.Method));
+      return;
+    }
+    std::lock_guard<std::mutex> Lock(PoolMutex);
+    for (N sP : icfg.getStartPointsOf(task.Method)) {
+      for (auto &exit : exits) {
+        SummaryPool.insertSummary(sP, task.Context,
+                                  IFDSSummary<D, N>(sP, exit.first,
+                                                    task.Context, exit.second,
+                                                    zero));
+      }
+    }
+  }
+
+public:
+  /**
+   * @param icfg the call graph of the program.
+   * @param makeProblem returns a new instance of the problem, it is called
+   * concurrently.
+   * @param SummaryDirectory the directory the summaries are persisted to.
+   * @param InputsOf returns the facts a method is tabulated for, besides the
+   * zero value; the default is suitable for LLVM-based problems.
+   * @param NumThreads the number of threads used to run the solvers.
+   */
+  BottomUpSummaryGenerator(I icfg, ProblemFactory makeProblem,
+                           std::string SummaryDirectory,
+                           InputFunction InputsOf = nullptr,
+                           unsigned NumThreads = 1)
+      : icfg(icfg), makeProblem(std::move(makeProblem)),
+        SummaryDirectory(std::move(SummaryDirectory)),
+        InputsOf(std::move(InputsOf)), NumThreads(NumThreads), NumReused(0),
+        NumIncomplete(0) {}
+
+  ~BottomUpSummaryGenerator() = default;
+
+  BottomUpSummaryGenerator(const BottomUpSummaryGenerator &) = delete;
+  BottomUpSummaryGenerator &
+  operator=(const BottomUpSummaryGenerator &) = delete;
+
+  /**
+   * Computes and persists the summaries of all methods.
+   */
+  void generateSummaries() {
+    PAMM_GET_INSTANCE;
+    auto &lg = lg::get();
+    SCCs = icfg.getCallGraphSCCs();
+    std::unordered_map<M, std::size_t> SCCOf;
+    for (std::size_t SCC = 0; SCC < SCCs.size(); ++SCC) {
+      for (M method : SCCs[SCC]) {
+        SCCOf[method] = SCC;
+      }
+    }
+    CallerSCCs.assign(SCCs.size(), {});
+    std::vector<std::atomic<std::size_t>> PendingCallees(SCCs.size());
+    std::vector<std::atomic<std::size_t>> PendingRuns(SCCs.size());
+    for (std::size_t SCC = 0; SCC < SCCs.size(); ++SCC) {
+      std::set<std::size_t> callees;
+      for (M method : SCCs[SCC]) {
+        for (N callSite : icfg.getCallsFromWithin(method)) {
+          for (M callee : icfg.getCalleesOfCallAt(callSite)) {
+            auto search = SCCOf.find(callee);
+            if (search != SCCOf.end() && search->second != SCC) {
+              callees.insert(search->second);
+            }
+          }
+        }
+      }
+      PendingCallees[SCC] = callees.size();
+      for (std::size_t callee : callees) {
+        CallerSCCs[callee].push_back(SCC);
+      }
+    }
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Generate the summaries of " << SCCOf.size()
+                  << " methods in " << SCCs.size()
+                  << " strongly connected components");
+    // the runs only share the counters, which are registered up front
+    {
+      std::unique_ptr<ProblemT> problem = createProblem();
+      ZeroValue = problem->zeroValue();
+      SummarySolver(*problem).registerCountersOnce();
+    }
+    WorkStealingScheduler<Task> Scheduler(NumThreads);
+    for (std::size_t SCC = 0; SCC < SCCs.size(); ++SCC) {
+      if (PendingCallees[SCC] == 0) {
+        scheduleSCC(SCC, Scheduler, PendingRuns);
+      }
+    }
+    std::atomic<std::size_t> Runs(0);
+    Scheduler.run([&](Task &task) {
+      runTask(task);
+      ++Runs;
+      if (--PendingRuns[task.SCC] != 0) {
+        return;
+      }
+      // the component is completed, its callers may be ready
+      for (std::size_t caller : CallerSCCs[task.SCC]) {
+        if (--PendingCallees[caller] == 0) {
+          scheduleSCC(caller, Scheduler, PendingRuns);
+        }
+      }
+    });
+    NumRuns = Runs;
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Generated summaries in " << NumRuns << " runs, "
+                  << NumReused << " reused, " << NumIncomplete
+                  << " incomplete");
+  }
+
+  /**
+   * Returns the facts reached at each exit of each method, by start point
+   * and by context: a context has the bit of the single input the method
+   * has been tabulated for set, or no bit for the zero value.
+   */
+  IFDSSummaryPool<D, N> &getSummaryPool() { return SummaryPool; }
+
+  std::size_t getNumRuns() const { return NumRuns; }
+
+  std::size_t getNumReused() const { return NumReused; }
+};
+
+template <typename N, typename D, typename M, typename I>
+using IFDSBottomUpSummaryGenerator =
+    BottomUpSummaryGenerator<N, D, M, I, IFDSTabulationProblem<N, D, M, I>,
+                             IFDSSolver<N, D, M, I>>;
+
+template <typename N, typename D, typename M, typename V, typename I>
+using IDEBottomUpSummaryGenerator =
+    BottomUpSummaryGenerator<N, D, M, I, IDETabulationProblem<N, D, M, V, I>,
+                             IDESolver<N, D, M, V, I>>;
+
+} // namespace psr
+
+#endif
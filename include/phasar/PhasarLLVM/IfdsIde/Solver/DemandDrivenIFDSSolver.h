@@ -0,0 +1,194 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_DEMANDDRIVENIFDSSOLVER_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_DEMANDDRIVENIFDSSOLVER_H_
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
+
+namespace psr {
+
+/**
+ * Answers queries of the form "does fact d hold at node n". A query first
+ * determines the nodes from which n can be reached in the interprocedural
+ * control-flow graph by a backward search: only path edges that lead to
+ * these nodes can contribute to the answer. Path edges to all other nodes
+ * are deferred rather than processed. The forward tabulation from the
+ * initial seeds then stops as soon as the queried fact is reached.
+ *
+ * The relevant nodes are a backward slice of the control-flow graph only,
+ * the facts are not taken into account. Since the callees on the way to n
+ * are relevant as a whole, most of the super-graph is still relevant for
+ * typical queries. The savings come mostly from stopping early and from
+ * skipping the code after n.
+ *
+ * All path edges, deferred edges and pending worklist entries are kept
+ * between queries, hence later queries continue where earlier ones stopped
+ * and only explore the parts of the super-graph that have not been relevant
+ * before. The answers are the same as the ones of a full IFDSSolver run.
+ *
+ * Queries are answered on a single thread; solve() tabulates everything that
+ * is left, as the IFDSSolver does.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problem.
+ * @param <M> The type of objects used to represent methods.
+ * @param <I> The type of inter-procedural control-flow graph being used.
+ */
+template <typename N, typename D, typename M, typename I>
+class DemandDrivenIFDSSolver : public IFDSSolver<N, D, M, I> {
+public:
+  DemandDrivenIFDSSolver(IFDSTabulationProblem<N, D, M, I> &ifdsProblem)
+      // a query processes path edges on the calling thread
+      : IFDSSolver<N, D, M, I>(
+            ifdsProblem, IFDSSolver<N, D, M, I>::singleThreaded(
+                             ifdsProblem.solver_config)) {}
+
+  ~DemandDrivenIFDSSolver() override = default;
+
+  /**
+   * Returns true if the fact d holds at node n.
+   */
+  bool query(N n, D d) {
+    PAMM_GET_INSTANCE;
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Query: <" << this->ideTabulationProblem.NtoString(n)
+                  << ", " << this->ideTabulationProblem.DtoString(d) << ">");
+    prepareQuery(n);
+    INC_COUNTER("Demand Queries", 1, PAMM_SEVERITY_LEVEL::Core);
+    while (!this->pathEdges.reaches(n, d) && !this->WorkList.empty()) {
+      this->pathEdgeProcessingTask(this->WorkList.pop());
+    }
+    return this->pathEdges.reaches(n, d);
+  }
+
+  /**
+   * Returns all facts that hold at node n.
+   */
+  std::set<D> queryFactsAt(N n) {
+    PAMM_GET_INSTANCE;
+    prepareQuery(n);
+    INC_COUNTER("Demand Queries", 1, PAMM_SEVERITY_LEVEL::Core);
+    while (!this->WorkList.empty()) {
+      this->pathEdgeProcessingTask(this->WorkList.pop());
+    }
+    std::vector<D> facts = this->pathEdges.targetValsAt(n);
+    return std::set<D>(facts.begin(), facts.end());
+  }
+
+  /**
+   * Tabulates the whole exploded super-graph, including everything that has
+   * been deferred by previous queries.
+   */
+  void solve() override {
+    allRelevant = true;
+    for (auto &targetAndEdges : deferred) {
+      for (auto &edge : targetAndEdges.second) {
+        IFDSSolver<N, D, M, I>::propagate(edge.first, targetAndEdges.first,
+                                          edge.second);
+      }
+    }
+    deferred.clear();
+    IFDSSolver<N, D, M, I>::solve();
+  }
+
+protected:
+  // nodes from which one of the queried nodes can be reached
+  std::unordered_set<N> relevant;
+
+  // set once the whole super-graph is tabulated
+  bool allRelevant = false;
+
+  bool seeded = false;
+
+  // path edges to nodes that have not been relevant so far, by target node:
+  // pairs of source value and target value, which are derived again and
+  // again and therefore kept as a set
+  std::unordered_map<N, std::set<std::pair<D, D>>> deferred;
+
+  void propagate(D sourceVal, N target, D targetVal) override {
+    if (!allRelevant && !relevant.count(target)) {
+      deferred[target].emplace(sourceVal, targetVal);
+      return;
+    }
+    IFDSSolver<N, D, M, I>::propagate(sourceVal, target, targetVal);
+  }
+
+  // the pending path edges are only known to the worklist
+  bool evictsFinishedProcedures() override { return false; }
+
+  void prepareQuery(N n) {
+    if (!allRelevant) {
+      addRelevantNodes(n);
+    }
+    if (!seeded) {
+      PAMM_GET_INSTANCE;
+      this->registerCounters();
+      REG_COUNTER("Demand Queries", 0, PAMM_SEVERITY_LEVEL::Core);
+      seeded = true;
+      this->seedPathEdges();
+    }
+  }
+
+  /**
+   * Marks all nodes as relevant from which n can be reached and processes
+   * the path edges that have been deferred at them.
+   */
+  void addRelevantNodes(N n) {
+    std::vector<N> worklist;
+    auto visit = [&](N node) {
+      if (relevant.insert(node).second) {
+        worklist.push_back(node);
+      }
+    };
+    visit(n);
+    while (!worklist.empty()) {
+      N node = worklist.back();
+      worklist.pop_back();
+      for (N pred : getPredsOfRef(this->icfg, node)) {
+        visit(pred);
+        // facts reach a return site from the exits of the callees
+        if (this->icfg.isCallStmt(pred)) {
+          for (M callee : this->icfg.getCalleesOfCallAt(pred)) {
+            for (N exit : this->icfg.getExitPointsOf(callee)) {
+              visit(exit);
+            }
+          }
+        }
+      }
+      // facts reach a start point from the call sites of its method
+      if (this->icfg.isStartPoint(node)) {
+        for (N callSite :
+             this->icfg.getCallersOf(this->icfg.getMethodOf(node))) {
+          visit(callSite);
+        }
+      }
+      auto search = deferred.find(node);
+      if (search != deferred.end()) {
+        std::set<std::pair<D, D>> edges = std::move(search->second);
+        deferred.erase(search);
+        for (auto &edge : edges) {
+          IFDSSolver<N, D, M, I>::propagate(edge.first, node, edge.second);
+        }
+      }
+    }
+  }
+};
+
+} // namespace psr
+
+#endif
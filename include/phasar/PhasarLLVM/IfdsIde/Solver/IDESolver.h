@@ -17,24 +17,42 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IDESOLVER_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IDESOLVER_H_
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
 #include <set>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <curl/curl.h>
 #include <json.hpp>
 
 #include <boost/algorithm/string/trim.hpp>
 
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/Module.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include <phasar/Config/ContainerConfiguration.h>
+#include <phasar/PhasarLLVM/ControlFlow/CFG.h>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionInterner.h>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions.h>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/EdgeIdentity.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowEdgeFunctionCache.h>
@@ -46,12 +64,25 @@
 #include <phasar/PhasarLLVM/IfdsIde/Solver/JumpFunctions.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/LinkedNode.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdge.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdgeWorklist.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/SolverResults.h>
+#include <phasar/PhasarLLVM/IfdsIde/SummaryStore.h>
 #include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
 
+#include <phasar/Utils/ColumnarTable.h>
+#include <phasar/Utils/DenseTable.h>
+#include <phasar/Utils/FlatIdMap.h>
+#include <phasar/Utils/Interner.h>
 #include <phasar/Utils/LLVMShorthands.h>
+#include <phasar/Utils/HashedTuple.h>
+#include <phasar/Utils/JsonStreamWriter.h>
 #include <phasar/Utils/Logger.h>
 #include <phasar/Utils/PAMMMacros.h>
+#include <phasar/Utils/ProgressStream.h>
+#include <phasar/Utils/ResourceBudget.h>
+#include <phasar/Utils/SpillFile.h>
 #include <phasar/Utils/Table.h>
+#include <phasar/Utils/WorkStealingScheduler.h>
 
 namespace psr {
 
@@ -76,21 +107,47 @@ template <typename N, typename D, typename M, typename V, typename I>
 class IDESolver {
 public:
   IDESolver(IDETabulationProblem<N, D, M, V, I> &tabulationProblem)
+      : IDESolver(tabulationProblem, tabulationProblem.solver_config) {}
+
+  /**
+   * Solves tabulationProblem with the given configuration instead of the
+   * problem's own one.
+   */
+  IDESolver(IDETabulationProblem<N, D, M, V, I> &tabulationProblem,
+            const SolverConfiguration &config)
       : ideTabulationProblem(tabulationProblem),
         zeroValue(tabulationProblem.zeroValue()),
         icfg(tabulationProblem.interproceduralCFG()),
-        computevalues(tabulationProblem.solver_config.computeValues),
-        autoAddZero(tabulationProblem.solver_config.autoAddZero),
-        followReturnPastSeeds(
-            tabulationProblem.solver_config.followReturnsPastSeeds),
-        computePersistedSummaries(
-            tabulationProblem.solver_config.computePersistedSummaries),
-        recordEdges(tabulationProblem.solver_config.recordEdges),
-        PathEdgeCount(0), cachedFlowEdgeFunctions(tabulationProblem),
-        allTop(tabulationProblem.allTopFunction()),
+        computevalues(config.computeValues),
+        autoAddZero(config.autoAddZero),
+        followReturnPastSeeds(config.followReturnsPastSeeds),
+        computePersistedSummaries(config.computePersistedSummaries),
+        recordEdges(config.recordEdges),
+        NumThreads(ideTabulationProblem.dependsOnProcessingOrder()
+                       ? 1
+                       : config.numThreads),
+        internEdgeFunctions(config.internEdgeFunctions),
+        evictFinishedProcedures(config.evictFinishedProcedures),
+        evictionDelay(config.evictionDelay),
+        recordedEdgesMemoryBudget(config.recordedEdgesMemoryBudget),
+        compactResults(config.compactResults),
+        PathEdgeCount(0),
+        budget(std::chrono::milliseconds(config.timeBudget),
+               config.pathEdgeBudget, config.memoryBudget),
+        WorkList(icfg, config.worklistPolicy),
+        ParallelWorkList(NumThreads),
+        cachedFlowEdgeFunctions(tabulationProblem), nodeIds(NumThreads > 1),
+        factIds(NumThreads > 1), computedIntraPathEdges(nodeIds, nodeIds),
+        computedInterPathEdges(nodeIds, nodeIds),
+        allTop(internEdgeFunction(tabulationProblem.allTopFunction())),
         jumpFn(std::make_shared<JumpFunctions<N, D, M, V, I>>(
-            allTop, ideTabulationProblem)),
-        initialSeeds(tabulationProblem.initialSeeds()) {
+            allTop, ideTabulationProblem, nodeIds, factIds, NumThreads,
+            internEdgeFunctions ? &edgeFunctionInterner : nullptr)),
+        endsummarytab(nodeIds, factIds), incomingtab(nodeIds, factIds),
+        initialSeeds(tabulationProblem.initialSeeds()),
+        valtab(nodeIds, factIds) {
+    initSummaryStore(config);
+    initProgressStream(config);
     // std::cout << "called IDESolver::IDESolver() ctor with IDEProblem"
     //           << std::endl;
   }
@@ -100,31 +157,23 @@ public:
   json getAsJson() {
     const static std::string DataFlowID = "DataFlow";
     json J;
-    auto results = this->valtab.cellSet();
-    if (results.empty()) {
+    forEachResult([&](N n, D d, const V &v) {
+      std::string stmt = ideTabulationProblem.NtoString(n);
+      boost::algorithm::trim(stmt);
+      std::string node = icfg.getMethodName(icfg.getMethodOf(n)) + "::" + stmt;
+      std::string fact = ideTabulationProblem.DtoString(d);
+      boost::algorithm::trim(fact);
+      std::string value = ideTabulationProblem.VtoString(v);
+      boost::algorithm::trim(value);
+      J[DataFlowID][node]["Facts"] += {fact, value};
+    });
+    if (J.empty()) {
       J[DataFlowID] = "EMPTY";
-    } else {
-      std::vector<typename Table<N, D, V>::Cell> cells;
-      for (auto cell : results) {
-        cells.push_back(cell);
-      }
-      sort(cells.begin(), cells.end(),
-           [](typename Table<N, D, V>::Cell a,
-              typename Table<N, D, V>::Cell b) { return a.r < b.r; });
-      N curr;
-      for (unsigned i = 0; i < cells.size(); ++i) {
-        curr = cells[i].r;
-        std::string n = ideTabulationProblem.NtoString(cells[i].r);
-        boost::algorithm::trim(n);
-        std::string node =
-            icfg.getMethodName(icfg.getMethodOf(curr)) + "::" + n;
-        J[DataFlowID][node];
-        std::string fact = ideTabulationProblem.DtoString(cells[i].c);
-        boost::algorithm::trim(fact);
-        std::string value = ideTabulationProblem.VtoString(cells[i].v);
-        boost::algorithm::trim(value);
-        J[DataFlowID][node]["Facts"] += {fact, value};
-      }
+    }
+    if (!isComplete()) {
+      J["Incomplete"] = true;
+      J["ExceededBudget"] =
+          std::string(wise_enum::to_string(budget.getExceeded()));
     }
     return J;
   }
@@ -311,28 +360,18 @@ public:
    */
   virtual void solve() {
     PAMM_GET_INSTANCE;
-    REG_COUNTER("Gen facts", 0, PAMM_SEVERITY_LEVEL::Core);
-    REG_COUNTER("Kill facts", 0, PAMM_SEVERITY_LEVEL::Core);
-    REG_COUNTER("Summary-reuse", 0, PAMM_SEVERITY_LEVEL::Core);
-    REG_COUNTER("Intra Path Edges", 0, PAMM_SEVERITY_LEVEL::Core);
-    REG_COUNTER("Inter Path Edges", 0, PAMM_SEVERITY_LEVEL::Core);
-    REG_COUNTER("FF Queries", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("EF Queries", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("Value Propagation", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("Value Computation", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("SpecialSummary-FF Application", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("SpecialSummary-EF Queries", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("JumpFn Construction", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("Process Call", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("Process Normal", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("Process Exit", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_COUNTER("[Calls] getPointsToSet", 0, PAMM_SEVERITY_LEVEL::Full);
-    REG_HISTOGRAM("Data-flow facts", PAMM_SEVERITY_LEVEL::Full);
-    REG_HISTOGRAM("Points-to", PAMM_SEVERITY_LEVEL::Full);
-
+    registerCounters();
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                   << "IDE solver is solving the specified problem");
+    startClock();
+    if (summaryStore && !reusesPersistedSummaries()) {
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                    << "Summaries are persisted but not reused, since "
+                    << (ideTabulationProblem.hasFlowFunctionSideEffects()
+                            ? "the flow functions have side effects"
+                            : "values are computed"));
+    }
     // computations starting here
     START_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
     // We start our analysis and construct exploded supergraph
@@ -340,6 +379,7 @@ public:
                   << "Submit initial seeds, construct exploded super graph");
     submitInitalSeeds();
     STOP_TIMER("DFA Phase I", PAMM_SEVERITY_LEVEL::Full);
+    finishTabulation();
     if (computevalues) {
       START_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
       // Computing the final values for the edge functions
@@ -348,18 +388,115 @@ public:
           << "Compute the final values according to the edge functions");
       computeValues();
       STOP_TIMER("DFA Phase II", PAMM_SEVERITY_LEVEL::Full);
+      if (compactResults) {
+        compactResultTable();
+      }
     }
+    restoreSpilledEdges();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Problem solved");
     if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Core) {
       computeAndPrintStatistics();
     }
   }
 
+  /**
+   * Streams the same document as getAsJson() to Writer. Like there, the
+   * nodes are ordered by their keys, nodes that print the same share a key
+   * and the facts of a key are ordered by node and by fact. Only the keys of
+   * a single method and the results at a single node are held in memory at a
+   * time.
+   */
+  void writeJson(JsonStreamWriter &Writer) {
+    const static std::string DataFlowID = "DataFlow";
+    // all keys of a method start with its name and "::", which does not occur
+    // in method names, hence ordering the methods by this prefix keeps the
+    // keys of different methods in order
+    std::map<std::string, M> methods;
+    auto addMethodOf = [&](N n) {
+      M m = icfg.getMethodOf(n);
+      methods.emplace(icfg.getMethodName(m) + "::", m);
+    };
+    if (resultsCompacted) {
+      for (N n : compactValtab.rowKeys()) {
+        addMethodOf(n);
+      }
+    } else {
+      valtab.forEachRow([&](N n, const auto &) { addMethodOf(n); });
+    }
+    Writer.beginObject();
+    Writer.key(DataFlowID);
+    if (methods.empty()) {
+      Writer.value("EMPTY");
+    } else {
+      Writer.beginObject();
+      std::map<std::string, std::vector<N>> nodesByKey;
+      std::vector<std::pair<D, V>> results;
+      for (auto &method : methods) {
+        nodesByKey.clear();
+        for (N n : icfg.getAllInstructionsOf(method.second)) {
+          if (resultsCompacted ? compactValtab.containsRow(n)
+                               : valtab.containsRow(n)) {
+            std::string stmt = ideTabulationProblem.NtoString(n);
+            boost::algorithm::trim(stmt);
+            nodesByKey[method.first + stmt].push_back(n);
+          }
+        }
+        for (auto &keyAndNodes : nodesByKey) {
+          std::sort(keyAndNodes.second.begin(), keyAndNodes.second.end());
+          Writer.key(keyAndNodes.first);
+          Writer.beginObject();
+          Writer.key("Facts");
+          Writer.beginArray();
+          for (N n : keyAndNodes.second) {
+            auto row = resultsAt(n);
+            results.assign(row.begin(), row.end());
+            std::sort(results.begin(), results.end(),
+                      [](const std::pair<D, V> &lhs,
+                         const std::pair<D, V> &rhs) {
+                        return lhs.first < rhs.first;
+                      });
+            for (auto &result : results) {
+              std::string fact = ideTabulationProblem.DtoString(result.first);
+              boost::algorithm::trim(fact);
+              std::string value =
+                  ideTabulationProblem.VtoString(result.second);
+              boost::algorithm::trim(value);
+              Writer.value({fact, value});
+            }
+          }
+          Writer.endArray();
+          Writer.endObject();
+        }
+      }
+      Writer.endObject();
+    }
+    // in the order of the keys of getAsJson()
+    if (!isComplete()) {
+      Writer.key("ExceededBudget");
+      Writer.value(std::string(wise_enum::to_string(budget.getExceeded())));
+      Writer.key("Incomplete");
+      Writer.value(true);
+    }
+    Writer.endObject();
+  }
+
+  /**
+   * Returns false if solving has been stopped because a budget has been
+   * exceeded. The results then only cover the part of the exploded
+   * super-graph that has been constructed so far.
+   */
+  bool isComplete() const { return budget.getExceeded() == BudgetKind::None; }
+
+  BudgetKind getExceededBudget() const { return budget.getExceeded(); }
+
   /**
    * Returns the V-type result for the given value at the given statement.
    * TOP values are never returned.
    */
-  virtual V resultAt(N stmt, D value) { return valtab.get(stmt, value); }
+  virtual V resultAt(N stmt, D value) {
+    return resultsCompacted ? compactValtab.get(stmt, value)
+                            : valtab.get(stmt, value);
+  }
 
   /**
    * Returns the resulting environment for the given statement.
@@ -367,7 +504,8 @@ public:
    * TOP values are never returned.
    */
   virtual std::unordered_map<D, V> resultsAt(N stmt, bool stripZero = false) {
-    std::unordered_map<D, V> result = valtab.row(stmt);
+    std::unordered_map<D, V> result =
+        resultsCompacted ? compactValtab.row(stmt) : valtab.row(stmt);
     if (stripZero) {
       for (auto it = result.begin(); it != result.end();) {
         if (ideTabulationProblem.isZeroValue(it->first)) {
@@ -380,6 +518,57 @@ public:
     return result;
   }
 
+  /**
+   * Calls Handler(n, d, v) for every value v of a fact d at a node n, sorted
+   * by node and by fact.
+   */
+  template <typename HandlerT> void forEachResult(HandlerT Handler) {
+    if (resultsCompacted) {
+      compactValtab.forEach(Handler);
+      return;
+    }
+    using RowType = typename DenseTable<N, D, V>::RowType;
+    std::vector<std::pair<N, const RowType *>> rows;
+    valtab.forEachRow(
+        [&rows](N n, const RowType &row) { rows.emplace_back(n, &row); });
+    std::sort(rows.begin(), rows.end(),
+              [](const std::pair<N, const RowType *> &lhs,
+                 const std::pair<N, const RowType *> &rhs) {
+                return lhs.first < rhs.first;
+              });
+    std::vector<std::pair<D, const V *>> cells;
+    for (auto &row : rows) {
+      cells.clear();
+      for (auto &cell : *row.second) {
+        cells.emplace_back(factIds.get(cell.first), &cell.second);
+      }
+      std::sort(cells.begin(), cells.end(),
+                [](const std::pair<D, const V *> &lhs,
+                   const std::pair<D, const V *> &rhs) {
+                  return lhs.first < rhs.first;
+                });
+      for (auto &cell : cells) {
+        Handler(row.first, cell.first, *cell.second);
+      }
+    }
+  }
+
+  /**
+   * Returns the results in the form the problems' reports expect.
+   */
+  SolverResults<N, D, V> getSolverResults() {
+    return resultsCompacted ? SolverResults<N, D, V>(compactValtab, zeroValue)
+                            : SolverResults<N, D, V>(valtab, zeroValue);
+  }
+
+  /**
+   * Returns the compacted results, which are empty unless compactResults
+   * is configured. They can be saved to a file by ColumnarTable::save().
+   */
+  const ColumnarTable<N, D, V> &getCompactResults() const {
+    return compactValtab;
+  }
+
 protected:
   // have a shared point to allow for a copy constructor of IDESolver
   std::shared_ptr<IFDSToIDETabulationProblem<N, D, M, I>> transformedProblem;
@@ -437,7 +626,7 @@ protected:
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "Found and process special summary");
         for (N returnSiteN : returnSiteNs) {
-          std::set<D> res = computeSummaryFlowFunction(specialSum, d1, d2);
+          FFSet<D> res = computeSummaryFlowFunction(specialSum, d1, d2);
           INC_COUNTER("SpecialSummary-FF Application", 1,
                       PAMM_SEVERITY_LEVEL::Full);
           ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
@@ -453,7 +642,8 @@ protected:
                           << "Compose: " << sumEdgFnE->str() << " * "
                           << f->str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-            propagate(d1, returnSiteN, d3, f->composeWith(sumEdgFnE), n, false);
+            propagate(d1, returnSiteN, d3, composeEdgeFunctions(f, sumEdgFnE),
+                      n, false);
           }
         }
       } else {
@@ -461,7 +651,7 @@ protected:
         std::shared_ptr<FlowFunction<D>> function =
             cachedFlowEdgeFunctions.getCallFlowFunction(n, sCalledProcN);
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-        std::set<D> res = computeCallFlowFunction(function, d1, d2);
+        FFSet<D> res = computeCallFlowFunction(function, d1, d2);
         ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
                          PAMM_SEVERITY_LEVEL::Full);
         // for each callee's start point(s)
@@ -472,24 +662,35 @@ protected:
                                icfg.getMethodName(sCalledProcN) +
                                "' currently not available!");
         }
+        // the callee's summaries and incoming edges are updated below
+        restoreProcedure(sCalledProcN);
         // if startPointsOf is empty, the called function is a declaration
         for (N sP : startPointsOf) {
           saveEdges(n, sP, d2, res, true);
           // for each result node of the call-flow function
           for (D d3 : res) {
-            // create initial self-loop
-            propagate(d3, sP, d3, EdgeIdentity<V>::getInstance(), n,
-                      false); // line 15
-            // register the fact that <sp,d3> has an incoming edge from <n,d2>
-            // line 15.1 of Naeem/Lhotak/Rodriguez
-            addIncoming(sP, d3, n, d2);
-            // line 15.2, copy to avoid concurrent modification exceptions by
-            // other threads
+            // create initial self-loop, unless the callee's summaries for d3
+            // are known from a previous analysis run
+            if (!reusePersistedSummary(sCalledProcN, sP, d3)) {
+              propagate(d3, sP, d3, EdgeIdentity<V>::getInstance(), n,
+                        false); // line 15
+            }
             std::set<
                 typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>
-                endSumm = std::set<typename Table<
-                    N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>(
-                    endSummary(sP, d3));
+                endSumm;
+            {
+              // registering the incoming edge and querying the end summaries
+              // must not interleave with processExit(), otherwise a summary
+              // that is registered concurrently could be missed by both
+              std::lock_guard<std::mutex> Lock(SummaryMutex);
+              // register the fact that <sp,d3> has an incoming edge from
+              // <n,d2>
+              // line 15.1 of Naeem/Lhotak/Rodriguez
+              addIncoming(sP, d3, n, d2);
+              // line 15.2, copy to avoid concurrent modification exceptions
+              // by other threads
+              endSumm = endSummary(sP, d3);
+            }
             // std::cout << "ENDSUMM" << std::endl;
             // std::cout << "Size: " << endSumm.size() << std::endl;
             // std::cout << "sP: " << ideTabulationProblem.NtoString(sP)
@@ -514,7 +715,7 @@ protected:
                     cachedFlowEdgeFunctions.getRetFlowFunction(n, sCalledProcN,
                                                                eP, retSiteN);
                 INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-                std::set<D> returnedFacts = computeReturnFlowFunction(
+                FFSet<D> returnedFacts = computeReturnFlowFunction(
                     retFunction, d3, d4, n, std::set<D>{d2});
                 ADD_TO_HISTOGRAM("Data-flow facts", returnedFacts.size(), 1,
                                  PAMM_SEVERITY_LEVEL::Full);
@@ -538,7 +739,8 @@ protected:
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                                 << "         (return * calleeSummary * call)");
                   std::shared_ptr<EdgeFunction<V>> fPrime =
-                      f4->composeWith(fCalleeSummary)->composeWith(f5);
+                      composeEdgeFunctions(
+                          composeEdgeFunctions(f4, fCalleeSummary), f5);
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                                 << "       = " << fPrime->str());
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
@@ -549,7 +751,7 @@ protected:
                                 << f->str());
                   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
                   propagate(d1, retSiteN, d5_restoredCtx,
-                            f->composeWith(fPrime), n, false);
+                            composeEdgeFunctions(f, fPrime), n, false);
                 }
               }
             }
@@ -563,7 +765,7 @@ protected:
             cachedFlowEdgeFunctions.getCallToRetFlowFunction(n, returnSiteN,
                                                              callees);
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-        std::set<D> returnFacts =
+        FFSet<D> returnFacts =
             computeCallToReturnFlowFunction(callToReturnFlowFunction, d1, d2);
         ADD_TO_HISTOGRAM("Data-flow facts", returnFacts.size(), 1,
                          PAMM_SEVERITY_LEVEL::Full);
@@ -576,7 +778,8 @@ protected:
           LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                         << "Compose: " << edgeFnE->str() << " * " << f->str());
           LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-          propagate(d1, returnSiteN, d3, f->composeWith(edgeFnE), n, false);
+          propagate(d1, returnSiteN, d3, composeEdgeFunctions(f, edgeFnE), n,
+                    false);
         }
       }
     }
@@ -598,19 +801,19 @@ protected:
     N n = edge.getTarget();
     D d2 = edge.factAtTarget();
     std::shared_ptr<EdgeFunction<V>> f = jumpFunction(edge);
-    auto successorInst = icfg.getSuccsOf(n);
+    auto successorInst = getSuccsOfRef(icfg, n);
     for (auto m : successorInst) {
       std::shared_ptr<FlowFunction<D>> flowFunction =
           cachedFlowEdgeFunctions.getNormalFlowFunction(n, m);
       INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-      std::set<D> res = computeNormalFlowFunction(flowFunction, d1, d2);
+      FFSet<D> res = computeNormalFlowFunction(flowFunction, d1, d2);
       ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
                        PAMM_SEVERITY_LEVEL::Full);
       saveEdges(n, m, d2, res, false);
       for (D d3 : res) {
         std::shared_ptr<EdgeFunction<V>> g =
             cachedFlowEdgeFunctions.getNormalEdgeFunction(n, d2, m, d3);
-        std::shared_ptr<EdgeFunction<V>> fprime = f->composeWith(g);
+        std::shared_ptr<EdgeFunction<V>> fprime = composeEdgeFunctions(f, g);
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "Compose: " << g->str() << " * " << f->str());
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
@@ -625,7 +828,7 @@ protected:
     D d = nAndD.second;
     M p = icfg.getMethodOf(n);
     for (N c : icfg.getCallsFromWithin(p)) {
-      for (auto entry : jumpFn->forwardLookup(d, c)) {
+      for (auto entry : jumpFn->forwardLookupView(d, c)) {
         D dPrime = entry.first;
         std::shared_ptr<EdgeFunction<V>> fPrime = entry.second;
         N sP = n;
@@ -643,7 +846,7 @@ protected:
       std::shared_ptr<FlowFunction<D>> callFlowFunction =
           cachedFlowEdgeFunctions.getCallFlowFunction(n, q);
       INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-      for (D dPrime : callFlowFunction->computeTargets(d)) {
+      for (D dPrime : applyFlowFunction(*callFlowFunction, d)) {
         std::shared_ptr<EdgeFunction<V>> edgeFn =
             cachedFlowEdgeFunctions.getCallEdgeFunction(n, d, q, dPrime);
         INC_COUNTER("EF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
@@ -660,27 +863,41 @@ protected:
     V vPrime = joinValueAt(nHashN, nHashD, valNHash, v);
     if (!(vPrime == valNHash)) {
       setVal(nHashN, nHashD, vPrime);
-      valuePropagationTask(std::pair<N, D>(nHashN, nHashD));
+      ValuePropagationWorkList.emplace_back(nHashN, nHashD);
+    }
+  }
+
+  /**
+   * Propagates the values of all pending (node, fact) pairs until no value
+   * changes anymore.
+   */
+  void processValuePropagationWorkList() {
+    while (!ValuePropagationWorkList.empty()) {
+      std::pair<N, D> nAndD = ValuePropagationWorkList.front();
+      ValuePropagationWorkList.pop_front();
+      valuePropagationTask(nAndD);
     }
   }
 
   V val(N nHashN, D nHashD) {
-    if (valtab.contains(nHashN, nHashD)) {
-      return valtab.get(nHashN, nHashD);
+    if (V *value = valtab.find(nHashN, nHashD)) {
+      return *value;
     } else {
       // implicitly initialized to top; see line [1] of Fig. 7 in SRH96 paper
       return ideTabulationProblem.topElement();
     }
   }
 
-  void setVal(N nHashN, D nHashD, V l) {
+  void setVal(N nHashN, D nHashD, V l) { setVal(valtab, nHashN, nHashD, l); }
+
+  void setVal(DenseTable<N, D, V> &values, N nHashN, D nHashD, V l) {
     auto &lg = lg::get();
     // TOP is the implicit default value which we do not need to store.
     if (l == ideTabulationProblem.topElement()) {
       // do not store top values
-      valtab.remove(nHashN, nHashD);
+      values.remove(nHashN, nHashD);
     } else {
-      valtab.insert(nHashN, nHashD, l);
+      values.insert(nHashN, nHashD, l);
     }
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "Function : "
@@ -694,6 +911,22 @@ protected:
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
   }
 
+  std::shared_ptr<EdgeFunction<V>>
+  internEdgeFunction(std::shared_ptr<EdgeFunction<V>> f) {
+    return internEdgeFunctions ? edgeFunctionInterner.intern(f) : f;
+  }
+
+  /**
+   * Returns f->composeWith(g), which is memoized if internEdgeFunctions is
+   * set.
+   */
+  std::shared_ptr<EdgeFunction<V>>
+  composeEdgeFunctions(std::shared_ptr<EdgeFunction<V>> f,
+                       std::shared_ptr<EdgeFunction<V>> g) {
+    return internEdgeFunctions ? edgeFunctionInterner.compose(f, g)
+                               : f->composeWith(g);
+  }
+
   std::shared_ptr<EdgeFunction<V>> jumpFunction(PathEdge<N, D> edge) {
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
@@ -707,16 +940,15 @@ protected:
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "   Target D: "
                   << ideTabulationProblem.DtoString(edge.factAtTarget()));
-    if (!jumpFn->forwardLookup(edge.factAtSource(), edge.getTarget())
-             .count(edge.factAtTarget())) {
+    auto res = jumpFn->findFunction(edge.factAtSource(), edge.getTarget(),
+                                    edge.factAtTarget());
+    if (!res) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "  => EdgeFn: " << allTop->str());
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
       // JumpFn initialized to all-top, see line [2] in SRH96 paper
       return allTop;
     }
-    auto res = jumpFn->forwardLookup(edge.factAtSource(),
-                                     edge.getTarget())[edge.factAtTarget()];
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "  => EdgeFn: " << res->str());
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << " ");
     return res;
@@ -727,7 +959,12 @@ protected:
     // note: at this point we don't need to join with a potential previous f
     // because f is a jump function, which is already properly joined
     // within propagate(..)
-    endsummarytab.get(sP, d1).insert(eP, d2, f);
+    auto summary = endsummarytab.get(sP, d1).tryEmplace(
+        combineIds(nodeIds.getOrInsert(eP), factIds.getOrInsert(d2)));
+    if (summary.second) {
+      ++NumEndSummaries;
+    }
+    *summary.first = f;
   }
 
   // should be made a callable at some point
@@ -735,6 +972,9 @@ protected:
     PAMM_GET_INSTANCE;
     auto &lg = lg::get();
     INC_COUNTER("JumpFn Construction", 1, PAMM_SEVERITY_LEVEL::Full);
+    if (progressStream) {
+      reportProgress(edge);
+    }
     LOG_IF_ENABLE(
         BOOST_LOG_SEV(lg, DEBUG)
         << "-------------------------------------------- " << PathEdgeCount
@@ -760,7 +1000,7 @@ protected:
       if (icfg.isExitStmt(edge.getTarget())) {
         processExit(edge);
       }
-      if (!icfg.getSuccsOf(edge.getTarget()).empty()) {
+      if (!getSuccsOfRef(icfg, edge.getTarget()).empty()) {
         processNormalFlow(edge);
       }
     } else {
@@ -785,27 +1025,101 @@ protected:
 
   // should be made a callable at some point
   void valueComputationTask(std::vector<N> values) {
+    valueComputationTask(values, valtab);
+  }
+
+  /**
+   * Computes the values of the given nodes, which must neither be call nor
+   * start nodes, and records them in results. The values at the start points
+   * are read from valtab.
+   */
+  void valueComputationTask(const std::vector<N> &values,
+                            DenseTable<N, D, V> &results) {
     PAMM_GET_INSTANCE;
     for (N n : values) {
+      // the jump functions do not depend on the start point, so look them up
+      // only once per node
+      auto lookupByTarget = jumpFn->lookupByTargetView(n);
       for (N sP : icfg.getStartPointsOf(icfg.getMethodOf(n))) {
-        Table<D, D, std::shared_ptr<EdgeFunction<V>>> lookupByTarget;
-        lookupByTarget = jumpFn->lookupByTarget(n);
-        for (typename Table<D, D, std::shared_ptr<EdgeFunction<V>>>::Cell
-                 sourceValTargetValAndFunction : lookupByTarget.cellSet()) {
-          D dPrime = sourceValTargetValAndFunction.getRowKey();
-          D d = sourceValTargetValAndFunction.getColumnKey();
-          std::shared_ptr<EdgeFunction<V>> fPrime =
-              sourceValTargetValAndFunction.getValue();
+        for (auto sourceValAndRow : lookupByTarget) {
+          D dPrime = sourceValAndRow.first;
           V targetVal = val(sP, dPrime);
-          setVal(n, d,
-                 ideTabulationProblem.join(val(n, d),
-                                           fPrime->computeTarget(targetVal)));
-          INC_COUNTER("Value Computation", 1, PAMM_SEVERITY_LEVEL::Full);
+          for (auto targetValAndFunction : sourceValAndRow.second) {
+            D d = targetValAndFunction.first;
+            const std::shared_ptr<EdgeFunction<V>> &fPrime =
+                targetValAndFunction.second;
+            V *currentVal = results.find(n, d);
+            setVal(results, n, d,
+                   ideTabulationProblem.join(
+                       currentVal ? *currentVal
+                                  : ideTabulationProblem.topElement(),
+                       fPrime->computeTarget(targetVal)));
+            INC_COUNTER("Value Computation", 1, PAMM_SEVERITY_LEVEL::Full);
+          }
         }
       }
     }
   }
 
+  /**
+   * Phase II(ii) for the jump functions of evicted methods, which are read
+   * from ProcedureSpill. As values are joined, it does not matter that the
+   * jump functions in memory are processed separately.
+   */
+  void computeSpilledValues() {
+    PAMM_GET_INSTANCE;
+    forEachSpilledJumpFunction([&](N n, D dPrime, D d,
+                                   const std::shared_ptr<EdgeFunction<V>>
+                                       &fPrime) {
+      for (N sP : icfg.getStartPointsOf(icfg.getMethodOf(n))) {
+        V *currentVal = valtab.find(n, d);
+        setVal(n, d,
+               ideTabulationProblem.join(
+                   currentVal ? *currentVal : ideTabulationProblem.topElement(),
+                   fPrime->computeTarget(val(sP, dPrime))));
+        INC_COUNTER("Value Computation", 1, PAMM_SEVERITY_LEVEL::Full);
+      }
+    });
+  }
+
+  /**
+   * Phase II(ii) on multiple threads. The nodes are partitioned by the method
+   * they belong to. The partitions are independent of each other: the values
+   * of a node only depend on the values at the start points of its method,
+   * which have been fixed in Phase II(i) and are not part of any partition.
+   * Each partition writes into the rows of its own nodes, which are added to
+   * valtab before the threads start, such that valtab itself is not
+   * modified by the threads. Hence, the results are the same as the ones of
+   * the sequential computation.
+   */
+  void computeValuesInParallel(const std::set<N> &nodes) {
+    std::unordered_map<M, std::size_t> partitionOfMethod;
+    std::vector<std::vector<N>> partitions;
+    for (N n : nodes) {
+      auto search = partitionOfMethod.find(icfg.getMethodOf(n));
+      if (search == partitionOfMethod.end()) {
+        search = partitionOfMethod
+                     .insert(std::make_pair(icfg.getMethodOf(n),
+                                            partitions.size()))
+                     .first;
+        partitions.emplace_back();
+      }
+      partitions[search->second].push_back(n);
+    }
+    WorkStealingScheduler<std::size_t> pool(NumThreads);
+    for (std::size_t idx = 0; idx < partitions.size(); ++idx) {
+      // values may already have been set in Phase II(i), e.g. at unbalanced
+      // return sites, and are kept
+      for (N n : partitions[idx]) {
+        valtab.addRow(n);
+      }
+      pool.push(idx);
+    }
+    pool.run([&](std::size_t idx) {
+      valueComputationTask(partitions[idx], valtab);
+    });
+  }
+
 protected:
   D zeroValue;
   I icfg;
@@ -814,33 +1128,241 @@ protected:
   bool followReturnPastSeeds;
   bool computePersistedSummaries;
   bool recordEdges;
-  unsigned PathEdgeCount;
+  unsigned NumThreads;
+  bool internEdgeFunctions;
+  bool evictFinishedProcedures;
+  std::size_t evictionDelay;
+  std::size_t recordedEdgesMemoryBudget;
+  bool compactResults;
+  std::atomic<std::size_t> PathEdgeCount;
 
-  FlowEdgeFunctionCache<N, D, M, V, I> cachedFlowEdgeFunctions;
+  // limits phase I, see SolverConfiguration::timeBudget
+  ResourceBudget budget;
+
+  // path edges that have been discovered but not yet processed
+  PathEdgeWorklist<N, D, M, I> WorkList;
+
+  // replaces WorkList if phase I is run by multiple threads
+  WorkStealingScheduler<PathEdge<N, D>> ParallelWorkList;
 
-  Table<N, N, std::map<D, std::set<D>>> computedIntraPathEdges;
+  // (node, fact) pairs whose values have changed in Phase II, but have not
+  // been propagated yet
+  std::deque<std::pair<N, D>> ValuePropagationWorkList;
 
-  Table<N, N, std::map<D, std::set<D>>> computedInterPathEdges;
+  FlowEdgeFunctionCache<N, D, M, V, I> cachedFlowEdgeFunctions;
+
+  // dense IDs of the nodes and facts, which key the jump functions and the
+  // tables below; synchronized if the solver runs on multiple threads
+  Interner<N> nodeIds;
+  Interner<D> factIds;
+
+  // the facts reached at the sink from each fact at the source, by their
+  // IDs, of the edges recorded from a source node to a sink node
+  using RecordedFacts =
+      FlatIdMap<std::uint32_t, FlatIdSet<std::uint32_t>>;
+  using RecordedEdgeTable = DenseTable<N, N, RecordedFacts>;
+
+  RecordedEdgeTable computedIntraPathEdges;
+
+  RecordedEdgeTable computedInterPathEdges;
+
+  // guards computedIntraPathEdges and computedInterPathEdges
+  std::mutex RecordedEdgesMutex;
+
+  // an edge recorded in computedIntraPathEdges or computedInterPathEdges
+  struct RecordedEdge {
+    N SourceNode;
+    N SinkStmt;
+    D SourceVal;
+    D DestVal;
+    bool InterP;
+  };
+
+  // approximate size of the recorded edges that are currently held in memory
+  std::size_t RecordedEdgesBytes = 0;
+
+  // recorded edges that exceeded recordedEdgesMemoryBudget
+  std::unique_ptr<SpillFile> RecordedEdgesSpill;
+
+  // number of path edges that are pending in the worklist per method, only
+  // maintained if finished procedures are evicted
+  std::unordered_map<M, std::size_t> PendingEdgesPerMethod;
+
+  // nodes of each method whose jump functions may be evicted
+  std::unordered_map<M, std::vector<N>> EvictableNodes;
+
+  // a method that has run out of pending path edges after Stamp path edges
+  // have been processed; it is evicted once Deadline path edges have been
+  // processed, unless it has been re-entered in the meantime
+  struct FinishedProcedure {
+    std::size_t Deadline;
+    std::size_t Stamp;
+    M Method;
+
+    friend bool operator>(const FinishedProcedure &lhs,
+                          const FinishedProcedure &rhs) {
+      return lhs.Deadline > rhs.Deadline;
+    }
+  };
+
+  // finished methods ordered by their deadline
+  std::priority_queue<FinishedProcedure, std::vector<FinishedProcedure>,
+                      std::greater<FinishedProcedure>>
+      FinishedProcedures;
+
+  // the stamp of the latest FinishedProcedure of each method
+  std::unordered_map<M, std::size_t> FinishedAt;
+
+  // the number of path edges a method must stay finished before it is
+  // evicted, doubled each time it is re-entered after its eviction
+  std::unordered_map<M, std::size_t> EvictionDelays;
+
+  // the number of path edges processed while finished procedures are evicted
+  std::size_t NumProcessedEdges = 0;
+
+  // an entry of the tables of an evicted method
+  struct SpilledEntry {
+    enum class Kind : char { JumpFunction, EndSummary, Incoming, Context };
+    Kind kind;
+    // the target of a jump function, or the start point of an end summary,
+    // incoming edge or context
+    N Node;
+    D SourceVal;
+    // the exit of an end summary, or the call site of an incoming edge
+    N Target;
+    D TargetVal;
+    // the index of the edge function in SpilledEdgeFunctions
+    std::uint32_t EdgeFunction;
+  };
+
+  // the entries of an evicted method are the ones in the byte range
+  // [Begin, End) of ProcedureSpill
+  struct SpilledProcedure {
+    std::size_t Begin;
+    std::size_t End;
+    // set once the end summaries and incoming edges have been read back
+    bool SummariesRestored;
+  };
+
+  // entries that cannot be written to a file as raw bytes are not spilled,
+  // evicted jump functions are then dropped and re-derived
+  static constexpr bool SpillsProcedures =
+      std::is_trivially_copyable<SpilledEntry>::value;
+
+  // the tables of evicted methods
+  std::unique_ptr<SpillFile> ProcedureSpill;
+
+  std::unordered_map<M, SpilledProcedure> SpilledProcedures;
+
+  // edge functions are shared between many jump functions and summaries and
+  // cannot be written to a file, hence the spilled entries refer to them by
+  // their index in SpilledEdgeFunctions
+  std::vector<std::shared_ptr<EdgeFunction<V>>> SpilledEdgeFunctions;
+
+  std::unordered_map<const EdgeFunction<V> *, std::uint32_t>
+      SpilledEdgeFunctionIds;
+
+  // canonical edge functions and memoized compositions and joins, only used
+  // if internEdgeFunctions is set
+  EdgeFunctionInterner<V> edgeFunctionInterner;
 
   std::shared_ptr<EdgeFunction<V>> allTop;
 
   std::shared_ptr<JumpFunctions<N, D, M, V, I>> jumpFn;
 
   // stores summaries that were queried before they were computed
-  // see CC 2010 paper by Naeem, Lhotak and Rodriguez
-  Table<N, D, Table<N, D, std::shared_ptr<EdgeFunction<V>>>> endsummarytab;
+  // see CC 2010 paper by Naeem, Lhotak and Rodriguez; the summaries of a
+  // start point and fact map the exit and the fact there, packed by
+  // combineIds(), to the edge function
+  DenseTable<N, D, FlatIdMap<std::uint64_t, std::shared_ptr<EdgeFunction<V>>>>
+      endsummarytab;
 
   // edges going along calls
-  // see CC 2010 paper by Naeem, Lhotak and Rodriguez
-  Table<N, D, std::map<N, std::set<D>>> incomingtab;
+  // see CC 2010 paper by Naeem, Lhotak and Rodriguez; the call sites and the
+  // facts there are packed by combineIds()
+  DenseTable<N, D, FlatIdSet<std::uint64_t>> incomingtab;
+
+  // guards endsummarytab, incomingtab and fSummaryReuse
+  std::mutex SummaryMutex;
+
+  // Re-analysis after a change is incremental only in that the summaries of
+  // unchanged methods are skipped, see dependencyHashOf(). Every run still
+  // tabulates from the initial seeds: a changed method and all its callers
+  // are tabulated anew, there is no re-propagation from the changed methods
+  // alone, and no jump function is reused when values are computed.
+  //
+  // summaries can only be persisted if nodes, facts and methods can be
+  // encoded by FunctionLocalIDs
+  static constexpr bool HasPersistableSummaries =
+      std::is_same<N, const llvm::Instruction *>::value &&
+      std::is_same<D, const llvm::Value *>::value &&
+      std::is_same<M, const llvm::Function *>::value;
+
+  // the persisted summaries of a method, as far as they have been loaded
+  struct PersistedSummary {
+    std::optional<IDESummary> Record;
+    std::unique_ptr<FunctionLocalIDs> IDs;
+    // decoded summaries: fact at the start point to <exit, fact at exit>
+    std::map<D, std::vector<std::pair<N, D>>> EntriesBySourceFact;
+    // decoded reached facts: fact at the start point to <node, fact at node>
+    std::map<D, std::vector<std::pair<N, D>>> ReachedBySourceFact;
+    // facts at the start point whose summaries have been reused
+    std::set<D> Reused;
+  };
+
+  // null unless summaries are persisted
+  std::unique_ptr<SummaryStore> summaryStore;
+
+  // null unless progress snapshots are written, see
+  // SolverConfiguration::progressDestination
+  std::unique_ptr<ProgressStream> progressStream;
+  std::chrono::milliseconds progressInterval;
+  unsigned progressTopProcedures;
+  std::chrono::steady_clock::time_point progressStart;
+  std::chrono::steady_clock::time_point lastProgress;
+  std::size_t lastProgressEdges = 0;
+  std::atomic<std::size_t> ProcessedPathEdges{0};
+  // processed path edges per method, counted by each worker on its own such
+  // that the workers do not contend for a single lock
+  struct WorkerProgress {
+    std::mutex Mutex;
+    std::unordered_map<M, std::size_t> PathEdgesPerMethod;
+  };
+  std::vector<std::unique_ptr<WorkerProgress>> ProgressPerWorker;
+  // guards the progress state above except for the per-worker counts;
+  // workers that find it locked skip the snapshot instead of waiting
+  std::mutex ProgressMutex;
+  // serializes the writes to progressStream, which happen outside of
+  // ProgressMutex
+  std::mutex ProgressStreamMutex;
+  // the number of cells in endsummarytab, respectively in the end summaries
+  // of the IFDS solver
+  std::atomic<std::size_t> NumEndSummaries{0};
+
+  bool countersRegistered = false;
+
+  std::unordered_map<M, PersistedSummary> PersistedSummaries;
+
+  // hash of each method and of all methods it calls, see dependencyHashOf()
+  std::unordered_map<M, std::size_t> DependencyHashes;
+
+  // guards PersistedSummaries and DependencyHashes; must be acquired before
+  // SummaryMutex
+  std::mutex PersistedSummariesMutex;
 
   // stores the return sites (inside callers) to which we have unbalanced
   // returns if followReturnPastSeeds is enabled
   std::set<N> unbalancedRetSites;
 
+  std::mutex UnbalancedRetSitesMutex;
+
   std::map<N, std::set<D>> initialSeeds;
 
-  Table<N, D, V> valtab;
+  DenseTable<N, D, V> valtab;
+
+  // takes the place of valtab once the results have been compacted
+  ColumnarTable<N, D, V> compactValtab;
+  bool resultsCompacted = false;
 
   std::map<std::pair<N, D>, size_t> fSummaryReuse;
 
@@ -851,42 +1373,1014 @@ protected:
   // (massive) undefined behavior (and nightmares):
   // https://stackoverflow.com/questions/34240794/understanding-the-warning-binding-r-value-to-l-value-reference
   IDESolver(IFDSTabulationProblem<N, D, M, I> &tabulationProblem)
+      : IDESolver(tabulationProblem, tabulationProblem.solver_config) {}
+
+  IDESolver(IFDSTabulationProblem<N, D, M, I> &tabulationProblem,
+            const SolverConfiguration &config)
       : transformedProblem(
             std::make_unique<IFDSToIDETabulationProblem<N, D, M, I>>(
                 tabulationProblem)),
         ideTabulationProblem(*transformedProblem),
         zeroValue(ideTabulationProblem.zeroValue()),
         icfg(ideTabulationProblem.interproceduralCFG()),
-        computevalues(ideTabulationProblem.solver_config.computeValues),
-        autoAddZero(ideTabulationProblem.solver_config.autoAddZero),
-        followReturnPastSeeds(
-            ideTabulationProblem.solver_config.followReturnsPastSeeds),
-        computePersistedSummaries(
-            ideTabulationProblem.solver_config.computePersistedSummaries),
-        recordEdges(ideTabulationProblem.solver_config.recordEdges),
-        PathEdgeCount(0), cachedFlowEdgeFunctions(ideTabulationProblem),
-        allTop(ideTabulationProblem.allTopFunction()),
+        computevalues(config.computeValues),
+        autoAddZero(config.autoAddZero),
+        followReturnPastSeeds(config.followReturnsPastSeeds),
+        computePersistedSummaries(config.computePersistedSummaries),
+        recordEdges(config.recordEdges),
+        NumThreads(ideTabulationProblem.dependsOnProcessingOrder()
+                       ? 1
+                       : config.numThreads),
+        internEdgeFunctions(config.internEdgeFunctions),
+        evictFinishedProcedures(config.evictFinishedProcedures),
+        evictionDelay(config.evictionDelay),
+        recordedEdgesMemoryBudget(config.recordedEdgesMemoryBudget),
+        compactResults(config.compactResults),
+        PathEdgeCount(0),
+        budget(std::chrono::milliseconds(config.timeBudget),
+               config.pathEdgeBudget, config.memoryBudget),
+        WorkList(icfg, config.worklistPolicy),
+        ParallelWorkList(NumThreads),
+        cachedFlowEdgeFunctions(ideTabulationProblem), nodeIds(NumThreads > 1),
+        factIds(NumThreads > 1), computedIntraPathEdges(nodeIds, nodeIds),
+        computedInterPathEdges(nodeIds, nodeIds),
+        allTop(internEdgeFunction(ideTabulationProblem.allTopFunction())),
         jumpFn(std::make_shared<JumpFunctions<N, D, M, V, I>>(
-            allTop, ideTabulationProblem)),
-        initialSeeds(ideTabulationProblem.initialSeeds()) {
+            allTop, ideTabulationProblem, nodeIds, factIds, NumThreads,
+            internEdgeFunctions ? &edgeFunctionInterner : nullptr)),
+        endsummarytab(nodeIds, factIds), incomingtab(nodeIds, factIds),
+        initialSeeds(ideTabulationProblem.initialSeeds()),
+        valtab(nodeIds, factIds) {
+    initSummaryStore(config);
+    initProgressStream(config);
     // std::cout << "called IDESolver::IDESolver() ctor with IFDSProblem" <<
     // std::endl;
   }
 
   virtual void saveEdges(N sourceNode, N sinkStmt, D sourceVal,
-                         std::set<D> destVals, bool interP) {
+                         const FFSet<D> &destVals, bool interP) {
     if (!recordEdges)
       return;
-    Table<N, N, std::map<D, std::set<D>>> &tgtMap =
+    std::lock_guard<std::mutex> Lock(RecordedEdgesMutex);
+    RecordedEdgeTable &tgtMap =
         (interP) ? computedInterPathEdges : computedIntraPathEdges;
-    tgtMap.get(sourceNode, sinkStmt)[sourceVal].insert(destVals.begin(),
-                                                       destVals.end());
+    auto &destIds =
+        tgtMap.get(sourceNode, sinkStmt)[factIds.getOrInsert(sourceVal)];
+    for (D destVal : destVals) {
+      destIds.insert(factIds.getOrInsert(destVal));
+    }
+    if (recordedEdgesMemoryBudget) {
+      RecordedEdgesBytes += destVals.size() * sizeof(RecordedEdge);
+      if (RecordedEdgesBytes > recordedEdgesMemoryBudget) {
+        spillRecordedEdges();
+      }
+    }
+  }
+
+  /**
+   * Moves the recorded edges to RecordedEdgesSpill. Expects
+   * RecordedEdgesMutex to be held by the caller. Edges whose nodes or facts
+   * cannot be written to a file as raw bytes are kept in memory.
+   */
+  void spillRecordedEdges() {
+    if constexpr (std::is_trivially_copyable<RecordedEdge>::value) {
+      auto &lg = lg::get();
+      if (!RecordedEdgesSpill) {
+        RecordedEdgesSpill = std::make_unique<SpillFile>();
+      }
+      for (bool interP : {false, true}) {
+        RecordedEdgeTable &tgtMap =
+            (interP) ? computedInterPathEdges : computedIntraPathEdges;
+        tgtMap.forEachCell([&](N sourceNode, N sinkStmt,
+                               const RecordedFacts &facts) {
+          for (auto &sourceValAndDestVals : facts) {
+            D sourceVal = factIds.get(sourceValAndDestVals.first);
+            for (auto destVal : sourceValAndDestVals.second) {
+              RecordedEdgesSpill->write(RecordedEdge{
+                  sourceNode, sinkStmt, sourceVal, factIds.get(destVal),
+                  interP});
+            }
+          }
+        });
+        tgtMap.clear();
+      }
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "Spilled recorded edges, spill file size: "
+                    << RecordedEdgesSpill->size() << " bytes");
+    }
+    RecordedEdgesBytes = 0;
+  }
+
+  /**
+   * Reads the spilled edges back into computedIntraPathEdges and
+   * computedInterPathEdges.
+   */
+  void restoreSpilledEdges() {
+    std::lock_guard<std::mutex> Lock(RecordedEdgesMutex);
+    if (!RecordedEdgesSpill || RecordedEdgesSpill->empty()) {
+      return;
+    }
+    if constexpr (std::is_trivially_copyable<RecordedEdge>::value) {
+      RecordedEdgesSpill->forEach<RecordedEdge>([this](const RecordedEdge &E) {
+        RecordedEdgeTable &tgtMap =
+            (E.InterP) ? computedInterPathEdges : computedIntraPathEdges;
+        tgtMap.get(E.SourceNode, E.SinkStmt)[factIds.getOrInsert(E.SourceVal)]
+            .insert(factIds.getOrInsert(E.DestVal));
+      });
+    }
+    RecordedEdgesSpill->clear();
+  }
+
+  /**
+   * Returns the given facts of recorded edges as a mapping from each fact at
+   * the source to the facts reached at the sink.
+   */
+  std::map<D, std::set<D>> recordedFacts(const RecordedFacts &facts) const {
+    std::map<D, std::set<D>> result;
+    for (auto &sourceValAndDestVals : facts) {
+      auto &destVals = result[factIds.get(sourceValAndDestVals.first)];
+      for (auto destVal : sourceValAndDestVals.second) {
+        destVals.insert(factIds.get(destVal));
+      }
+    }
+    return result;
+  }
+
+  /**
+   * Returns the edges recorded in the given table that start at sourceNode,
+   * by their sink.
+   */
+  std::map<N, std::map<D, std::set<D>>>
+  recordedEdgesFrom(const RecordedEdgeTable &edges, N sourceNode) const {
+    std::map<N, std::map<D, std::set<D>>> result;
+    edges.forEachInRow(sourceNode,
+                       [&](N sinkStmt, const RecordedFacts &facts) {
+                         result.emplace(sinkStmt, recordedFacts(facts));
+                       });
+    return result;
+  }
+
+  /**
+   * Returns a copy of the edges recorded in the given table.
+   */
+  Table<N, N, std::map<D, std::set<D>>>
+  recordedEdges(const RecordedEdgeTable &edges) const {
+    Table<N, N, std::map<D, std::set<D>>> result;
+    edges.forEachCell(
+        [&](N sourceNode, N sinkStmt, const RecordedFacts &facts) {
+          result.insert(sourceNode, sinkStmt, recordedFacts(facts));
+        });
+    return result;
+  }
+
+  /**
+   * Returns true if the tables of procedures that have no pending path edges
+   * are to be evicted. This requires the solver to run on a single thread.
+   * If the evicted entries cannot be spilled, the IDESolver must not compute
+   * values, which reads all jump functions in Phase II.
+   */
+  virtual bool evictsFinishedProcedures() {
+    return evictFinishedProcedures && NumThreads <= 1 &&
+           (SpillsProcedures || !computevalues);
+  }
+
+  /**
+   * Returns the nodes of the given method whose jump functions may be
+   * evicted. Jump functions at start points, call sites, return sites, exit
+   * points and seeds are kept: they hold the summaries and the incoming
+   * contexts of the method, and joining at them stops the re-derivation of
+   * evicted jump functions as soon as nothing changes anymore.
+   */
+  const std::vector<N> &evictableNodesOf(M method) {
+    auto search = EvictableNodes.find(method);
+    if (search != EvictableNodes.end()) {
+      return search->second;
+    }
+    std::set<N> keptNodes;
+    for (N n : icfg.getAllInstructionsOf(method)) {
+      if (icfg.isCallStmt(n)) {
+        keptNodes.insert(n);
+        for (N retSite : icfg.getReturnSitesOfCallAt(n)) {
+          keptNodes.insert(retSite);
+        }
+      } else if (icfg.isStartPoint(n) || icfg.isExitStmt(n) ||
+                 initialSeeds.count(n)) {
+        keptNodes.insert(n);
+      }
+    }
+    std::vector<N> &nodes = EvictableNodes[method];
+    for (N n : icfg.getAllInstructionsOf(method)) {
+      if (!keptNodes.count(n)) {
+        nodes.push_back(n);
+      }
+    }
+    return nodes;
+  }
+
+  /**
+   * Records that a method has run out of pending path edges. It is evicted
+   * by evictExpiredProcedures() once its eviction delay has passed.
+   */
+  void finishProcedure(M method) {
+    auto delay = EvictionDelays.emplace(method, evictionDelay).first->second;
+    FinishedAt[method] = NumProcessedEdges;
+    FinishedProcedures.push(FinishedProcedure{NumProcessedEdges + delay,
+                                              NumProcessedEdges, method});
+  }
+
+  /**
+   * Evicts the methods whose eviction delay has passed and that are still
+   * finished since they have been queued.
+   */
+  void evictExpiredProcedures() {
+    while (!FinishedProcedures.empty() &&
+           FinishedProcedures.top().Deadline <= NumProcessedEdges) {
+      FinishedProcedure finished = FinishedProcedures.top();
+      FinishedProcedures.pop();
+      if (PendingEdgesPerMethod[finished.Method] == 0 &&
+          FinishedAt[finished.Method] == finished.Stamp) {
+        evictProcedure(finished.Method);
+      }
+    }
+  }
+
+  /**
+   * Evicts the tables of a method that has no pending path edges: the jump
+   * functions at its evictable nodes as well as the end summaries and
+   * incoming edges of its start points are moved to ProcedureSpill. They
+   * are read back by restoreProcedure() as soon as the method is reached
+   * again. If they cannot be spilled, the jump functions are dropped and
+   * re-derived as far as necessary instead.
+   */
+  virtual void evictProcedure(M method) {
+    PAMM_GET_INSTANCE;
+    auto &lg = lg::get();
+    std::size_t numEvicted = 0;
+    if constexpr (SpillsProcedures) {
+      if (!ProcedureSpill) {
+        ProcedureSpill = std::make_unique<SpillFile>();
+      }
+      // entries that have been spilled before must not be overwritten
+      restoreProcedure(method);
+      std::size_t begin = ProcedureSpill->size();
+      for (N n : evictableNodesOf(method)) {
+        numEvicted += spillJumpFunctionsAt(n);
+      }
+      for (N sP : icfg.getStartPointsOf(method)) {
+        spillEndSummaries(sP);
+        spillIncoming(sP);
+      }
+      SpilledProcedures[method] =
+          SpilledProcedure{begin, ProcedureSpill->size(), false};
+    } else {
+      for (N n : evictableNodesOf(method)) {
+        numEvicted += dropJumpFunctionsAt(n);
+      }
+    }
+    INC_COUNTER("Evicted JumpFn", numEvicted, PAMM_SEVERITY_LEVEL::Full);
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Evicted " << numEvicted << " jump functions of "
+                  << icfg.getMethodName(method));
+  }
+
+  /**
+   * Removes the jump functions at n without spilling them and returns their
+   * number.
+   */
+  virtual std::size_t dropJumpFunctionsAt(N n) {
+    return jumpFn->removeFunctionsAt(n);
+  }
+
+  /**
+   * Moves the jump functions at n to ProcedureSpill and returns their
+   * number.
+   */
+  virtual std::size_t spillJumpFunctionsAt(N n) {
+    {
+      auto lookupByTarget = jumpFn->lookupByTargetView(n);
+      for (auto sourceValAndRow : lookupByTarget) {
+        for (auto targetValAndFunction : sourceValAndRow.second) {
+          spill(SpilledEntry{SpilledEntry::Kind::JumpFunction, n,
+                             sourceValAndRow.first, n,
+                             targetValAndFunction.first,
+                             spilledEdgeFunctionId(
+                                 targetValAndFunction.second)});
+        }
+      }
+    }
+    return jumpFn->removeFunctionsAt(n);
+  }
+
+  /**
+   * Moves the end summaries of the start point sP to ProcedureSpill.
+   */
+  virtual void spillEndSummaries(N sP) {
+    endsummarytab.forEachInRow(sP, [&](D d1, const auto &summaries) {
+      for (auto &exitAndFunction : summaries) {
+        spill(SpilledEntry{SpilledEntry::Kind::EndSummary, sP, d1,
+                           nodeIds.get(firstIdOf(exitAndFunction.first)),
+                           factIds.get(secondIdOf(exitAndFunction.first)),
+                           spilledEdgeFunctionId(exitAndFunction.second)});
+        --NumEndSummaries;
+      }
+    });
+    endsummarytab.remove(sP);
+  }
+
+  /**
+   * Moves the incoming edges of the start point sP to ProcedureSpill.
+   * Contexts without incoming edges, see addSummaryContext(), are kept as
+   * well.
+   */
+  void spillIncoming(N sP) {
+    incomingtab.forEachInRow(sP, [&](D d3, const auto &callSites) {
+      if (callSites.empty()) {
+        spill(SpilledEntry{SpilledEntry::Kind::Context, sP, d3, sP, d3, 0});
+      }
+      for (auto callSite : callSites) {
+        spill(SpilledEntry{SpilledEntry::Kind::Incoming, sP, d3,
+                           nodeIds.get(firstIdOf(callSite)),
+                           factIds.get(secondIdOf(callSite)), 0});
+      }
+    });
+    incomingtab.remove(sP);
+  }
+
+  void spill(const SpilledEntry &entry) {
+    if constexpr (SpillsProcedures) {
+      ProcedureSpill->write(entry);
+    }
+  }
+
+  std::uint32_t
+  spilledEdgeFunctionId(const std::shared_ptr<EdgeFunction<V>> &f) {
+    auto search = SpilledEdgeFunctionIds.find(f.get());
+    if (search != SpilledEdgeFunctionIds.end()) {
+      return search->second;
+    }
+    std::uint32_t id = SpilledEdgeFunctions.size();
+    SpilledEdgeFunctions.push_back(f);
+    SpilledEdgeFunctionIds[f.get()] = id;
+    return id;
+  }
+
+  /**
+   * Reads a spilled entry back into the solver's tables.
+   */
+  virtual void restoreSpilledEntry(const SpilledEntry &entry) {
+    switch (entry.kind) {
+    case SpilledEntry::Kind::JumpFunction:
+      jumpFn->addFunction(entry.SourceVal, entry.Node, entry.TargetVal,
+                          SpilledEdgeFunctions[entry.EdgeFunction]);
+      break;
+    case SpilledEntry::Kind::EndSummary:
+      addEndSummary(entry.Node, entry.SourceVal, entry.Target,
+                    entry.TargetVal, SpilledEdgeFunctions[entry.EdgeFunction]);
+      break;
+    case SpilledEntry::Kind::Incoming:
+      addIncoming(entry.Node, entry.SourceVal, entry.Target, entry.TargetVal);
+      break;
+    case SpilledEntry::Kind::Context:
+      incomingtab.get(entry.Node, entry.SourceVal);
+      break;
+    }
+  }
+
+  /**
+   * Reads the tables of an evicted method back into memory before the
+   * method is tabulated any further. A method that is re-entered after its
+   * eviction stays in memory twice as long the next time it is finished,
+   * such that methods that are re-entered over and over again are not
+   * evicted over and over again.
+   */
+  void restoreProcedure(M method) {
+    if constexpr (SpillsProcedures) {
+      if (SpilledProcedures.empty()) {
+        return;
+      }
+      auto search = SpilledProcedures.find(method);
+      if (search == SpilledProcedures.end()) {
+        return;
+      }
+      SpilledProcedure spilled = search->second;
+      SpilledProcedures.erase(search);
+      ProcedureSpill->forEach<SpilledEntry>(
+          spilled.Begin, spilled.End, [&](const SpilledEntry &entry) {
+            if (!spilled.SummariesRestored ||
+                entry.kind == SpilledEntry::Kind::JumpFunction) {
+              restoreSpilledEntry(entry);
+            }
+          });
+      std::size_t &delay = EvictionDelays[method];
+      delay = std::max<std::size_t>(2 * delay, 1);
+      // the file holds stale entries only
+      if (SpilledProcedures.empty()) {
+        ProcedureSpill->clear();
+      }
+    }
+  }
+
+  /**
+   * Reads the end summaries and incoming edges of all evicted methods back
+   * into memory once the tabulation is done, such that they can be queried
+   * and persisted. The jump functions stay spilled, Phase II reads them from
+   * ProcedureSpill.
+   */
+  void restoreSpilledSummaries() {
+    if constexpr (SpillsProcedures) {
+      for (auto &methodAndSpilled : SpilledProcedures) {
+        SpilledProcedure &spilled = methodAndSpilled.second;
+        if (spilled.SummariesRestored) {
+          continue;
+        }
+        ProcedureSpill->forEach<SpilledEntry>(
+            spilled.Begin, spilled.End, [this](const SpilledEntry &entry) {
+              if (entry.kind != SpilledEntry::Kind::JumpFunction) {
+                restoreSpilledEntry(entry);
+              }
+            });
+        spilled.SummariesRestored = true;
+      }
+    }
+  }
+
+  /**
+   * Calls Handler(target, sourceVal, targetVal, function) for every jump
+   * function of the evicted methods.
+   */
+  template <typename HandlerT>
+  void forEachSpilledJumpFunction(HandlerT Handler) {
+    if constexpr (SpillsProcedures) {
+      for (auto &methodAndSpilled : SpilledProcedures) {
+        ProcedureSpill->forEach<SpilledEntry>(
+            methodAndSpilled.second.Begin, methodAndSpilled.second.End,
+            [&](const SpilledEntry &entry) {
+              if (entry.kind == SpilledEntry::Kind::JumpFunction) {
+                Handler(entry.Node, entry.SourceVal, entry.TargetVal,
+                        SpilledEdgeFunctions[entry.EdgeFunction]);
+              }
+            });
+      }
+    }
+  }
+
+  /**
+   * Registers the solver's counters and histograms, once per solver.
+   */
+  void registerCounters() {
+    PAMM_GET_INSTANCE;
+    if (countersRegistered) {
+      return;
+    }
+    countersRegistered = true;
+    REG_COUNTER("Gen facts", 0, PAMM_SEVERITY_LEVEL::Core);
+    REG_COUNTER("Kill facts", 0, PAMM_SEVERITY_LEVEL::Core);
+    REG_COUNTER("Summary-reuse", 0, PAMM_SEVERITY_LEVEL::Core);
+    REG_COUNTER("Intra Path Edges", 0, PAMM_SEVERITY_LEVEL::Core);
+    REG_COUNTER("Inter Path Edges", 0, PAMM_SEVERITY_LEVEL::Core);
+    REG_COUNTER("FF Queries", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("EF Queries", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Value Propagation", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Value Computation", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("SpecialSummary-FF Application", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("SpecialSummary-EF Queries", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("JumpFn Construction", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Process Call", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Process Normal", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Process Exit", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Evicted JumpFn", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Sparse Skips", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_COUNTER("Persisted Summary-reuse", 0, PAMM_SEVERITY_LEVEL::Core);
+    REG_COUNTER("[Calls] getPointsToSet", 0, PAMM_SEVERITY_LEVEL::Full);
+    REG_HISTOGRAM("Data-flow facts", PAMM_SEVERITY_LEVEL::Full);
+    REG_HISTOGRAM("Points-to", PAMM_SEVERITY_LEVEL::Full);
+  }
+
+  /**
+   * Returns config with a single thread, for solvers that have to process
+   * path edges on the calling thread. It is meant to be passed to the
+   * constructor, which sets up the tables for the configured threads.
+   */
+  static SolverConfiguration singleThreaded(SolverConfiguration config) {
+    config.numThreads = 1;
+    return config;
+  }
+
+  /**
+   * Starts the clocks of the budget and of the progress reports.
+   */
+  void startClock() {
+    budget.start();
+    progressStart = lastProgress = std::chrono::steady_clock::now();
+  }
+
+  /**
+   * Writes the final progress snapshot and persists the summaries once no
+   * path edges are pending, unless a budget has been exceeded.
+   */
+  void finishTabulation() {
+    auto &lg = lg::get();
+    restoreSpilledSummaries();
+    if (progressStream) {
+      std::string snapshot;
+      {
+        std::lock_guard<std::mutex> Lock(ProgressMutex);
+        snapshot = progressSnapshot(true);
+      }
+      writeProgressSnapshot(snapshot);
+    }
+    if (isComplete()) {
+      storePersistedSummaries();
+    } else {
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                    << "Exceeded the " << budget.getExceeded()
+                    << " budget, the results are incomplete");
+    }
+  }
+
+  void initProgressStream(const SolverConfiguration &config) {
+    progressInterval = std::chrono::milliseconds(config.progressInterval);
+    progressTopProcedures = config.progressTopProcedures;
+    progressStart = lastProgress = std::chrono::steady_clock::now();
+    if (!config.progressDestination.empty()) {
+      progressStream =
+          std::make_unique<ProgressStream>(config.progressDestination);
+      for (unsigned Worker = 0; Worker < std::max(NumThreads, 1u); ++Worker) {
+        ProgressPerWorker.push_back(std::make_unique<WorkerProgress>());
+      }
+    }
+  }
+
+  /**
+   * Accounts for the processing of edge and writes a progress snapshot if
+   * the last one is older than the progress interval.
+   */
+  void reportProgress(PathEdge<N, D> edge) {
+    // the clock is only sampled every once in a while
+    static constexpr std::size_t CheckInterval = 256;
+    std::size_t processed = ++ProcessedPathEdges;
+    WorkerProgress &Own =
+        *ProgressPerWorker[ParallelWorkList.getCurrentWorker()];
+    {
+      // only contended while a snapshot is being written
+      std::lock_guard<std::mutex> Lock(Own.Mutex);
+      ++Own.PathEdgesPerMethod[icfg.getMethodOf(edge.getTarget())];
+    }
+    if (processed % CheckInterval != 0) {
+      return;
+    }
+    std::string snapshot;
+    {
+      std::unique_lock<std::mutex> Lock(ProgressMutex, std::try_to_lock);
+      if (!Lock.owns_lock() ||
+          std::chrono::steady_clock::now() - lastProgress < progressInterval) {
+        return;
+      }
+      snapshot = progressSnapshot(false);
+    }
+    writeProgressSnapshot(snapshot);
+  }
+
+  void writeProgressSnapshot(const std::string &snapshot) {
+    std::lock_guard<std::mutex> Lock(ProgressStreamMutex);
+    progressStream->writeLine(snapshot);
+  }
+
+  /**
+   * Returns a snapshot of the solver's progress as a single line of JSON.
+   * Expects ProgressMutex to be held by the caller. All sizes are maintained
+   * incrementally, hence no table is scanned or locked as a whole.
+   */
+  std::string progressSnapshot(bool final) {
+    auto now = std::chrono::steady_clock::now();
+    std::size_t processed = ProcessedPathEdges;
+    double seconds = std::chrono::duration<double>(now - lastProgress).count();
+    json J;
+    J["elapsed_ms"] = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          now - progressStart)
+                          .count();
+    J["final"] = final;
+    J["path_edges_processed"] = processed;
+    J["path_edges_per_second"] =
+        seconds > 0 ? (processed - lastProgressEdges) / seconds : 0.0;
+    J["pending_path_edges"] =
+        NumThreads > 1 ? ParallelWorkList.size() : WorkList.size();
+    J["jump_functions"] = numJumpFunctions();
+    J["end_summaries"] = numEndSummaries();
+    J["flow_function_cache_hit_rate"] =
+        cachedFlowEdgeFunctions.getFlowFunctionStatistics().getHitRate();
+    J["edge_function_cache_hit_rate"] =
+        cachedFlowEdgeFunctions.getEdgeFunctionStatistics().getHitRate();
+    J["rss_bytes"] = getResidentSetSize();
+    std::unordered_map<M, std::size_t> PathEdgesPerMethod;
+    for (auto &Worker : ProgressPerWorker) {
+      std::lock_guard<std::mutex> Lock(Worker->Mutex);
+      for (auto &methodAndEdges : Worker->PathEdgesPerMethod) {
+        PathEdgesPerMethod[methodAndEdges.first] += methodAndEdges.second;
+      }
+    }
+    std::vector<std::pair<M, std::size_t>> top(PathEdgesPerMethod.begin(),
+                                               PathEdgesPerMethod.end());
+    auto topEnd = top.begin() + std::min<std::size_t>(progressTopProcedures,
+                                                      top.size());
+    std::partial_sort(top.begin(), topEnd, top.end(),
+                      [](const std::pair<M, std::size_t> &a,
+                         const std::pair<M, std::size_t> &b) {
+                        return a.second > b.second;
+                      });
+    J["top_procedures"] = json::array();
+    for (auto it = top.begin(); it != topEnd; ++it) {
+      J["top_procedures"].push_back(
+          {{"procedure", icfg.getMethodName(it->first)},
+           {"path_edges", it->second}});
+    }
+    lastProgress = now;
+    lastProgressEdges = processed;
+    return J.dump();
+  }
+
+  /**
+   * Returns the number of jump functions in constant time.
+   */
+  virtual std::size_t numJumpFunctions() { return jumpFn->size(); }
+
+  /**
+   * Returns the number of end summaries in constant time.
+   */
+  std::size_t numEndSummaries() const { return NumEndSummaries; }
+
+  void initSummaryStore(const SolverConfiguration &config) {
+    if constexpr (HasPersistableSummaries) {
+      if (config.computePersistedSummaries &&
+          !config.summaryDirectory.empty()) {
+        summaryStore = std::make_unique<SummaryStore>(config.summaryDirectory);
+      }
+    }
+  }
+
+  /**
+   * Returns the persisted summaries of the given method, loading them from
+   * the summary store on first use. Expects PersistedSummariesMutex to be
+   * held by the caller.
+   */
+  PersistedSummary &getPersistedSummary(M method) {
+    auto inserted = PersistedSummaries.try_emplace(method);
+    PersistedSummary &PS = inserted.first->second;
+    if constexpr (HasPersistableSummaries) {
+      if (!inserted.second) {
+        return PS;
+      }
+      auto &lg = lg::get();
+      PS.IDs = std::make_unique<FunctionLocalIDs>(method);
+      PS.Record = summaryStore->load(method->getName().str(),
+                                     dependencyHashOf(method));
+      if (!PS.Record) {
+        return PS;
+      }
+      for (const std::string &sourceFact : PS.Record->SourceFacts) {
+        if (D d = decodeSummaryFact(PS, sourceFact)) {
+          PS.EntriesBySourceFact[d];
+        }
+      }
+      std::set<D> incomplete;
+      for (bool reached : {false, true}) {
+        auto &entriesBySourceFact =
+            reached ? PS.ReachedBySourceFact : PS.EntriesBySourceFact;
+        for (const IDESummary::Entry &entry :
+             reached ? PS.Record->ReachedFacts : PS.Record->Entries) {
+          D d3 = decodeSummaryFact(PS, entry.SourceFact);
+          N n = llvm::dyn_cast_or_null<llvm::Instruction>(
+              PS.IDs->getValue(entry.ExitStmt));
+          D d4 = decodeSummaryFact(PS, entry.TargetFact);
+          if (!n || !d4) {
+            incomplete.insert(d3);
+          } else {
+            entriesBySourceFact[d3].emplace_back(n, d4);
+          }
+        }
+      }
+      // incomplete summaries must not be reused
+      for (D d3 : incomplete) {
+        PS.EntriesBySourceFact.erase(d3);
+        PS.ReachedBySourceFact.erase(d3);
+      }
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "Loaded persisted summaries of "
+                    << icfg.getMethodName(method) << " for "
+                    << PS.EntriesBySourceFact.size() << " facts");
+    }
+    return PS;
+  }
+
+  /**
+   * Returns a hash of the given method and of all methods it transitively
+   * calls, hence the persisted summaries of a method are invalidated as soon
+   * as the method or anything it depends on is changed. Methods that call
+   * each other are hashed together. Expects PersistedSummariesMutex to be held
+   * by the caller.
+   *
+   * Only the solver's work is reused: the call graph is the one of the ICFG
+   * the solver runs on, which is built from scratch for every run, hence
+   * changed call-graph edges are reflected by the hash without being
+   * invalidated explicitly.
+   */
+  std::size_t dependencyHashOf(M method) {
+    if constexpr (HasPersistableSummaries) {
+      auto search = DependencyHashes.find(method);
+      if (search != DependencyHashes.end()) {
+        return search->second;
+      }
+      auto calleesOf = [this](M m) {
+        std::set<M> callees;
+        for (N callSite : icfg.getCallsFromWithin(m)) {
+          for (M callee : icfg.getCalleesOfCallAt(callSite)) {
+            callees.insert(callee);
+          }
+        }
+        return std::vector<M>(callees.begin(), callees.end());
+      };
+      // Tarjan's algorithm on the call graph, the strongly connected
+      // components are completed bottom-up; it keeps an explicit stack of
+      // the methods being visited as call chains may be arbitrarily deep
+      struct Frame {
+        M m;
+        std::vector<M> callees;
+        std::size_t nextCallee;
+      };
+      std::unordered_map<M, std::size_t> index;
+      std::unordered_map<M, std::size_t> lowlink;
+      std::vector<M> stack;
+      std::unordered_set<M> onStack;
+      std::vector<Frame> frames;
+      auto enter = [&](M m) {
+        std::size_t id = index.size();
+        index[m] = id;
+        lowlink[m] = id;
+        stack.push_back(m);
+        onStack.insert(m);
+        frames.push_back({m, calleesOf(m), 0});
+      };
+      enter(method);
+      while (!frames.empty()) {
+        Frame &frame = frames.back();
+        M m = frame.m;
+        if (frame.nextCallee < frame.callees.size()) {
+          M callee = frame.callees[frame.nextCallee++];
+          if (DependencyHashes.count(callee)) {
+            continue;
+          }
+          if (!index.count(callee)) {
+            // may invalidate the reference to frame
+            enter(callee);
+          } else if (onStack.count(callee)) {
+            lowlink[m] = std::min(lowlink[m], index[callee]);
+          }
+          continue;
+        }
+        frames.pop_back();
+        if (!frames.empty()) {
+          M caller = frames.back().m;
+          lowlink[caller] = std::min(lowlink[caller], lowlink[m]);
+        }
+        if (lowlink[m] != index[m]) {
+          continue;
+        }
+        std::vector<M> component;
+        do {
+          component.push_back(stack.back());
+          onStack.erase(stack.back());
+          stack.pop_back();
+        } while (component.back() != m);
+        // hash the members and the completed components they call in a
+        // deterministic order
+        std::set<std::pair<std::string, std::size_t>> dependencies;
+        for (M member : component) {
+          dependencies.emplace(member->getName().str(),
+                               computeFunctionHash(member));
+          for (M callee : calleesOf(member)) {
+            auto calleeHash = DependencyHashes.find(callee);
+            if (calleeHash != DependencyHashes.end()) {
+              dependencies.emplace(callee->getName().str(),
+                                   calleeHash->second);
+            }
+          }
+        }
+        std::size_t hash = 0;
+        for (auto &dependency : dependencies) {
+          hashCombine(hash, dependency.first);
+          hashCombine(hash, dependency.second);
+        }
+        for (M member : component) {
+          DependencyHashes[member] = hash;
+        }
+      }
+      return DependencyHashes.at(method);
+    } else {
+      return 0;
+    }
+  }
+
+  D decodeSummaryFact(const PersistedSummary &PS, const std::string &ID) {
+    return (ID == "zero") ? zeroValue : PS.IDs->getValue(ID);
+  }
+
+  std::string encodeSummaryFact(const PersistedSummary &PS, D d) {
+    return ideTabulationProblem.isZeroValue(d) ? "zero" : PS.IDs->getID(d);
+  }
+
+  /**
+   * If the end summaries of method for the fact d3 at its start point sP are
+   * known from a previous analysis run, in which neither the method nor any
+   * method it calls has been different, adds them to the end summaries and
+   * returns true; the method then need not be tabulated for d3.
+   */
+  bool reusePersistedSummary(M method, N sP, D d3) {
+    if (!summaryStore || !reusesPersistedSummaries()) {
+      return false;
+    }
+    PAMM_GET_INSTANCE;
+    std::lock_guard<std::mutex> Lock(PersistedSummariesMutex);
+    PersistedSummary &PS = getPersistedSummary(method);
+    auto search = PS.EntriesBySourceFact.find(d3);
+    if (search == PS.EntriesBySourceFact.end()) {
+      return false;
+    }
+    if (PS.Reused.count(d3)) {
+      return true;
+    }
+    auto reached = PS.ReachedBySourceFact.find(d3);
+    if (!restorePersistedPathEdges(d3, reached != PS.ReachedBySourceFact.end()
+                                           ? &reached->second
+                                           : nullptr)) {
+      return false;
+    }
+    PS.Reused.insert(d3);
+    // add the summaries before releasing PersistedSummariesMutex, such that
+    // concurrent callers find them
+    std::lock_guard<std::mutex> SummaryLock(SummaryMutex);
+    for (auto &entry : search->second) {
+      addEndSummary(sP, d3, entry.first, entry.second);
+    }
+    INC_COUNTER("Persisted Summary-reuse", 1, PAMM_SEVERITY_LEVEL::Core);
+    return true;
+  }
+
+  /**
+   * Returns true if persisted summaries are reused rather than only stored.
+   * The IDESolver does not persist jump functions, hence it cannot restore
+   * the values within a reused method and only reuses summaries if it does
+   * not compute values. No solver reuses the summaries of a problem whose
+   * flow functions have side effects.
+   */
+  virtual bool reusesPersistedSummaries() {
+    return !computevalues && !ideTabulationProblem.hasFlowFunctionSideEffects();
+  }
+
+  /**
+   * Restores the facts reached from d3 within a method whose summaries are
+   * reused, such that the results within the method are the same as if it
+   * had been tabulated; reached is null if they have not been persisted.
+   * Returns false if the summaries must not be reused. Without values there
+   * is nothing to restore for the IDESolver.
+   */
+  virtual bool
+  restorePersistedPathEdges(D d3, const std::vector<std::pair<N, D>> *reached) {
+    return true;
+  }
+
+  /**
+   * Collects the facts reached from each fact at the start point of each
+   * method. Returns false if the solver does not persist them.
+   */
+  virtual bool
+  collectPersistablePathEdges(Table<M, D, std::map<N, std::set<D>>> &reached) {
+    return false;
+  }
+
+  /**
+   * Adds the persisted end summary from d3 at sP to d4 at eP. Expects
+   * SummaryMutex to be held by the caller.
+   */
+  virtual void addEndSummary(N sP, D d3, N eP, D d4) {
+    auto summary = endsummarytab.get(sP, d3).tryEmplace(
+        combineIds(nodeIds.getOrInsert(eP), factIds.getOrInsert(d4)));
+    if (summary.second) {
+      ++NumEndSummaries;
+    }
+    *summary.first = EdgeIdentity<V>::getInstance();
+  }
+
+  /**
+   * Collects the end summaries from d3 at sP in persistable form, i.e. the
+   * facts reached at the method's exits. Returns false if they cannot be
+   * persisted, which is the case if an edge function is not the identity.
+   */
+  virtual bool getPersistableEndSummary(N sP, D d3,
+                                        std::map<N, std::set<D>> &exits) {
+    auto *summaries = endsummarytab.find(sP, d3);
+    if (!summaries) {
+      return true;
+    }
+    auto identity = EdgeIdentity<V>::getInstance();
+    for (auto &exitAndFunction : *summaries) {
+      if (!exitAndFunction.second->equal_to(identity)) {
+        return false;
+      }
+      exits[nodeIds.get(firstIdOf(exitAndFunction.first))].insert(
+          factIds.get(secondIdOf(exitAndFunction.first)));
+    }
+    return true;
+  }
+
+  /**
+   * Writes the end summaries of all methods that have been called to the
+   * summary store. Summaries that are known from previous runs are kept.
+   */
+  void storePersistedSummaries() {
+    if constexpr (HasPersistableSummaries) {
+      if (!summaryStore) {
+        return;
+      }
+      auto &lg = lg::get();
+      std::set<M> changed;
+      Table<M, D, std::map<N, std::set<D>>> reached;
+      bool withPathEdges = collectPersistablePathEdges(reached);
+      // every context a method has been called in has an incoming edge
+      incomingtab.forEachRow([&](N sP, const auto &facts) {
+        M method = icfg.getMethodOf(sP);
+        PersistedSummary &PS = getPersistedSummary(method);
+        for (auto &d3AndIncoming : facts) {
+          D d3 = factIds.get(d3AndIncoming.first);
+          std::map<N, std::set<D>> exits;
+          if (PS.EntriesBySourceFact.count(d3) ||
+              !getPersistableEndSummary(sP, d3, exits)) {
+            continue;
+          }
+          std::string sourceFact = encodeSummaryFact(PS, d3);
+          bool encodable = !sourceFact.empty();
+          std::set<IDESummary::Entry> entries;
+          for (auto &exit : exits) {
+            std::string exitStmt = PS.IDs->getID(exit.first);
+            for (D d4 : exit.second) {
+              std::string targetFact = encodeSummaryFact(PS, d4);
+              encodable &= !exitStmt.empty() && !targetFact.empty();
+              entries.insert({sourceFact, exitStmt, targetFact});
+            }
+          }
+          std::set<IDESummary::Entry> reachedFacts;
+          if (auto *facts = withPathEdges ? reached.find(method, d3)
+                                          : nullptr) {
+            for (auto &nodeAndFacts : *facts) {
+              std::string node = PS.IDs->getID(nodeAndFacts.first);
+              for (D d : nodeAndFacts.second) {
+                std::string fact = encodeSummaryFact(PS, d);
+                encodable &= !node.empty() && !fact.empty();
+                reachedFacts.insert({sourceFact, node, fact});
+              }
+            }
+          }
+          if (!encodable) {
+            continue;
+          }
+          if (!PS.Record) {
+            PS.Record = IDESummary(method->getName().str(),
+                                   dependencyHashOf(method));
+          }
+          PS.Record->SourceFacts.insert(sourceFact);
+          PS.Record->Entries.insert(entries.begin(), entries.end());
+          PS.Record->ReachedFacts.insert(reachedFacts.begin(),
+                                         reachedFacts.end());
+          changed.insert(method);
+        }
+      });
+      for (M method : changed) {
+        summaryStore->store(*PersistedSummaries.at(method).Record);
+      }
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                    << "Persisted the summaries of " << changed.size()
+                    << " methods");
+    }
+  }
+
+  /**
+   * Schedules a path edge whose jump function has changed for processing.
+   */
+  void schedulePathEdge(PathEdge<N, D> edge) {
+    PathEdgeCount++;
+    if (NumThreads > 1) {
+      ParallelWorkList.push(edge);
+      return;
+    }
+    if (evictsFinishedProcedures()) {
+      ++PendingEdgesPerMethod[icfg.getMethodOf(edge.getTarget())];
+    }
+    WorkList.push(edge);
   }
 
   /**
    * Computes the final values for edge functions.
    */
-  void computeValues() {
+  virtual void computeValues() {
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start computing values");
     // Phase II(i)
@@ -903,12 +2397,18 @@ protected:
         setVal(startPoint, val, ideTabulationProblem.bottomElement());
         std::pair<N, D> superGraphNode(startPoint, val);
         valuePropagationTask(superGraphNode);
+        processValuePropagationWorkList();
       }
     }
     // Phase II(ii)
     // we create an array of all nodes and then dispatch fractions of this array
     // to multiple threads
     std::set<N> allNonCallStartNodes = icfg.allNonCallStartNodes();
+    computeSpilledValues();
+    if (NumThreads > 1) {
+      computeValuesInParallel(allNonCallStartNodes);
+      return;
+    }
     std::vector<N> nonCallStartNodesArray(allNonCallStartNodes.size());
     size_t i = 0;
     for (N n : allNonCallStartNodes) {
@@ -923,7 +2423,15 @@ protected:
    * Clients should only call this methods if performing synchronization on
    * their own. Normally, solve() should be called instead.
    */
-  void submitInitalSeeds() {
+  virtual void submitInitalSeeds() {
+    seedPathEdges();
+    processWorkList();
+  }
+
+  /**
+   * Propagates the initial seeds without processing them.
+   */
+  virtual void seedPathEdges() {
     auto &lg = lg::get();
     PAMM_GET_INSTANCE;
     for (const auto &seed : initialSeeds) {
@@ -947,6 +2455,91 @@ protected:
     }
   }
 
+  /**
+   * Adds value at n to the seeds while path edges are being processed. The
+   * new seed is scheduled like an initial seed, and its value is BOTTOM.
+   */
+  virtual void addSeed(N n, D value) {
+    initialSeeds[n].insert(value);
+    propagate(zeroValue, n, value, EdgeIdentity<V>::getInstance(), nullptr,
+              false);
+    jumpFn->addFunction(zeroValue, n, zeroValue,
+                        EdgeIdentity<V>::getInstance());
+  }
+
+  /**
+   * Tabulates the method of the start point sP for d3 as if it had been
+   * called with d3 from a call site that is not known, such that its end
+   * summaries for d3 are computed and persisted like the ones of a called
+   * method. Nothing is returned to any caller.
+   */
+  virtual void addSummaryContext(N sP, D d3) {
+    {
+      std::lock_guard<std::mutex> Lock(SummaryMutex);
+      incomingtab.get(sP, d3);
+    }
+    propagate(d3, sP, d3, EdgeIdentity<V>::getInstance(), nullptr, false);
+  }
+
+  /**
+   * Freezes the values into compactValtab and releases valtab.
+   */
+  void compactResultTable() {
+    auto &lg = lg::get();
+    compactValtab = ColumnarTable<N, D, V>(valtab);
+    valtab.clear();
+    resultsCompacted = true;
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Compacted " << compactValtab.size() << " results at "
+                  << compactValtab.numRows() << " nodes");
+  }
+
+  bool budgetExceeded() {
+    return budget.isBounded() && budget.exceeded(PathEdgeCount);
+  }
+
+  /**
+   * Processes the pending path edges in the order given by the configured
+   * WorklistPolicy until no new path edges are discovered. If multiple
+   * threads are configured, the path edges are processed by these threads
+   * instead, which steal pending edges from each other. Stops early, leaving
+   * the remaining path edges unprocessed, once a budget is exceeded.
+   */
+  void processWorkList() {
+    auto &lg = lg::get();
+    if (NumThreads > 1) {
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "Process path edges using " << NumThreads
+                    << " threads");
+      ParallelWorkList.run([this](PathEdge<N, D> edge) {
+        pathEdgeProcessingTask(edge);
+        if (budgetExceeded()) {
+          ParallelWorkList.abort();
+        }
+      });
+      return;
+    }
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Process path edges using worklist policy: "
+                  << WorkList.getPolicy());
+    bool evict = evictsFinishedProcedures();
+    while (!WorkList.empty()) {
+      if (budgetExceeded()) {
+        break;
+      }
+      PathEdge<N, D> edge = WorkList.pop();
+      pathEdgeProcessingTask(edge);
+      if (evict) {
+        M method = icfg.getMethodOf(edge.getTarget());
+        ++NumProcessedEdges;
+        if (--PendingEdgesPerMethod[method] == 0) {
+          finishProcedure(method);
+        }
+        evictExpiredProcedures();
+      }
+    }
+  }
+
   /**
    * Lines 21-32 of the algorithm.
    *
@@ -971,16 +2564,20 @@ protected:
     // for each of the method's start points, determine incoming calls
     std::set<N> startPointsOf = icfg.getStartPointsOf(methodThatNeedsSummary);
     std::map<N, std::set<D>> inc;
-    for (N sP : startPointsOf) {
-      // line 21.1 of Naeem/Lhotak/Rodriguez
-      // register end-summary
-      addEndSummary(sP, d1, n, d2, f);
-      for (auto entry : incoming(d1, sP)) {
-        inc[entry.first] = std::set<D>{entry.second};
+    {
+      // see processCall() for the counterpart
+      std::lock_guard<std::mutex> Lock(SummaryMutex);
+      for (N sP : startPointsOf) {
+        // line 21.1 of Naeem/Lhotak/Rodriguez
+        // register end-summary
+        addEndSummary(sP, d1, n, d2, f);
+        for (auto entry : incoming(d1, sP)) {
+          inc[entry.first] = std::set<D>{entry.second};
+        }
       }
+      printEndSummaryTab();
+      printIncomingTab();
     }
-    printEndSummaryTab();
-    printIncomingTab();
     // for each incoming call edge already processed
     //(see processCall(..))
     for (auto entry : inc) {
@@ -995,7 +2592,7 @@ protected:
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
         // for each incoming-call value
         for (D d4 : entry.second) {
-          std::set<D> targets =
+          FFSet<D> targets =
               computeReturnFlowFunction(retFunction, d1, d2, c, entry.second);
           ADD_TO_HISTOGRAM("Data-flow facts", targets.size(), 1,
                            PAMM_SEVERITY_LEVEL::Full);
@@ -1020,23 +2617,23 @@ protected:
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                           << "         (return * function * call)");
             std::shared_ptr<EdgeFunction<V>> fPrime =
-                f4->composeWith(f)->composeWith(f5);
+                composeEdgeFunctions(composeEdgeFunctions(f4, f), f5);
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                           << "       = " << fPrime->str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
             // for each jump function coming into the call, propagate to return
             // site using the composed function
-            for (auto valAndFunc : jumpFn->reverseLookup(c, d4)) {
-              std::shared_ptr<EdgeFunction<V>> f3 = valAndFunc.second;
-              if (!f3->equal_to(allTop)) {
+            for (auto valAndFunc : jumpFn->reverseLookupView(c, d4)) {
+              const std::shared_ptr<EdgeFunction<V>> &f3 = valAndFunc.second;
+              if (f3 != allTop && !f3->equal_to(allTop)) {
                 D d3 = valAndFunc.first;
                 D d5_restoredCtx = restoreContextOnReturnedFact(c, d4, d5);
                 LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                               << "Compose: " << fPrime->str() << " * "
                               << f3->str());
                 LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-                propagate(d3, retSiteC, d5_restoredCtx, f3->composeWith(fPrime),
-                          c, false);
+                propagate(d3, retSiteC, d5_restoredCtx,
+                          composeEdgeFunctions(f3, fPrime), c, false);
               }
             }
           }
@@ -1057,7 +2654,7 @@ protected:
               cachedFlowEdgeFunctions.getRetFlowFunction(
                   c, methodThatNeedsSummary, n, retSiteC);
           INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-          std::set<D> targets = computeReturnFlowFunction(
+          FFSet<D> targets = computeReturnFlowFunction(
               retFunction, d1, d2, c, std::set<D>{zeroValue});
           ADD_TO_HISTOGRAM("Data-flow facts", targets.size(), 1,
                            PAMM_SEVERITY_LEVEL::Full);
@@ -1070,8 +2667,10 @@ protected:
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                           << "Compose: " << f5->str() << " * " << f->str());
             LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-            propagteUnbalancedReturnFlow(retSiteC, d5, f->composeWith(f5), c);
+            propagteUnbalancedReturnFlow(retSiteC, d5,
+                                         composeEdgeFunctions(f, f5), c);
             // register for value processing (2nd IDE phase)
+            std::lock_guard<std::mutex> Lock(UnbalancedRetSitesMutex);
             unbalancedRetSites.insert(retSiteC);
           }
         }
@@ -1122,6 +2721,20 @@ protected:
     return d5;
   }
 
+  /**
+   * Applies the given flow function to the fact d. Identity and kill-all flow
+   * functions are not applied at all.
+   */
+  static FFSet<D> applyFlowFunction(FlowFunction<D> &flowFunction, D d) {
+    FFSet<D> targets;
+    if (flowFunction.isIdentity()) {
+      targets.push_back(d);
+    } else if (!flowFunction.isKillAll()) {
+      flowFunction.computeTargetsInto(d, targets);
+    }
+    return targets;
+  }
+
   /**
    * Computes the normal flow function for the given set of start and end
    * abstractions-
@@ -1130,18 +2743,18 @@ protected:
    * @param d2 The abstraction at the current node
    * @return The set of abstractions at the successor node
    */
-  std::set<D>
+  FFSet<D>
   computeNormalFlowFunction(std::shared_ptr<FlowFunction<D>> flowFunction, D d1,
                             D d2) {
-    return flowFunction->computeTargets(d2);
+    return applyFlowFunction(*flowFunction, d2);
   }
 
   /**
    * TODO: comment
    */
-  std::set<D> computeSummaryFlowFunction(
+  FFSet<D> computeSummaryFlowFunction(
       std::shared_ptr<FlowFunction<D>> SummaryFlowFunction, D d1, D d2) {
-    return SummaryFlowFunction->computeTargets(d2);
+    return applyFlowFunction(*SummaryFlowFunction, d2);
   }
 
   /**
@@ -1151,10 +2764,10 @@ protected:
    * @param d2 The abstraction at the call site
    * @return The set of caller-side abstractions at the callee's start node
    */
-  std::set<D>
+  FFSet<D>
   computeCallFlowFunction(std::shared_ptr<FlowFunction<D>> callFlowFunction,
                           D d1, D d2) {
-    return callFlowFunction->computeTargets(d2);
+    return applyFlowFunction(*callFlowFunction, d2);
   }
 
   /**
@@ -1166,9 +2779,9 @@ protected:
    * @param d2 The abstraction at the call site
    * @return The set of caller-side abstractions at the return site
    */
-  std::set<D> computeCallToReturnFlowFunction(
+  FFSet<D> computeCallToReturnFlowFunction(
       std::shared_ptr<FlowFunction<D>> callToReturnFlowFunction, D d1, D d2) {
-    return callToReturnFlowFunction->computeTargets(d2);
+    return applyFlowFunction(*callToReturnFlowFunction, d2);
   }
 
   /**
@@ -1181,16 +2794,17 @@ protected:
    * @param callerSideDs The abstractions at the call site
    * @return The set of caller-side abstractions at the return site
    */
-  std::set<D>
+  FFSet<D>
   computeReturnFlowFunction(std::shared_ptr<FlowFunction<D>> retFunction, D d1,
                             D d2, N callSite, std::set<D> callerSideDs) {
-    return retFunction->computeTargets(d2);
+    return applyFlowFunction(*retFunction, d2);
   }
 
   /**
    * Propagates the flow further down the exploded super graph, merging any edge
    * function that might already have been computed for targetVal at
-   * target.
+   * target. If the jump function changes, the respective path edge is
+   * scheduled on the worklist rather than being processed right away.
    *
    * @param sourceVal the source value of the propagated summary edge
    * @param target the target statement
@@ -1224,16 +2838,17 @@ protected:
                   << "Edge function : " << f.get()->str()
                   << " (result of previous compose)");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-    std::shared_ptr<EdgeFunction<V>> jumpFnE = nullptr;
+    // the jump function must be joined with the one of an evicted method
+    restoreProcedure(icfg.getMethodOf(target));
+    // the jump function is initialized to all-top; looking it up, joining and
+    // recording the result happens atomically, such that concurrent updates
+    // of the same jump function cannot get lost
+    std::shared_ptr<EdgeFunction<V>> jumpFnE;
     std::shared_ptr<EdgeFunction<V>> fPrime;
-    if (!jumpFn->reverseLookup(target, targetVal).empty()) {
-      jumpFnE = jumpFn->reverseLookup(target, targetVal)[sourceVal];
-    }
-    if (jumpFnE == nullptr) {
-      jumpFnE = allTop; // jump function is initialized to all-top
-    }
-    fPrime = jumpFnE->joinWith(f);
-    bool newFunction = !(fPrime->equal_to(jumpFnE));
+    std::tie(jumpFnE, fPrime) =
+        jumpFn->joinFunction(sourceVal, target, targetVal, f);
+    // canonical edge functions are identical if they are equal
+    bool newFunction = fPrime != jumpFnE && !fPrime->equal_to(jumpFnE);
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "Join: " << jumpFnE->str() << " & " << f.get()->str()
                   << (jumpFnE->equal_to(f) ? " (EF's are equal)" : " "));
@@ -1242,10 +2857,7 @@ protected:
                   << (newFunction ? " (new jump func)" : " "));
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
     if (newFunction) {
-      jumpFn->addFunction(sourceVal, target, targetVal, fPrime);
-      PathEdge<N, D> edge(sourceVal, target, targetVal);
-      PathEdgeCount++;
-      pathEdgeProcessingTask(edge);
+      schedulePathEdge(PathEdge<N, D>(sourceVal, target, targetVal));
       if (!ideTabulationProblem.isZeroValue(targetVal)) {
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "EDGE: <F: " << target->getFunction()->getName().str()
@@ -1279,26 +2891,64 @@ protected:
         fSummaryReuse[key] += 1;
       }
     }
-    return endsummarytab.get(sP, d3).cellSet();
+    std::set<typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>
+        summaries;
+    if (auto *exits = endsummarytab.find(sP, d3)) {
+      for (auto &exitAndFunction : *exits) {
+        summaries.emplace(nodeIds.get(firstIdOf(exitAndFunction.first)),
+                          factIds.get(secondIdOf(exitAndFunction.first)),
+                          exitAndFunction.second);
+      }
+    }
+    return summaries;
+  }
+
+  /**
+   * Returns the facts at the exit points of all end summaries that have been
+   * computed for the given start point and fact.
+   */
+  virtual std::set<D> endSummaryFacts(N sP, D d3) {
+    std::set<D> facts;
+    if (auto *exits = endsummarytab.find(sP, d3)) {
+      for (auto &exitAndFunction : *exits) {
+        facts.insert(factIds.get(secondIdOf(exitAndFunction.first)));
+      }
+    }
+    return facts;
+  }
+
+  /**
+   * Returns the given incoming edges as a mapping from call sites to the
+   * facts there.
+   */
+  std::map<N, std::set<D>>
+  callSitesOf(const FlatIdSet<std::uint64_t> &callSites) const {
+    std::map<N, std::set<D>> result;
+    for (auto callSite : callSites) {
+      result[nodeIds.get(firstIdOf(callSite))].insert(
+          factIds.get(secondIdOf(callSite)));
+    }
+    return result;
   }
 
   std::map<N, std::set<D>> incoming(D d1, N sP) {
-    return incomingtab.get(sP, d1);
+    return callSitesOf(incomingtab.get(sP, d1));
   }
 
   void addIncoming(N sP, D d3, N n, D d2) {
-    incomingtab.get(sP, d3)[n].insert(d2);
+    incomingtab.get(sP, d3).insert(
+        combineIds(nodeIds.getOrInsert(n), factIds.getOrInsert(d2)));
   }
 
   void printIncomingTab() {
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start of incomingtab entry");
-    for (auto cell : incomingtab.cellSet()) {
+    incomingtab.forEachCell([&](N sP, D d3, const auto &callSites) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "sP: " << ideTabulationProblem.NtoString(cell.r));
+                    << "sP: " << ideTabulationProblem.NtoString(sP));
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "d3: " << ideTabulationProblem.DtoString(cell.c));
-      for (auto entry : cell.v) {
+                    << "d3: " << ideTabulationProblem.DtoString(d3));
+      for (auto entry : callSitesOf(callSites)) {
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "  n: "
                       << ideTabulationProblem.NtoString(entry.first));
@@ -1308,7 +2958,7 @@ protected:
         }
       }
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "---------------");
-    }
+    });
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "End of incomingtab entry");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
   }
@@ -1316,25 +2966,27 @@ protected:
   void printEndSummaryTab() {
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start of endsummarytab entry");
-    for (auto cell : endsummarytab.cellVec()) {
+    endsummarytab.forEachCell([&](N sP, D d1, const auto &summaries) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "sP: " << ideTabulationProblem.NtoString(cell.r));
+                    << "sP: " << ideTabulationProblem.NtoString(sP));
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "d1: " << ideTabulationProblem.DtoString(cell.c));
-      for (auto inner_cell : cell.v.cellVec()) {
+                    << "d1: " << ideTabulationProblem.DtoString(d1));
+      for (auto &exitAndFunction : summaries) {
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "  eP: "
-                      << ideTabulationProblem.NtoString(inner_cell.r));
+                      << ideTabulationProblem.NtoString(
+                             nodeIds.get(firstIdOf(exitAndFunction.first))));
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "  d2: "
-                      << ideTabulationProblem.DtoString(inner_cell.c));
+                      << ideTabulationProblem.DtoString(
+                             factIds.get(secondIdOf(exitAndFunction.first))));
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "  EF: " << inner_cell.v->str());
+                      << "  EF: " << exitAndFunction.second->str());
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
       }
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "---------------");
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
-    }
+    });
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "End of endsummarytab entry");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
   }
@@ -1367,7 +3019,7 @@ protected:
      * Case 1: d1 in d2-Set
      * Case 2: d1 not in d2-Set, i.e. d1 was killed. d2-Set could be empty.
      */
-    for (auto cell : computedIntraPathEdges.cellSet()) {
+    for (auto cell : recordedEdges(computedIntraPathEdges).cellSet()) {
       auto Edge = std::make_pair(cell.r, cell.c);
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "N1: " << ideTabulationProblem.NtoString(Edge.first));
@@ -1409,7 +3061,7 @@ protected:
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "==============================================");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "INTER PATH EDGES");
-    for (auto cell : computedInterPathEdges.cellSet()) {
+    for (auto cell : recordedEdges(computedInterPathEdges).cellSet()) {
       auto Edge = std::make_pair(cell.r, cell.c);
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                     << "N1: " << ideTabulationProblem.NtoString(Edge.first));
@@ -1444,11 +3096,7 @@ protected:
             // Special case
             if (ProcessSummaryFacts.find(std::make_pair(Edge.second, D2)) !=
                 ProcessSummaryFacts.end()) {
-              std::multiset<D> SummaryDMultiSet =
-                  endsummarytab.get(Edge.second, D2).columnKeySet();
-              // remove duplicates from multiset
-              std::set<D> SummaryDSet(SummaryDMultiSet.begin(),
-                                      SummaryDMultiSet.end());
+              std::set<D> SummaryDSet = endSummaryFacts(Edge.second, D2);
               // Process summary just as an intra-procedural edge
               if (SummaryDSet.find(D2) != SummaryDSet.end()) {
                 genFacts += SummaryDSet.size() - 1;
@@ -17,19 +17,54 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IFDSSOLVER_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_IFDSSOLVER_H_
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/Value.h>
 
 #include <phasar/PhasarLLVM/IfdsIde/Solver/IDESolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdgeSet.h>
 #include <phasar/PhasarLLVM/Utils/BinaryDomain.h>
 
 namespace psr {
 
+/**
+ * Solves the given IFDSTabulationProblem. The IFDS problem is still presented
+ * to the IDESolver infrastructure as an IDE problem over the BinaryDomain,
+ * such that results are queried and exported in the same way, but the
+ * tabulation itself only tracks reachability: path edges are kept in a
+ * PathEdgeSet and no edge functions are queried, composed or joined. All
+ * facts that are reached by a path edge hold the value BOTTOM, which is
+ * exactly the value the edge functions of the IDE encoding would compute.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problem.
+ * @param <M> The type of objects used to represent methods.
+ * @param <I> The type of inter-procedural control-flow graph being used.
+ */
 template <typename N, typename D, typename M, typename I>
 class IFDSSolver : public IDESolver<N, D, M, BinaryDomain, I> {
 public:
   IFDSSolver(IFDSTabulationProblem<N, D, M, I> &ifdsProblem)
-      : IDESolver<N, D, M, BinaryDomain, I>(ifdsProblem) {
+      : IFDSSolver(ifdsProblem, ifdsProblem.solver_config) {}
+
+  /**
+   * Solves ifdsProblem with the given configuration instead of the problem's
+   * own one.
+   */
+  IFDSSolver(IFDSTabulationProblem<N, D, M, I> &ifdsProblem,
+             const SolverConfiguration &config)
+      : IDESolver<N, D, M, BinaryDomain, I>(ifdsProblem, config),
+        pathEdges(this->NumThreads),
+        sparsePropagation(HasSparsePropagation && config.sparsePropagation) {
     // std::cout << "IFDSSolver::IFDSSolver()" << std::endl;
     // std::cout << ifdsProblem.NtoString(getNthInstruction(
     // ifdsProblem.interproceduralCFG().getMethod("main"), 1))
@@ -46,6 +81,531 @@ public:
     }
     return keyset;
   }
+
+protected:
+  // path edges from the start points of a method to its nodes
+  PathEdgeSet<N, D> pathEdges;
+
+  // stores summaries that were queried before they were computed, i.e. the
+  // exit facts reachable from a fact at a start point; guarded by
+  // SummaryMutex
+  Table<N, D, std::map<N, std::set<D>>> endSummaries;
+
+  // sparse propagation needs to inspect the nodes' operands and the facts'
+  // types, which is only possible for the LLVM IR
+  static constexpr bool HasSparsePropagation =
+      std::is_same<N, const llvm::Instruction *>::value &&
+      std::is_same<D, const llvm::Value *>::value;
+
+  bool sparsePropagation;
+
+  /**
+   * Records the path edge (sourceVal, target, targetVal) and schedules it for
+   * processing unless it has been recorded before.
+   */
+  virtual void propagate(D sourceVal, N target, D targetVal) {
+    auto &lg = lg::get();
+    // the path edge must not be recorded in addition to the ones of an
+    // evicted method
+    this->restoreProcedure(this->icfg.getMethodOf(target));
+    if (!pathEdges.insert(sourceVal, target, targetVal)) {
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "PROPAGATE: No new edge!");
+      return;
+    }
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Propagate new edge: <"
+                  << this->ideTabulationProblem.DtoString(sourceVal) << "> -> <"
+                  << this->ideTabulationProblem.NtoString(target) << ", "
+                  << this->ideTabulationProblem.DtoString(targetVal) << ">");
+    this->schedulePathEdge(PathEdge<N, D>(sourceVal, target, targetVal));
+  }
+
+  void seedPathEdges() override {
+    auto &lg = lg::get();
+    PAMM_GET_INSTANCE;
+    for (const auto &seed : this->initialSeeds) {
+      N startPoint = seed.first;
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "Start point: "
+                    << this->ideTabulationProblem.NtoString(startPoint));
+      for (const D &value : seed.second) {
+        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                      << "      Value: "
+                      << this->ideTabulationProblem.DtoString(value));
+        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
+        if (!this->ideTabulationProblem.isZeroValue(value)) {
+          INC_COUNTER("Gen facts", 1, PAMM_SEVERITY_LEVEL::Core);
+        }
+        propagate(this->zeroValue, startPoint, value);
+      }
+      // the zero value holds at every seed, but is not processed from there
+      // unless it is part of the seed itself
+      pathEdges.insert(this->zeroValue, startPoint, this->zeroValue);
+    }
+  }
+
+  void addSeed(N n, D value) override {
+    this->initialSeeds[n].insert(value);
+    propagate(this->zeroValue, n, value);
+    pathEdges.insert(this->zeroValue, n, this->zeroValue);
+  }
+
+  void addSummaryContext(N sP, D d3) override {
+    {
+      std::lock_guard<std::mutex> Lock(this->SummaryMutex);
+      this->incomingtab.get(sP, d3);
+    }
+    propagate(d3, sP, d3);
+  }
+
+  // path edges take the place of jump functions
+  std::size_t numJumpFunctions() override { return pathEdges.size(); }
+
+  /**
+   * Every fact that is the target of a path edge is reachable from a seed,
+   * hence its value is BOTTOM. TOP is the implicit default value.
+   */
+  void computeValues() override {
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Start computing values");
+    for (auto &seed : this->initialSeeds) {
+      for (D d : seed.second) {
+        this->valtab.insert(seed.first, d, BinaryDomain::BOTTOM);
+      }
+    }
+    for (N unbalancedRetSite : this->unbalancedRetSites) {
+      this->valtab.insert(unbalancedRetSite, this->zeroValue,
+                          BinaryDomain::BOTTOM);
+    }
+    pathEdges.forEachTarget([this](N n, D d) {
+      this->valtab.insert(n, d, BinaryDomain::BOTTOM);
+    });
+    this->forEachSpilledJumpFunction(
+        [this](N n, D, D d,
+               const std::shared_ptr<EdgeFunction<BinaryDomain>> &) {
+          this->valtab.insert(n, d, BinaryDomain::BOTTOM);
+        });
+  }
+
+  /**
+   * The values of the IFDS solver do not depend on the path edges' sources,
+   * hence finished procedures can be evicted even if values are computed.
+   */
+  bool evictsFinishedProcedures() override {
+    return this->evictFinishedProcedures && this->NumThreads <= 1;
+  }
+
+  using SpilledEntry =
+      typename IDESolver<N, D, M, BinaryDomain, I>::SpilledEntry;
+
+  /**
+   * Drops the path edges at n. The facts reached at n are recorded as values
+   * right away.
+   */
+  std::size_t dropJumpFunctionsAt(N n) override {
+    return pathEdges.removeEdgesAt(n, [this, n](D, D d) {
+      if (this->computevalues) {
+        this->valtab.insert(n, d, BinaryDomain::BOTTOM);
+      }
+    });
+  }
+
+  // path edges take the place of jump functions
+  std::size_t spillJumpFunctionsAt(N n) override {
+    return pathEdges.removeEdgesAt(n, [this, n](D sourceVal, D targetVal) {
+      this->spill(SpilledEntry{SpilledEntry::Kind::JumpFunction, n, sourceVal,
+                               n, targetVal, 0});
+    });
+  }
+
+  void spillEndSummaries(N sP) override {
+    if (!endSummaries.containsRow(sP)) {
+      return;
+    }
+    for (auto &d1AndSummaries : endSummaries.row(sP)) {
+      for (auto &ePAndFacts : d1AndSummaries.second) {
+        for (D d2 : ePAndFacts.second) {
+          this->spill(SpilledEntry{SpilledEntry::Kind::EndSummary, sP,
+                                   d1AndSummaries.first, ePAndFacts.first, d2,
+                                   0});
+          --this->NumEndSummaries;
+        }
+      }
+    }
+    endSummaries.remove(sP);
+  }
+
+  void restoreSpilledEntry(const SpilledEntry &entry) override {
+    switch (entry.kind) {
+    case SpilledEntry::Kind::JumpFunction:
+      pathEdges.insert(entry.SourceVal, entry.Node, entry.TargetVal);
+      break;
+    case SpilledEntry::Kind::EndSummary:
+      addEndSummary(entry.Node, entry.SourceVal, entry.Target,
+                    entry.TargetVal);
+      break;
+    default:
+      IDESolver<N, D, M, BinaryDomain, I>::restoreSpilledEntry(entry);
+    }
+  }
+
+  void processCall(PathEdge<N, D> edge) override {
+    PAMM_GET_INSTANCE;
+    INC_COUNTER("Process Call", 1, PAMM_SEVERITY_LEVEL::Full);
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Process call at target: "
+                  << this->ideTabulationProblem.NtoString(edge.getTarget()));
+    D d1 = edge.factAtSource();
+    N n = edge.getTarget();
+    D d2 = edge.factAtTarget();
+    std::set<N> returnSiteNs = this->icfg.getReturnSitesOfCallAt(n);
+    std::set<M> callees = this->icfg.getCalleesOfCallAt(n);
+    for (M sCalledProcN : callees) {
+      // check if a special summary for the called procedure exists
+      std::shared_ptr<FlowFunction<D>> specialSum =
+          this->cachedFlowEdgeFunctions.getSummaryFlowFunction(n,
+                                                               sCalledProcN);
+      if (specialSum) {
+        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                      << "Found and process special summary");
+        for (N returnSiteN : returnSiteNs) {
+          FFSet<D> res =
+              this->computeSummaryFlowFunction(specialSum, d1, d2);
+          INC_COUNTER("SpecialSummary-FF Application", 1,
+                      PAMM_SEVERITY_LEVEL::Full);
+          ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
+                           PAMM_SEVERITY_LEVEL::Full);
+          this->saveEdges(n, returnSiteN, d2, res, false);
+          for (D d3 : res) {
+            propagate(d1, returnSiteN, d3);
+          }
+        }
+      } else {
+        std::shared_ptr<FlowFunction<D>> function =
+            this->cachedFlowEdgeFunctions.getCallFlowFunction(n,
+                                                              sCalledProcN);
+        INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
+        FFSet<D> res = this->computeCallFlowFunction(function, d1, d2);
+        ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
+                         PAMM_SEVERITY_LEVEL::Full);
+        // the callee's summaries and incoming edges are updated below
+        this->restoreProcedure(sCalledProcN);
+        // if startPointsOf is empty, the called function is a declaration
+        for (N sP : this->icfg.getStartPointsOf(sCalledProcN)) {
+          this->saveEdges(n, sP, d2, res, true);
+          for (D d3 : res) {
+            // create initial self-loop, unless the callee's summaries for d3
+            // are known from a previous analysis run
+            if (!this->reusePersistedSummary(sCalledProcN, sP, d3)) {
+              propagate(d3, sP, d3);
+            }
+            std::map<N, std::set<D>> endSumm;
+            {
+              // see IDESolver::processCall() for why registering the incoming
+              // edge and querying the end summaries must not interleave with
+              // processExit()
+              std::lock_guard<std::mutex> Lock(this->SummaryMutex);
+              this->addIncoming(sP, d3, n, d2);
+              endSumm = endSummary(sP, d3);
+            }
+            // apply the summaries that have already been computed for <sP,d3>
+            for (auto &entry : endSumm) {
+              N eP = entry.first;
+              for (D d4 : entry.second) {
+                for (N retSiteN : returnSiteNs) {
+                  std::shared_ptr<FlowFunction<D>> retFunction =
+                      this->cachedFlowEdgeFunctions.getRetFlowFunction(
+                          n, sCalledProcN, eP, retSiteN);
+                  INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
+                  FFSet<D> returnedFacts = this->computeReturnFlowFunction(
+                      retFunction, d3, d4, n, std::set<D>{d2});
+                  ADD_TO_HISTOGRAM("Data-flow facts", returnedFacts.size(), 1,
+                                   PAMM_SEVERITY_LEVEL::Full);
+                  this->saveEdges(eP, retSiteN, d4, returnedFacts, true);
+                  for (D d5 : returnedFacts) {
+                    propagate(d1, retSiteN,
+                              this->restoreContextOnReturnedFact(n, d2, d5));
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+      // process intra-procedural flows along call-to-return flow functions
+      for (N returnSiteN : returnSiteNs) {
+        std::shared_ptr<FlowFunction<D>> callToReturnFlowFunction =
+            this->cachedFlowEdgeFunctions.getCallToRetFlowFunction(
+                n, returnSiteN, callees);
+        INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
+        FFSet<D> returnFacts = this->computeCallToReturnFlowFunction(
+            callToReturnFlowFunction, d1, d2);
+        ADD_TO_HISTOGRAM("Data-flow facts", returnFacts.size(), 1,
+                         PAMM_SEVERITY_LEVEL::Full);
+        this->saveEdges(n, returnSiteN, d2, returnFacts, false);
+        for (D d3 : returnFacts) {
+          propagate(d1, returnSiteN, d3);
+        }
+      }
+    }
+  }
+
+  void processNormalFlow(PathEdge<N, D> edge) override {
+    PAMM_GET_INSTANCE;
+    INC_COUNTER("Process Normal", 1, PAMM_SEVERITY_LEVEL::Full);
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Process normal at target: "
+                  << this->ideTabulationProblem.NtoString(edge.getTarget()));
+    D d1 = edge.factAtSource();
+    N n = edge.getTarget();
+    D d2 = edge.factAtTarget();
+    for (N m : getSuccsOfRef(this->icfg, n)) {
+      std::shared_ptr<FlowFunction<D>> flowFunction =
+          this->cachedFlowEdgeFunctions.getNormalFlowFunction(n, m);
+      INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
+      FFSet<D> res = this->computeNormalFlowFunction(flowFunction, d1, d2);
+      ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
+                       PAMM_SEVERITY_LEVEL::Full);
+      this->saveEdges(n, m, d2, res, false);
+      for (D d3 : res) {
+        propagateSparse(d1, m, d3);
+      }
+    }
+  }
+
+  static bool usesValue(const llvm::User *U, const llvm::Value *V) {
+    for (const llvm::Use &Op : U->operands()) {
+      if (Op.get() == V) {
+        return true;
+      }
+      // facts may be referred to through constant expressions
+      if (auto CE = llvm::dyn_cast<llvm::ConstantExpr>(Op.get())) {
+        if (usesValue(CE, V)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Returns true if n is a node that cannot affect the fact d, such that the
+   * normal flow function of n maps d to itself. This is assumed for every
+   * node that neither defines nor uses d and, if d is a memory location,
+   * does not access memory, which may happen through an alias of d. Call
+   * sites and exit points are never skipped, nor is the zero value.
+   */
+  bool isTransparentFor(N n, D d) {
+    if constexpr (HasSparsePropagation) {
+      if (n == d || this->ideTabulationProblem.isZeroValue(d) ||
+          this->icfg.isCallStmt(n) || this->icfg.isExitStmt(n)) {
+        return false;
+      }
+      if (d->getType()->isPointerTy() && n->mayReadOrWriteMemory()) {
+        return false;
+      }
+      return !usesValue(n, d);
+    } else {
+      return false;
+    }
+  }
+
+  /**
+   * Propagates the path edge (sourceVal, target, targetVal). With sparse
+   * propagation, the edge skips the chain of nodes starting at target whose
+   * normal flow functions pass targetVal through unchanged and that have a
+   * single successor: the path edges to the skipped nodes are recorded, so
+   * that results are the same as with dense propagation, but they are not
+   * processed.
+   */
+  void propagateSparse(D sourceVal, N target, D targetVal) {
+    PAMM_GET_INSTANCE;
+    std::size_t numSkipped = 0;
+    while (sparsePropagation && isTransparentFor(target, targetVal)) {
+      auto succs = getSuccsOfRef(this->icfg, target);
+      if (succs.size() != 1) {
+        break;
+      }
+      // the remainder of the chain has been handled before
+      if (!pathEdges.insert(sourceVal, target, targetVal)) {
+        INC_COUNTER("Sparse Skips", numSkipped, PAMM_SEVERITY_LEVEL::Full);
+        return;
+      }
+      ++numSkipped;
+      target = succs.front();
+    }
+    INC_COUNTER("Sparse Skips", numSkipped, PAMM_SEVERITY_LEVEL::Full);
+    propagate(sourceVal, target, targetVal);
+  }
+
+  void processExit(PathEdge<N, D> edge) override {
+    PAMM_GET_INSTANCE;
+    INC_COUNTER("Process Exit", 1, PAMM_SEVERITY_LEVEL::Full);
+    auto &lg = lg::get();
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Process exit at target: "
+                  << this->ideTabulationProblem.NtoString(edge.getTarget()));
+    N n = edge.getTarget();
+    M methodThatNeedsSummary = this->icfg.getMethodOf(n);
+    D d1 = edge.factAtSource();
+    D d2 = edge.factAtTarget();
+    std::map<N, std::set<D>> inc;
+    {
+      // see processCall() for the counterpart
+      std::lock_guard<std::mutex> Lock(this->SummaryMutex);
+      for (N sP : this->icfg.getStartPointsOf(methodThatNeedsSummary)) {
+        if (endSummaries.get(sP, d1)[n].insert(d2).second) {
+          ++this->NumEndSummaries;
+        }
+        for (auto &entry : this->incoming(d1, sP)) {
+          inc[entry.first].insert(entry.second.begin(), entry.second.end());
+        }
+      }
+    }
+    // for each incoming call edge already processed
+    for (auto &entry : inc) {
+      N c = entry.first;
+      for (N retSiteC : this->icfg.getReturnSitesOfCallAt(c)) {
+        std::shared_ptr<FlowFunction<D>> retFunction =
+            this->cachedFlowEdgeFunctions.getRetFlowFunction(
+                c, methodThatNeedsSummary, n, retSiteC);
+        INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
+        // the returned facts do not depend on the incoming-call value
+        FFSet<D> targets = this->computeReturnFlowFunction(
+            retFunction, d1, d2, c, entry.second);
+        ADD_TO_HISTOGRAM("Data-flow facts", targets.size(), 1,
+                         PAMM_SEVERITY_LEVEL::Full);
+        this->saveEdges(n, retSiteC, d2, targets, true);
+        for (D d4 : entry.second) {
+          // for each path edge coming into the call, propagate to the return
+          // site
+          for (D d3 : pathEdges.sourcesOf(c, d4)) {
+            for (D d5 : targets) {
+              propagate(d3, retSiteC,
+                        this->restoreContextOnReturnedFact(c, d4, d5));
+            }
+          }
+        }
+      }
+    }
+    // handling for unbalanced problems, see IDESolver::processExit()
+    if (this->followReturnPastSeeds && inc.empty() &&
+        this->ideTabulationProblem.isZeroValue(d1)) {
+      std::set<N> callers = this->icfg.getCallersOf(methodThatNeedsSummary);
+      for (N c : callers) {
+        for (N retSiteC : this->icfg.getReturnSitesOfCallAt(c)) {
+          std::shared_ptr<FlowFunction<D>> retFunction =
+              this->cachedFlowEdgeFunctions.getRetFlowFunction(
+                  c, methodThatNeedsSummary, n, retSiteC);
+          INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
+          FFSet<D> targets = this->computeReturnFlowFunction(
+              retFunction, d1, d2, c, std::set<D>{this->zeroValue});
+          ADD_TO_HISTOGRAM("Data-flow facts", targets.size(), 1,
+                           PAMM_SEVERITY_LEVEL::Full);
+          this->saveEdges(n, retSiteC, d2, targets, true);
+          for (D d5 : targets) {
+            propagate(this->zeroValue, retSiteC, d5);
+            std::lock_guard<std::mutex> Lock(this->UnbalancedRetSitesMutex);
+            this->unbalancedRetSites.insert(retSiteC);
+          }
+        }
+      }
+      // call the return flow function with a null caller for its side
+      // effects, see IDESolver::processExit()
+      if (callers.empty()) {
+        std::shared_ptr<FlowFunction<D>> retFunction =
+            this->cachedFlowEdgeFunctions.getRetFlowFunction(
+                nullptr, methodThatNeedsSummary, n, nullptr);
+        INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
+        retFunction->computeTargets(d2);
+      }
+    }
+  }
+
+  /**
+   * Returns a copy of the end summaries of <sP,d3>. Expects SummaryMutex to
+   * be held by the caller.
+   */
+  std::map<N, std::set<D>> endSummary(N sP, D d3) {
+    if (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Core) {
+      auto inserted =
+          this->fSummaryReuse.try_emplace(std::make_pair(sP, d3), 0);
+      if (!inserted.second) {
+        ++inserted.first->second;
+      }
+    }
+    auto *summaries = endSummaries.find(sP, d3);
+    return summaries ? *summaries : std::map<N, std::set<D>>();
+  }
+
+  void addEndSummary(N sP, D d3, N eP, D d4) override {
+    if (endSummaries.get(sP, d3)[eP].insert(d4).second) {
+      ++this->NumEndSummaries;
+    }
+  }
+
+  // the persisted path edges carry all results of a reused method
+  bool reusesPersistedSummaries() override {
+    return !this->ideTabulationProblem.hasFlowFunctionSideEffects();
+  }
+
+  /**
+   * Inserts the persisted path edges, the ones that lead to call sites are
+   * processed again such that the callees are entered as in a full run.
+   */
+  bool restorePersistedPathEdges(
+      D d3, const std::vector<std::pair<N, D>> *reached) override {
+    if (!reached) {
+      return false;
+    }
+    for (auto &nodeAndFact : *reached) {
+      if (pathEdges.insert(d3, nodeAndFact.first, nodeAndFact.second) &&
+          this->icfg.isCallStmt(nodeAndFact.first)) {
+        this->schedulePathEdge(
+            PathEdge<N, D>(d3, nodeAndFact.first, nodeAndFact.second));
+      }
+    }
+    return true;
+  }
+
+  bool collectPersistablePathEdges(
+      Table<M, D, std::map<N, std::set<D>>> &reached) override {
+    // dropped path edges are lost
+    if (evictsFinishedProcedures() && !this->SpillsProcedures) {
+      return false;
+    }
+    auto addPathEdge = [this, &reached](D sourceVal, N target, D targetVal) {
+      reached.get(this->icfg.getMethodOf(target), sourceVal)[target].insert(
+          targetVal);
+    };
+    pathEdges.forEachEdge(addPathEdge);
+    this->forEachSpilledJumpFunction(
+        [&addPathEdge](N target, D sourceVal, D targetVal,
+                       const std::shared_ptr<EdgeFunction<BinaryDomain>> &) {
+          addPathEdge(sourceVal, target, targetVal);
+        });
+    return true;
+  }
+
+  bool getPersistableEndSummary(N sP, D d3,
+                                std::map<N, std::set<D>> &exits) override {
+    if (auto *summaries = endSummaries.find(sP, d3)) {
+      exits = *summaries;
+    }
+    return true;
+  }
+
+  std::set<D> endSummaryFacts(N sP, D d3) override {
+    std::set<D> facts;
+    if (auto *summaries = endSummaries.find(sP, d3)) {
+      for (auto &entry : *summaries) {
+        facts.insert(entry.second.begin(), entry.second.end());
+      }
+    }
+    return facts;
+  }
 };
 
 } // namespace psr
@@ -80,6 +80,14 @@ public:
 
   bool isZeroValue(D d) const override { return problem.isZeroValue(d); }
 
+  bool hasFlowFunctionSideEffects() const override {
+    return problem.hasFlowFunctionSideEffects();
+  }
+
+  bool dependsOnProcessingOrder() const override {
+    return problem.dependsOnProcessingOrder();
+  }
+
   BinaryDomain topElement() override { return BinaryDomain::TOP; }
 
   BinaryDomain bottomElement() override { return BinaryDomain::BOTTOM; }
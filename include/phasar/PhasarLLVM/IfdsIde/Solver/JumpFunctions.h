@@ -17,12 +17,22 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_JUMPFUNCTIONS_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_JUMPFUNCTIONS_H_
 
+#include <atomic>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionInterner.h>
+#include <phasar/Utils/FlatIdMap.h>
+#include <phasar/Utils/Interner.h>
 #include <phasar/Utils/LLVMShorthands.h>
 #include <phasar/Utils/Logger.h>
+#include <phasar/Utils/SnapshotView.h>
 #include <phasar/Utils/Table.h>
 
 namespace psr {
@@ -32,39 +42,260 @@ namespace psr {
 template <typename N, typename D, typename M, typename V, typename I>
 class IDETabulationProblem;
 
+/**
+ * Stores the jump functions computed by the IDESolver. Nodes and facts are
+ * referred to by their IDs in the solver's interners, and the jump functions
+ * are kept in FlatIdMaps from fact IDs to edge functions. The tables are
+ * split into shards by the target node of a jump function, each shard being
+ * guarded by its own mutex, such that the jump functions can be queried and
+ * updated by multiple threads at the same time; the interners must be
+ * synchronized then.
+ */
 template <typename N, typename D, typename M, typename L, typename I>
 class JumpFunctions {
+public:
+  using IdType = typename Interner<D>::IdType;
+  // mapping from the ID of a fact to an edge function
+  using FunctionMap = FlatIdMap<IdType, std::shared_ptr<EdgeFunction<L>>>;
+  using FactToFunctionMap =
+      std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>;
+
+  /**
+   * A read-only view of the jump functions from or to a single fact, which
+   * yields pairs of the other fact and the edge function. If the jump
+   * functions are shared between threads, the view holds a snapshot of them.
+   * Otherwise, it refers to the stored jump functions themselves; it then
+   * remains valid until the jump functions for the very same key are
+   * modified, adding jump functions for other keys does not invalidate it.
+   */
+  class FunctionsView {
+    SnapshotView<FunctionMap> Functions;
+    const Interner<D> *factIds;
+
+  public:
+    class iterator {
+      typename FunctionMap::const_iterator It;
+      const Interner<D> *factIds;
+
+    public:
+      iterator(typename FunctionMap::const_iterator It,
+               const Interner<D> *factIds)
+          : It(It), factIds(factIds) {}
+
+      std::pair<D, const std::shared_ptr<EdgeFunction<L>> &>
+      operator*() const {
+        return {factIds->get(It->first), It->second};
+      }
+
+      iterator &operator++() {
+        ++It;
+        return *this;
+      }
+
+      bool operator!=(const iterator &Other) const { return It != Other.It; }
+    };
+
+    FunctionsView(const FunctionMap *Functions, bool TakeSnapshot,
+                  const Interner<D> &factIds)
+        : Functions(Functions, TakeSnapshot), factIds(&factIds) {}
+
+    iterator begin() const { return iterator(Functions.begin(), factIds); }
+
+    iterator end() const { return iterator(Functions.end(), factIds); }
+
+    std::size_t size() const { return Functions->size(); }
+
+    bool empty() const { return Functions->empty(); }
+  };
+
+  /**
+   * A read-only view of the jump functions that lead to a single node, which
+   * yields pairs of a source fact and a FunctionsView of the target facts.
+   * It takes a snapshot and stays valid like a FunctionsView.
+   */
+  class TargetView {
+    struct Snapshot {
+      FlatIdMap<IdType, IdType> forward;
+      std::deque<FunctionMap> maps;
+    };
+    std::unique_ptr<const Snapshot> snapshot;
+    const FlatIdMap<IdType, IdType> *forward;
+    const std::deque<FunctionMap> *maps;
+    const Interner<D> *factIds;
+
+    static const FlatIdMap<IdType, IdType> &emptyForward() {
+      static const FlatIdMap<IdType, IdType> Empty;
+      return Empty;
+    }
+
+  public:
+    class iterator {
+      typename FlatIdMap<IdType, IdType>::const_iterator It;
+      const TargetView *View;
+
+    public:
+      iterator(typename FlatIdMap<IdType, IdType>::const_iterator It,
+               const TargetView *View)
+          : It(It), View(View) {}
+
+      std::pair<D, FunctionsView> operator*() const {
+        return {View->factIds->get(It->first),
+                FunctionsView(&(*View->maps)[It->second], false,
+                              *View->factIds)};
+      }
+
+      iterator &operator++() {
+        ++It;
+        return *this;
+      }
+
+      bool operator!=(const iterator &Other) const { return It != Other.It; }
+    };
+
+    TargetView(const FlatIdMap<IdType, IdType> *forward,
+               const std::deque<FunctionMap> *maps, bool TakeSnapshot,
+               const Interner<D> &factIds)
+        : forward(forward ? forward : &emptyForward()), maps(maps),
+          factIds(&factIds) {
+      if (TakeSnapshot && forward) {
+        auto copy = std::make_unique<Snapshot>();
+        for (auto &sourceAndMap : *forward) {
+          copy->forward[sourceAndMap.first] = copy->maps.size();
+          copy->maps.push_back((*maps)[sourceAndMap.second]);
+        }
+        this->forward = &copy->forward;
+        this->maps = &copy->maps;
+        snapshot = std::move(copy);
+      }
+    }
+
+    iterator begin() const { return iterator(forward->begin(), this); }
+
+    iterator end() const { return iterator(forward->end(), this); }
+  };
+
 private:
   std::shared_ptr<EdgeFunction<L>> allTop;
   const IDETabulationProblem<N, D, M, L, I> &problem;
+  // the IDs of target nodes and facts, shared with the solver's tables
+  Interner<N> &nodeIds;
+  Interner<D> &factIds;
+  // views must take snapshots if the jump functions are shared between threads
+  bool concurrent;
+  // if set, joins are memoized and yield canonical edge functions
+  EdgeFunctionInterner<L> *interner;
+  // the number of jump functions, kept up to date such that it can be
+  // queried without locking all shards
+  std::atomic<std::size_t> numFunctions{0};
 
 protected:
-  // mapping from target node and value to a list of all source values and
-  // associated functions where the list is implemented as a mapping from
-  // the source value to the function we exclude empty default functions
-  Table<N, D, std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>>
-      nonEmptyReverseLookup;
-  // mapping from source value and target node to a list of all target values
-  // and associated functions where the list is implemented as a mapping from
-  // the source value to the function we exclude empty default functions
-  Table<D, N, std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>>
-      nonEmptyForwardLookup;
-  // a mapping from target node to a list of triples consisting of source value,
-  // target value and associated function; the triple is implemented by a table
-  // we exclude empty default functions
-  std::unordered_map<N, Table<D, D, std::shared_ptr<EdgeFunction<L>>>>
-      nonEmptyLookupByTargetNode;
+  // the jump functions that lead to a single target node, we exclude empty
+  // default functions; the maps are referred to by their index in
+  // Shard::maps
+  struct NodeEntry {
+    // mapping from target value to a list of all source values and
+    // associated functions where the list is implemented as a mapping from
+    // the source value to the function
+    FlatIdMap<IdType, IdType> reverse;
+    // mapping from source value to a list of all target values and
+    // associated functions where the list is implemented as a mapping from
+    // the target value to the function; this also serves the lookups by
+    // target node
+    FlatIdMap<IdType, IdType> forward;
+  };
+
+  struct Shard {
+    std::mutex Mutex;
+    // the node with ID id is the entry id / numShards of the shard
+    // id % numShards; deques keep the entries and maps in place as they are
+    // added, which views rely on
+    std::deque<NodeEntry> nodes;
+    std::deque<FunctionMap> maps;
+    // maps that have been released by removeFunctionsAt()
+    std::vector<IdType> freeMaps;
+
+    NodeEntry &getOrInsertNode(IdType index) {
+      if (index >= nodes.size()) {
+        nodes.resize(index + 1);
+      }
+      return nodes[index];
+    }
+
+    NodeEntry *findNode(IdType index) {
+      return index < nodes.size() ? &nodes[index] : nullptr;
+    }
+
+    FunctionMap &getOrInsertMap(FlatIdMap<IdType, IdType> &factToMap,
+                                IdType fact) {
+      auto slot = factToMap.tryEmplace(fact);
+      if (slot.second) {
+        if (freeMaps.empty()) {
+          *slot.first = maps.size();
+          maps.emplace_back();
+        } else {
+          *slot.first = freeMaps.back();
+          freeMaps.pop_back();
+        }
+      }
+      return maps[*slot.first];
+    }
+
+    FunctionMap *findMap(const FlatIdMap<IdType, IdType> &factToMap,
+                         IdType fact) {
+      auto *index = factToMap.find(fact);
+      return index ? &maps[*index] : nullptr;
+    }
+
+    void releaseMaps(FlatIdMap<IdType, IdType> &factToMap) {
+      for (auto &factAndMap : factToMap) {
+        maps[factAndMap.second].clear();
+        freeMaps.push_back(factAndMap.second);
+      }
+      factToMap.clear();
+    }
+  };
+
+  std::vector<std::unique_ptr<Shard>> shards;
+
+  Shard &getShard(IdType target) { return *shards[target % shards.size()]; }
+
+  IdType indexInShard(IdType target) const { return target / shards.size(); }
+
+  // returns the entry of the target node, or nullptr if no jump function
+  // has been added for it; expects the shard's mutex to be held
+  NodeEntry *findNode(Shard &S, IdType target) {
+    return S.findNode(indexInShard(target));
+  }
 
 public:
+  /**
+   * @param nodeIds, factIds the interners that assign IDs to nodes and facts,
+   * which must outlive the jump functions.
+   * @param numThreads the number of threads that access the jump functions;
+   * if it is larger than one, the tables are split into several
+   * independently locked shards and views are backed by snapshots.
+   * @param interner if not null, the edge functions are joined by means of
+   * the interner.
+   */
   JumpFunctions(std::shared_ptr<EdgeFunction<L>> allTop,
-                const IDETabulationProblem<N, D, M, L, I> &p)
-      : allTop(allTop), problem(p) {}
+                const IDETabulationProblem<N, D, M, L, I> &p,
+                Interner<N> &nodeIds, Interner<D> &factIds,
+                unsigned numThreads = 1,
+                EdgeFunctionInterner<L> *interner = nullptr)
+      : allTop(allTop), problem(p), nodeIds(nodeIds), factIds(factIds),
+        concurrent(numThreads > 1), interner(interner) {
+    // use more shards than threads to keep the contention low
+    unsigned numShards = concurrent ? 4 * numThreads : 1;
+    for (unsigned i = 0; i < numShards; ++i) {
+      shards.push_back(std::make_unique<Shard>());
+    }
+  }
 
   ~JumpFunctions() = default;
 
-  JumpFunctions(const JumpFunctions &JFs) = default;
+  JumpFunctions(const JumpFunctions &JFs) = delete;
 
-  JumpFunctions(JumpFunctions &&JFs) = default;
+  JumpFunctions(JumpFunctions &&JFs) = delete;
 
   /**
    * Records a jump function. The source statement is implicit.
@@ -83,34 +314,151 @@ public:
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "Edge Function  : " << function->str());
     // we do not store the default function (all-top)
-    if (function->equal_to(allTop)) {
-      return;
-    }
-    // it is important that existing values in JumpFunctions are overwritten
-    // (use operator[] instead of insert)
-    std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>> &sourceValToFunc =
-        nonEmptyReverseLookup.get(target, targetVal);
-    sourceValToFunc[sourceVal] = function;
-    std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>> &targetValToFunc =
-        nonEmptyForwardLookup.get(sourceVal, target);
-    targetValToFunc[targetVal] = function;
-    // V Table::insert(R r, C c, V v) always overrides (see comments above)
-    nonEmptyLookupByTargetNode[target].insert(sourceVal, targetVal, function);
+    if (!function->equal_to(allTop)) {
+      IdType sourceId = factIds.getOrInsert(sourceVal);
+      IdType targetId = nodeIds.getOrInsert(target);
+      IdType targetValId = factIds.getOrInsert(targetVal);
+      Shard &S = getShard(targetId);
+      std::lock_guard<std::mutex> Lock(S.Mutex);
+      NodeEntry &node = S.getOrInsertNode(indexInShard(targetId));
+      // it is important that existing values in JumpFunctions are overwritten
+      // (use operator[] instead of insert)
+      auto &slot = S.getOrInsertMap(node.reverse, targetValId)[sourceId];
+      if (!slot) {
+        ++numFunctions;
+      }
+      slot = function;
+      S.getOrInsertMap(node.forward, sourceId)[targetValId] = function;
+    }
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "End adding new jump function");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << ' ');
   }
 
+  /**
+   * Joins the given function with the jump function that is currently
+   * recorded for the given source value, target statement and target value
+   * (all-top if there is none) and records the result. Lookup, join and
+   * update are performed atomically with respect to other threads, and the
+   * reverse lookup table is probed only once: the slot for the source value
+   * is found or inserted in a single step and filled in place.
+   * The return value is the pair of the previous and the joined function.
+   */
+  std::pair<std::shared_ptr<EdgeFunction<L>>, std::shared_ptr<EdgeFunction<L>>>
+  joinFunction(D sourceVal, N target, D targetVal,
+               std::shared_ptr<EdgeFunction<L>> function) {
+    IdType sourceId = factIds.getOrInsert(sourceVal);
+    IdType targetId = nodeIds.getOrInsert(target);
+    IdType targetValId = factIds.getOrInsert(targetVal);
+    Shard &S = getShard(targetId);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    NodeEntry &node = S.getOrInsertNode(indexInShard(targetId));
+    FunctionMap &sourceValToFunc = S.getOrInsertMap(node.reverse, targetValId);
+    auto slot = sourceValToFunc.tryEmplace(sourceId);
+    std::shared_ptr<EdgeFunction<L>> previous =
+        slot.second ? allTop : *slot.first;
+    std::shared_ptr<EdgeFunction<L>> joined =
+        interner ? interner->join(previous, function)
+                 : previous->joinWith(function);
+    if (joined == previous || joined->equal_to(previous) ||
+        joined->equal_to(allTop)) {
+      // we do not store the default function (all-top)
+      if (slot.second) {
+        sourceValToFunc.erase(sourceId);
+      }
+    } else {
+      if (slot.second) {
+        ++numFunctions;
+      }
+      *slot.first = joined;
+      S.getOrInsertMap(node.forward, sourceId)[targetValId] = joined;
+    }
+    return std::make_pair(previous, joined);
+  }
+
+  /**
+   * Returns the jump function for the given source value, target statement
+   * and target value, or nullptr if there is none. In contrast to
+   * forwardLookup(), no container is copied.
+   */
+  std::shared_ptr<EdgeFunction<L>> findFunction(D sourceVal, N target,
+                                                D targetVal) {
+    auto sourceId = factIds.find(sourceVal);
+    auto targetId = nodeIds.find(target);
+    auto targetValId = factIds.find(targetVal);
+    if (!sourceId || !targetId || !targetValId) {
+      return nullptr;
+    }
+    Shard &S = getShard(*targetId);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    NodeEntry *node = findNode(S, *targetId);
+    FunctionMap *sourceValToFunc =
+        node ? S.findMap(node->reverse, *targetValId) : nullptr;
+    auto *function =
+        sourceValToFunc ? sourceValToFunc->find(*sourceId) : nullptr;
+    return function ? *function : nullptr;
+  }
+
+  /**
+   * Like reverseLookup(), but returns a view instead of a copy.
+   */
+  FunctionsView reverseLookupView(N target, D targetVal) {
+    auto targetId = nodeIds.find(target);
+    auto targetValId = factIds.find(targetVal);
+    if (!targetId || !targetValId) {
+      return FunctionsView(nullptr, false, factIds);
+    }
+    Shard &S = getShard(*targetId);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    NodeEntry *node = findNode(S, *targetId);
+    return FunctionsView(node ? S.findMap(node->reverse, *targetValId)
+                              : nullptr,
+                         concurrent, factIds);
+  }
+
+  /**
+   * Like forwardLookup(), but returns a view instead of a copy.
+   */
+  FunctionsView forwardLookupView(D sourceVal, N target) {
+    auto sourceId = factIds.find(sourceVal);
+    auto targetId = nodeIds.find(target);
+    if (!sourceId || !targetId) {
+      return FunctionsView(nullptr, false, factIds);
+    }
+    Shard &S = getShard(*targetId);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    NodeEntry *node = findNode(S, *targetId);
+    return FunctionsView(node ? S.findMap(node->forward, *sourceId) : nullptr,
+                         concurrent, factIds);
+  }
+
+  /**
+   * Like lookupByTarget(), but returns a view instead of a copy. The view
+   * yields each source value along with a view of the target values and
+   * functions.
+   */
+  TargetView lookupByTargetView(N target) {
+    auto targetId = nodeIds.find(target);
+    if (!targetId) {
+      return TargetView(nullptr, nullptr, false, factIds);
+    }
+    Shard &S = getShard(*targetId);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    NodeEntry *node = findNode(S, *targetId);
+    return TargetView(node ? &node->forward : nullptr, &S.maps, concurrent,
+                      factIds);
+  }
+
   /**
    * Returns, for a given target statement and value all associated
    * source values, and for each the associated edge function.
    * The return value is a mapping from source value to function.
    */
-  std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>
-  reverseLookup(N target, D targetVal) {
-    if (!nonEmptyReverseLookup.contains(target, targetVal))
-      return std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>{};
-    else
-      return nonEmptyReverseLookup.get(target, targetVal);
+  FactToFunctionMap reverseLookup(N target, D targetVal) {
+    FactToFunctionMap result;
+    for (auto sourceValAndFunc : reverseLookupView(target, targetVal)) {
+      result.emplace(sourceValAndFunc.first, sourceValAndFunc.second);
+    }
+    return result;
   }
 
   /**
@@ -118,12 +466,12 @@ public:
    * associated target values, and for each the associated edge function.
    * The return value is a mapping from target value to function.
    */
-  std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>
-  forwardLookup(D sourceVal, N target) {
-    if (!nonEmptyForwardLookup.contains(sourceVal, target))
-      return std::unordered_map<D, std::shared_ptr<EdgeFunction<L>>>{};
-    else
-      return nonEmptyForwardLookup.get(sourceVal, target);
+  FactToFunctionMap forwardLookup(D sourceVal, N target) {
+    FactToFunctionMap result;
+    for (auto targetValAndFunc : forwardLookupView(sourceVal, target)) {
+      result.emplace(targetValAndFunc.first, targetValAndFunc.second);
+    }
+    return result;
   }
 
   /**
@@ -133,7 +481,14 @@ public:
    * (sourceVal,targetVal,edgeFunction).
    */
   Table<D, D, std::shared_ptr<EdgeFunction<L>>> lookupByTarget(N target) {
-    return nonEmptyLookupByTargetNode[target];
+    Table<D, D, std::shared_ptr<EdgeFunction<L>>> result;
+    for (auto sourceValAndFuncs : lookupByTargetView(target)) {
+      for (auto targetValAndFunc : sourceValAndFuncs.second) {
+        result.insert(sourceValAndFuncs.first, targetValAndFunc.first,
+                      targetValAndFunc.second);
+      }
+    }
+    return result;
   }
 
   /**
@@ -143,50 +498,132 @@ public:
    * there anyway.
    */
   bool removeFunction(D sourceVal, N target, D targetVal) {
-    nonEmptyReverseLookup.get(target, targetVal).erase(sourceVal);
-    nonEmptyForwardLookup.get(sourceVal, target).erase(targetVal);
-    return nonEmptyLookupByTargetNode.erase(target);
+    auto sourceId = factIds.find(sourceVal);
+    auto targetId = nodeIds.find(target);
+    auto targetValId = factIds.find(targetVal);
+    if (!sourceId || !targetId || !targetValId) {
+      return false;
+    }
+    Shard &S = getShard(*targetId);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    NodeEntry *node = findNode(S, *targetId);
+    if (!node) {
+      return false;
+    }
+    FunctionMap *sourceValToFunc = S.findMap(node->reverse, *targetValId);
+    FunctionMap *targetValToFunc = S.findMap(node->forward, *sourceId);
+    if (!sourceValToFunc || !targetValToFunc) {
+      return false;
+    }
+    targetValToFunc->erase(*targetValId);
+    if (!sourceValToFunc->erase(*sourceId)) {
+      return false;
+    }
+    --numFunctions;
+    return true;
+  }
+
+  /**
+   * Removes all jump functions that lead to the given target statement and
+   * returns their number. Like any modification of the jump functions for
+   * the target, this invalidates views of them.
+   */
+  std::size_t removeFunctionsAt(N target) {
+    auto targetId = nodeIds.find(target);
+    if (!targetId) {
+      return 0;
+    }
+    Shard &S = getShard(*targetId);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    NodeEntry *node = findNode(S, *targetId);
+    if (!node) {
+      return 0;
+    }
+    std::size_t numRemoved = 0;
+    for (auto &sourceValAndMap : node->forward) {
+      numRemoved += S.maps[sourceValAndMap.second].size();
+    }
+    // the maps are cleared, which releases their slots, and reused for
+    // other nodes
+    S.releaseMaps(node->reverse);
+    S.releaseMaps(node->forward);
+    numFunctions -= numRemoved;
+    return numRemoved;
   }
 
   /**
    * Removes all jump functions
    */
   void clear() {
-    nonEmptyReverseLookup.clear();
-    nonEmptyForwardLookup.clear();
-    nonEmptyLookupByTargetNode.clear();
+    for (auto &S : shards) {
+      std::lock_guard<std::mutex> Lock(S->Mutex);
+      S->nodes.clear();
+      S->maps.clear();
+      S->freeMaps.clear();
+    }
+    numFunctions = 0;
+  }
+
+  /**
+   * Returns the number of jump functions in constant time.
+   */
+  std::size_t size() const { return numFunctions; }
+
+  /**
+   * Calls Handler(target, sourceVal, targetVal, function) for every jump
+   * function. Must not be called while other threads modify the jump
+   * functions.
+   */
+  template <typename HandlerT> void forEachFunction(HandlerT Handler) {
+    for (std::size_t shard = 0; shard < shards.size(); ++shard) {
+      Shard &S = *shards[shard];
+      for (std::size_t index = 0; index < S.nodes.size(); ++index) {
+        N target = nodeIds.get(index * shards.size() + shard);
+        for (auto &sourceValAndMap : S.nodes[index].forward) {
+          D sourceVal = factIds.get(sourceValAndMap.first);
+          for (auto &targetValAndFunc : S.maps[sourceValAndMap.second]) {
+            Handler(target, sourceVal, factIds.get(targetValAndFunc.first),
+                    targetValAndFunc.second);
+          }
+        }
+      }
+    }
   }
 
   void printJumpFunctions() {
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "Jump Functions:");
-    for (auto &entry : nonEmptyLookupByTargetNode) {
+    forEachFunction([&](N target, D sourceVal, D targetVal,
+                        const std::shared_ptr<EdgeFunction<L>> &function) {
       LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Node: " << problem.NtoString(entry.first));
-      for (auto cell : entry.second.cellSet()) {
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "fact at src: " << problem.DtoString(cell.r));
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "fact at dst: " << problem.DtoString(cell.c));
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "edge fnct: " << cell.v->str());
-      }
-    }
+                    << "Node: " << problem.NtoString(target));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "fact at src: " << problem.DtoString(sourceVal));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "fact at dst: " << problem.DtoString(targetVal));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "edge fnct: " << function->str());
+    });
   }
 
   void printNonEmptyReverseLookup() {
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "DUMP nonEmptyReverseLookup");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Table<N, D, std::unordered_map<D, "
-                     "std::shared_ptr<EdgeFunction<L>>>>");
-    auto cellset = nonEmptyReverseLookup.cellSet();
-    for (auto cell : cellset) {
-      cell.r->dump();
-      cell.c->dump();
-      for (auto edgefunction : cell.v) {
-        edgefunction.first->dump();
-        edgefunction.second->dump();
+                  << "N -> D -> std::unordered_map<D, "
+                     "std::shared_ptr<EdgeFunction<L>>>");
+    for (std::size_t shard = 0; shard < shards.size(); ++shard) {
+      Shard &S = *shards[shard];
+      for (std::size_t index = 0; index < S.nodes.size(); ++index) {
+        for (auto &targetValAndMap : S.nodes[index].reverse) {
+          nodeIds.get(index * shards.size() + shard)->dump();
+          factIds.get(targetValAndMap.first)->dump();
+          for (auto &edgefunction : S.maps[targetValAndMap.second]) {
+            factIds.get(edgefunction.first)->dump();
+            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                          << edgefunction.second->str());
+          }
+        }
       }
     }
   }
@@ -195,15 +632,20 @@ public:
     auto &lg = lg::get();
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << "DUMP nonEmptyForwardLookup");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "Table<D, N, std::unordered_map<D, "
-                     "std::shared_ptr<EdgeFunction<L>>>>");
-    auto cellset = nonEmptyForwardLookup.cellSet();
-    for (auto cell : cellset) {
-      cell.r->dump();
-      cell.c->dump();
-      for (auto edgefunction : cell.v) {
-        edgefunction.first->dump();
-        edgefunction.second->dump();
+                  << "N -> D -> std::unordered_map<D, "
+                     "std::shared_ptr<EdgeFunction<L>>>");
+    for (std::size_t shard = 0; shard < shards.size(); ++shard) {
+      Shard &S = *shards[shard];
+      for (std::size_t index = 0; index < S.nodes.size(); ++index) {
+        for (auto &sourceValAndMap : S.nodes[index].forward) {
+          factIds.get(sourceValAndMap.first)->dump();
+          nodeIds.get(index * shards.size() + shard)->dump();
+          for (auto &edgefunction : S.maps[sourceValAndMap.second]) {
+            factIds.get(edgefunction.first)->dump();
+            LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                          << edgefunction.second->str());
+          }
+        }
       }
     }
   }
@@ -213,18 +655,19 @@ public:
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                   << "DUMP nonEmptyLookupByTargetNode");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                  << "std::unordered_map<N, Table<D, D, "
-                     "std::shared_ptr<EdgeFunction<L>>>>");
-    for (auto node : nonEmptyLookupByTargetNode) {
-      node.first->dump();
-      auto table = nonEmptyLookupByTargetNode[node.first];
-      auto cellset = table.cellSet();
-      for (auto cell : cellset) {
-        cell.r->dump();
-        cell.c->dump();
-        cell.v->dump();
+                  << "N -> D -> std::unordered_map<D, "
+                     "std::shared_ptr<EdgeFunction<L>>>");
+    N previous = N();
+    forEachFunction([&](N target, D sourceVal, D targetVal,
+                        const std::shared_ptr<EdgeFunction<L>> &function) {
+      if (target != previous) {
+        target->dump();
+        previous = target;
       }
-    }
+      sourceVal->dump();
+      targetVal->dump();
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG) << function->str());
+    });
   }
 };
 
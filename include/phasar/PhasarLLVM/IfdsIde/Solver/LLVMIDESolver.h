@@ -66,8 +66,7 @@ public:
   }
 
   void printReport() {
-    SolverResults<const llvm::Instruction *, D, V> SR(this->valtab,
-                                                      Problem.zeroValue());
+    auto SR = this->getSolverResults();
     Problem.printIDEReport(std::cout, SR);
   }
 
@@ -78,36 +77,21 @@ public:
     // for the following line have a look at:
     // http://stackoverflow.com/questions/1120833/derived-template-class-access-to-base-class-member-data
     // https://isocpp.org/wiki/faq/templates#nondependent-name-lookup-members
-    auto results = this->valtab.cellSet();
-    if (results.empty()) {
-      std::cout << "EMPTY" << std::endl;
-    } else {
-      std::vector<typename Table<const llvm::Instruction *, D, V>::Cell> cells;
-      for (auto cell : results) {
-        cells.push_back(cell);
-      }
-      std::sort(cells.begin(), cells.end(),
-                [](typename Table<const llvm::Instruction *, D, V>::Cell a,
-                   typename Table<const llvm::Instruction *, D, V>::Cell b) {
-                  return a.r < b.r;
-                });
-      const llvm::Instruction *prev = nullptr;
-      const llvm::Instruction *curr;
-      for (unsigned i = 0; i < cells.size(); ++i) {
-        curr = cells[i].r;
-        if (prev != curr) {
-          prev = curr;
-          std::cout << "\n--- IDE START RESULT RECORD ---\n";
-          std::cout << "N: " << Problem.NtoString(cells[i].r)
-                    << " in function: ";
-          if (const llvm::Instruction *inst =
-                  llvm::dyn_cast<llvm::Instruction>(cells[i].r)) {
-            std::cout << inst->getFunction()->getName().str() << "\n";
-          }
-        }
-        std::cout << "D:\t" << Problem.DtoString(cells[i].c) << " "
-                  << "\tV:  " << Problem.VtoString(cells[i].v) << "\n";
+    bool empty = true;
+    const llvm::Instruction *prev = nullptr;
+    this->forEachResult([&](const llvm::Instruction *curr, D d, const V &v) {
+      empty = false;
+      if (prev != curr) {
+        prev = curr;
+        std::cout << "\n--- IDE START RESULT RECORD ---\n";
+        std::cout << "N: " << Problem.NtoString(curr) << " in function: ";
+        std::cout << curr->getFunction()->getName().str() << "\n";
       }
+      std::cout << "D:\t" << Problem.DtoString(d) << " "
+                << "\tV:  " << Problem.VtoString(v) << "\n";
+    });
+    if (empty) {
+      std::cout << "EMPTY" << std::endl;
     }
     std::cout << '\n';
     STOP_TIMER("DFA IDE Result Dumping", PAMM_SEVERITY_LEVEL::Full);
@@ -188,7 +172,8 @@ public:
     // getJsonRepresentationForInstructionNode(document, currentNode);
     json fromNode = getJsonOfNode(currentNode, instruction_id_map);
 
-    auto TargetNodeMap = this->computedIntraPathEdges.row(currentNode);
+    auto TargetNodeMap =
+        this->recordedEdgesFrom(this->computedIntraPathEdges, currentNode);
     std::cout << "node pointer current: " << currentNode << std::endl;
 
     std::cout << "TARGET NODE(S)\n";
@@ -227,7 +212,8 @@ public:
 
       if (this->computedInterPathEdges.containsRow(TargetNode)) {
         std::cout << "FOUND Inter path edge !!" << std::endl;
-        auto interEdgeTargetMap = this->computedInterPathEdges.row(TargetNode);
+        auto interEdgeTargetMap =
+            this->recordedEdgesFrom(this->computedInterPathEdges, TargetNode);
 
         for (auto interEntry : interEdgeTargetMap) {
           // this doesn't seem to work right.. wait for
@@ -374,7 +360,8 @@ public:
 
   void dumpAllInterPathEdges() {
     std::cout << "COMPUTED INTER PATH EDGES" << std::endl;
-    auto interpe = this->computedInterPathEdges.cellSet();
+    auto interpe =
+        this->recordedEdges(this->computedInterPathEdges).cellSet();
     for (auto &cell : interpe) {
       std::cout << "FROM" << std::endl;
       cell.r->dump();
@@ -394,7 +381,8 @@ public:
 
   void dumpAllIntraPathEdges() {
     std::cout << "COMPUTED INTRA PATH EDGES" << std::endl;
-    auto intrape = this->computedIntraPathEdges.cellSet();
+    auto intrape =
+        this->recordedEdges(this->computedIntraPathEdges).cellSet();
     for (auto &cell : intrape) {
       std::cout << "FROM" << std::endl;
       cell.r->dump();
@@ -69,8 +69,7 @@ public:
   }
 
   void printReport() {
-    SolverResults<const llvm::Instruction *, D, BinaryDomain> SR(
-        this->valtab, Problem.zeroValue());
+    auto SR = this->getSolverResults();
     Problem.printIFDSReport(std::cout, SR);
   }
 
@@ -78,38 +77,22 @@ public:
     PAMM_GET_INSTANCE;
     START_TIMER("DFA IFDS Result Dumping", PAMM_SEVERITY_LEVEL::Full);
     std::cout << "### DUMP LLVMIFDSSolver results\n";
-    auto results = this->valtab.cellSet();
-    if (results.empty()) {
-      std::cout << "EMPTY\n";
-    } else {
-      std::vector<
-          typename Table<const llvm::Instruction *, D, BinaryDomain>::Cell>
-          cells;
-      for (auto cell : results) {
-        cells.push_back(cell);
-      }
-      sort(
-          cells.begin(), cells.end(),
-          [](typename Table<const llvm::Instruction *, D, BinaryDomain>::Cell a,
-             typename Table<const llvm::Instruction *, D, BinaryDomain>::Cell
-                 b) { return a.r < b.r; });
-      const llvm::Instruction *prev = nullptr;
-      const llvm::Instruction *curr;
-      for (unsigned i = 0; i < cells.size(); ++i) {
-        curr = cells[i].r;
-        if (prev != curr) {
-          prev = curr;
-          std::cout << "--- IFDS START RESULT RECORD ---\n";
-          std::cout << "N: " << Problem.NtoString(cells[i].r)
-                    << " in function: ";
-          if (const llvm::Instruction *inst =
-                  llvm::dyn_cast<llvm::Instruction>(cells[i].r)) {
-            std::cout << inst->getFunction()->getName().str() << "\n";
+    bool empty = true;
+    const llvm::Instruction *prev = nullptr;
+    this->forEachResult(
+        [&](const llvm::Instruction *curr, D d, const BinaryDomain &v) {
+          empty = false;
+          if (prev != curr) {
+            prev = curr;
+            std::cout << "--- IFDS START RESULT RECORD ---\n";
+            std::cout << "N: " << Problem.NtoString(curr) << " in function: ";
+            std::cout << curr->getFunction()->getName().str() << "\n";
           }
-        }
-        std::cout << "D:\t" << Problem.DtoString(cells[i].c) << " "
-                  << "\tV:  " << cells[i].v << "\n";
-      }
+          std::cout << "D:\t" << Problem.DtoString(d) << " "
+                    << "\tV:  " << v << "\n";
+        });
+    if (empty) {
+      std::cout << "EMPTY\n";
     }
     std::cout << '\n';
     STOP_TIMER("DFA IFDS Result Dumping", PAMM_SEVERITY_LEVEL::Full);
@@ -189,7 +172,8 @@ public:
     // getJsonRepresentationForInstructionNode(document, currentNode);
     json fromNode = getJsonOfNode(currentNode, instruction_id_map);
 
-    auto TargetNodeMap = this->computedIntraPathEdges.row(currentNode);
+    auto TargetNodeMap =
+        this->recordedEdgesFrom(this->computedIntraPathEdges, currentNode);
     std::cout << "node pointer current: " << currentNode << std::endl;
 
     std::cout << "TARGET NODE(S)\n";
@@ -228,7 +212,8 @@ public:
 
       if (this->computedInterPathEdges.containsRow(TargetNode)) {
         std::cout << "FOUND Inter path edge !!" << std::endl;
-        auto interEdgeTargetMap = this->computedInterPathEdges.row(TargetNode);
+        auto interEdgeTargetMap =
+            this->recordedEdgesFrom(this->computedInterPathEdges, TargetNode);
 
         for (auto interEntry : interEdgeTargetMap) {
           // this doesn't seem to work right.. wait for
@@ -374,7 +359,8 @@ public:
 
   void dumpAllInterPathEdges() {
     std::cout << "COMPUTED INTER PATH EDGES" << std::endl;
-    auto interpe = this->computedInterPathEdges.cellSet();
+    auto interpe =
+        this->recordedEdges(this->computedInterPathEdges).cellSet();
     for (auto &cell : interpe) {
       std::cout << "FROM" << std::endl;
       cell.r->dump();
@@ -398,7 +384,8 @@ public:
 
   void dumpAllIntraPathEdges() {
     std::cout << "COMPUTED INTRA PATH EDGES" << std::endl;
-    auto intrape = this->computedIntraPathEdges.cellSet();
+    auto intrape =
+        this->recordedEdges(this->computedIntraPathEdges).cellSet();
     for (auto &cell : intrape) {
       std::cout << "FROM" << std::endl;
       cell.r->dump();
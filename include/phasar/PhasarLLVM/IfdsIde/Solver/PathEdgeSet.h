@@ -0,0 +1,232 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_PATHEDGESET_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_PATHEDGESET_H_
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <phasar/Utils/Interner.h>
+#include <phasar/Utils/SnapshotView.h>
+
+namespace psr {
+
+/**
+ * Stores the path edges computed by the IFDSSolver. In contrast to the
+ * JumpFunctions of the IDESolver, a path edge carries no edge function: it
+ * is either present or not, hence the path edges that lead to a target node
+ * are kept in plain hash sets. Like the jump functions, the path edges are
+ * split into shards by their target node, each shard being guarded by its
+ * own mutex.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts.
+ */
+template <typename N, typename D> class PathEdgeSet {
+public:
+  using FactSet = std::unordered_set<D>;
+  // mapping from target value to the set of all source values
+  using FactToFactSetMap = std::unordered_map<D, FactSet>;
+
+private:
+  struct Shard {
+    std::mutex Mutex;
+    // dense IDs of the target nodes that belong to this shard, the ID of a
+    // node is the index of its entry in nodes; a deque keeps the entries in
+    // place as nodes are added, which views rely on
+    Interner<N> nodeIds;
+    std::deque<FactToFactSetMap> nodes;
+  };
+
+  // views must take snapshots if the path edges are shared between threads
+  bool concurrent;
+  std::vector<std::unique_ptr<Shard>> shards;
+  // the number of path edges, kept up to date such that it can be queried
+  // without locking all shards
+  std::atomic<std::size_t> numEdges{0};
+
+  Shard &getShard(N target) {
+    return *shards[std::hash<N>()(target) % shards.size()];
+  }
+
+public:
+  /**
+   * @param numThreads the number of threads that access the path edges; if
+   * it is larger than one, the edges are split into several independently
+   * locked shards and views are backed by snapshots.
+   */
+  explicit PathEdgeSet(unsigned numThreads = 1) : concurrent(numThreads > 1) {
+    // use more shards than threads to keep the contention low
+    unsigned numShards = concurrent ? 4 * numThreads : 1;
+    for (unsigned i = 0; i < numShards; ++i) {
+      shards.push_back(std::make_unique<Shard>());
+    }
+  }
+
+  ~PathEdgeSet() = default;
+
+  PathEdgeSet(const PathEdgeSet &) = delete;
+
+  PathEdgeSet &operator=(const PathEdgeSet &) = delete;
+
+  /**
+   * Records the path edge from sourceVal at the start point of the target's
+   * method to targetVal at target. Returns true if the edge is new.
+   */
+  bool insert(D sourceVal, N target, D targetVal) {
+    Shard &S = getShard(target);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    auto id = S.nodeIds.getOrInsert(target);
+    if (id == S.nodes.size()) {
+      S.nodes.emplace_back();
+    }
+    if (!S.nodes[id][targetVal].insert(sourceVal).second) {
+      return false;
+    }
+    ++numEdges;
+    return true;
+  }
+
+  bool contains(D sourceVal, N target, D targetVal) {
+    Shard &S = getShard(target);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    auto id = S.nodeIds.find(target);
+    if (!id) {
+      return false;
+    }
+    auto search = S.nodes[*id].find(targetVal);
+    return search != S.nodes[*id].end() && search->second.count(sourceVal);
+  }
+
+  /**
+   * Returns true if at least one path edge leads to targetVal at target.
+   */
+  bool reaches(N target, D targetVal) {
+    Shard &S = getShard(target);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    auto id = S.nodeIds.find(target);
+    return id && S.nodes[*id].count(targetVal);
+  }
+
+  /**
+   * Returns all target values that are reached at target.
+   */
+  std::vector<D> targetValsAt(N target) {
+    Shard &S = getShard(target);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    std::vector<D> targetVals;
+    if (auto id = S.nodeIds.find(target)) {
+      for (auto &targetValAndSources : S.nodes[*id]) {
+        targetVals.push_back(targetValAndSources.first);
+      }
+    }
+    return targetVals;
+  }
+
+  /**
+   * Returns the source values of all path edges that lead to targetVal at
+   * target. If the path edges are not shared between threads, the view stays
+   * valid until path edges to the very same target value are added.
+   */
+  SnapshotView<FactSet> sourcesOf(N target, D targetVal) {
+    Shard &S = getShard(target);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    auto id = S.nodeIds.find(target);
+    const FactSet *sources = nullptr;
+    if (id) {
+      auto search = S.nodes[*id].find(targetVal);
+      if (search != S.nodes[*id].end()) {
+        sources = &search->second;
+      }
+    }
+    return SnapshotView<FactSet>(sources, concurrent);
+  }
+
+  /**
+   * Calls Handler(target, targetVal) once for every pair of target node and
+   * target value that is reached by at least one path edge. Must not be
+   * called while path edges are added.
+   */
+  template <typename HandlerT> void forEachTarget(HandlerT Handler) const {
+    for (auto &S : shards) {
+      for (std::size_t id = 0; id < S->nodes.size(); ++id) {
+        for (auto &targetValAndSources : S->nodes[id]) {
+          Handler(S->nodeIds.get(id), targetValAndSources.first);
+        }
+      }
+    }
+  }
+
+  /**
+   * Calls Handler(sourceVal, target, targetVal) once for every path edge.
+   * Must not be called while path edges are added.
+   */
+  template <typename HandlerT> void forEachEdge(HandlerT Handler) const {
+    for (auto &S : shards) {
+      for (std::size_t id = 0; id < S->nodes.size(); ++id) {
+        for (auto &targetValAndSources : S->nodes[id]) {
+          for (auto &sourceVal : targetValAndSources.second) {
+            Handler(sourceVal, S->nodeIds.get(id), targetValAndSources.first);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Calls Handler(sourceVal, targetVal) once for every path edge that leads
+   * to target, then removes all of them and returns their number.
+   */
+  template <typename HandlerT>
+  std::size_t removeEdgesAt(N target, HandlerT Handler) {
+    Shard &S = getShard(target);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    auto id = S.nodeIds.find(target);
+    if (!id) {
+      return 0;
+    }
+    std::size_t numRemoved = 0;
+    for (auto &targetValAndSources : S.nodes[*id]) {
+      for (auto &sourceVal : targetValAndSources.second) {
+        Handler(sourceVal, targetValAndSources.first);
+      }
+      numRemoved += targetValAndSources.second.size();
+    }
+    // swap with an empty map to actually release the memory of the buckets
+    FactToFactSetMap().swap(S.nodes[*id]);
+    numEdges -= numRemoved;
+    return numRemoved;
+  }
+
+  /**
+   * Returns the number of path edges in constant time.
+   */
+  std::size_t size() const { return numEdges; }
+
+  void clear() {
+    for (auto &S : shards) {
+      std::lock_guard<std::mutex> Lock(S->Mutex);
+      S->nodeIds.clear();
+      S->nodes.clear();
+    }
+    numEdges = 0;
+  }
+};
+
+} // namespace psr
+
+#endif
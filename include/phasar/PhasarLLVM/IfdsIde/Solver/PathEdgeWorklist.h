@@ -0,0 +1,162 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVER_PATHEDGEWORKLIST_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SOLVER_PATHEDGEWORKLIST_H_
+
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdge.h>
+#include <phasar/PhasarLLVM/IfdsIde/SolverConfiguration.h>
+
+namespace psr {
+
+/**
+ * Holds the path edges that have been discovered by the IDESolver but not yet
+ * processed. Using an explicit worklist instead of recursing into the
+ * processing of each new path edge bounds the native stack depth and allows
+ * to choose the order in which the exploded super-graph is explored, see
+ * WorklistPolicy.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts.
+ * @param <M> The type of objects used to represent methods.
+ * @param <I> The type of inter-procedural control-flow graph being used.
+ */
+template <typename N, typename D, typename M, typename I>
+class PathEdgeWorklist {
+private:
+  // An entry of the priority queue used for WorklistPolicy::ReversePostOrder.
+  // Ties in the reverse post-order position are broken by insertion order.
+  struct PrioritizedEdge {
+    std::size_t RPONumber;
+    std::size_t SeqNumber;
+    PathEdge<N, D> Edge;
+    friend bool operator<(const PrioritizedEdge &Lhs,
+                          const PrioritizedEdge &Rhs) {
+      // std::priority_queue is a max-heap, but we want the smallest numbers
+      return std::tie(Lhs.RPONumber, Lhs.SeqNumber) >
+             std::tie(Rhs.RPONumber, Rhs.SeqNumber);
+    }
+  };
+
+  I ICF;
+  WorklistPolicy Policy;
+  std::size_t SeqCounter = 0;
+  std::deque<PathEdge<N, D>> Edges;
+  std::priority_queue<PrioritizedEdge> PrioritizedEdges;
+  // reverse post-order numbers of the nodes of all methods numbered so far
+  std::unordered_map<N, std::size_t> RPONumbers;
+  std::unordered_set<M> NumberedMethods;
+
+  void computeReversePostOrder(M Method) {
+    std::vector<N> PostOrder;
+    std::unordered_set<N> Visited;
+    // iterative depth-first search, the stack holds the visited nodes along
+    // with their successors and NextSucc the index of the next successor to
+    // visit for each of them
+    std::vector<std::pair<N, std::vector<N>>> Stack;
+    std::vector<std::size_t> NextSucc;
+    for (N StartPoint : ICF.getStartPointsOf(Method)) {
+      if (!Visited.insert(StartPoint).second) {
+        continue;
+      }
+      Stack.emplace_back(StartPoint, ICF.getSuccsOf(StartPoint));
+      NextSucc.push_back(0);
+      while (!Stack.empty()) {
+        auto &Succs = Stack.back().second;
+        if (NextSucc.back() < Succs.size()) {
+          N Succ = Succs[NextSucc.back()++];
+          if (Visited.insert(Succ).second) {
+            Stack.emplace_back(Succ, ICF.getSuccsOf(Succ));
+            NextSucc.push_back(0);
+          }
+        } else {
+          PostOrder.push_back(Stack.back().first);
+          Stack.pop_back();
+          NextSucc.pop_back();
+        }
+      }
+    }
+    for (std::size_t Idx = 0; Idx < PostOrder.size(); ++Idx) {
+      RPONumbers[PostOrder[Idx]] = PostOrder.size() - 1 - Idx;
+    }
+  }
+
+  std::size_t getRPONumber(N Node) {
+    M Method = ICF.getMethodOf(Node);
+    if (NumberedMethods.insert(Method).second) {
+      computeReversePostOrder(Method);
+    }
+    auto Search = RPONumbers.find(Node);
+    // nodes that are unreachable from the method's start points go last
+    return Search != RPONumbers.end() ? Search->second
+                                      : std::numeric_limits<std::size_t>::max();
+  }
+
+public:
+  PathEdgeWorklist(I ICF, WorklistPolicy Policy) : ICF(ICF), Policy(Policy) {}
+
+  ~PathEdgeWorklist() = default;
+
+  void push(PathEdge<N, D> Edge) {
+    switch (Policy) {
+    case WorklistPolicy::ReversePostOrder:
+      PrioritizedEdges.push(
+          PrioritizedEdge{getRPONumber(Edge.getTarget()), SeqCounter++, Edge});
+      break;
+    default:
+      Edges.push_back(Edge);
+      break;
+    }
+  }
+
+  /**
+   * Removes the next path edge to be processed according to the worklist
+   * policy. The worklist must not be empty.
+   */
+  PathEdge<N, D> pop() {
+    switch (Policy) {
+    case WorklistPolicy::FIFO: {
+      PathEdge<N, D> Edge = Edges.front();
+      Edges.pop_front();
+      return Edge;
+    }
+    case WorklistPolicy::LIFO: {
+      PathEdge<N, D> Edge = Edges.back();
+      Edges.pop_back();
+      return Edge;
+    }
+    case WorklistPolicy::ReversePostOrder:
+    default: {
+      PathEdge<N, D> Edge = PrioritizedEdges.top().Edge;
+      PrioritizedEdges.pop();
+      return Edge;
+    }
+    }
+  }
+
+  bool empty() const { return Edges.empty() && PrioritizedEdges.empty(); }
+
+  std::size_t size() const { return Edges.size() + PrioritizedEdges.size(); }
+
+  WorklistPolicy getPolicy() const { return Policy; }
+};
+
+} // namespace psr
+
+#endif
@@ -22,23 +22,32 @@
 #include <unordered_map>
 
 #include <phasar/PhasarLLVM/Utils/BinaryDomain.h>
-#include <phasar/Utils/Table.h>
+#include <phasar/Utils/ColumnarTable.h>
+#include <phasar/Utils/DenseTable.h>
 
 namespace psr {
 
 template <typename N, typename D, typename V> class SolverResults {
 private:
-  Table<N, D, V> &results;
+  // exactly one of them is set
+  DenseTable<N, D, V> *results = nullptr;
+  const ColumnarTable<N, D, V> *compactResults = nullptr;
   D zeroValue;
 
 public:
-  SolverResults(Table<N, D, V> &res_tab, D zv)
-      : results(res_tab), zeroValue(zv) {}
+  SolverResults(DenseTable<N, D, V> &res_tab, D zv)
+      : results(&res_tab), zeroValue(zv) {}
 
-  V valueAt(N stmt, D node) { return results.get(stmt, node); }
+  SolverResults(const ColumnarTable<N, D, V> &res_tab, D zv)
+      : compactResults(&res_tab), zeroValue(zv) {}
+
+  V valueAt(N stmt, D node) {
+    return results ? results->get(stmt, node) : compactResults->get(stmt, node);
+  }
 
   std::unordered_map<D, V> resultsAt(N stmt, bool stripZero = false) {
-    std::unordered_map<D, V> result = results.row(stmt);
+    std::unordered_map<D, V> result =
+        results ? results->row(stmt) : compactResults->row(stmt);
     if (stripZero) {
       for (auto it = result.begin(); it != result.end();) {
         if (it->first == zeroValue) {
@@ -17,10 +17,29 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_SOLVERCONFIGURATION_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_SOLVERCONFIGURATION_H_
 
+#include <cstddef>
 #include <iosfwd>
+#include <string>
+
+#include <wise_enum.h>
 
 namespace psr {
 
+/**
+ * Specifies the order in which the IDESolver processes the path edges that
+ * are pending in its worklist.
+ *
+ *   FIFO             - breadth-first, edges are processed in the order in
+ *                      which they have been discovered
+ *   LIFO             - depth-first, closest to the former recursive
+ *                      propagation scheme
+ *   ReversePostOrder - edges whose target comes earlier in the reverse
+ *                      post-order of its function's CFG are processed first
+ */
+WISE_ENUM_CLASS(WorklistPolicy, FIFO, LIFO, ReversePostOrder)
+
+std::ostream &operator<<(std::ostream &os, const WorklistPolicy &WP);
+
 struct SolverConfiguration {
   SolverConfiguration() = default;
   SolverConfiguration(bool followReturnsPastSeeds, bool autoAddZero,
@@ -40,6 +59,77 @@ struct SolverConfiguration {
   bool computeValues = false;
   bool recordEdges = false;
   bool computePersistedSummaries = false;
+  WorklistPolicy worklistPolicy = WorklistPolicy::LIFO;
+  // Number of threads used to construct the exploded super-graph (phase I)
+  // and to compute the values at the individual nodes (phase II). With more
+  // than one thread, path edges are distributed over the threads by work
+  // stealing and worklistPolicy is ignored. The problem's flow and edge
+  // functions must then be safe to apply concurrently; their construction is
+  // serialized by the solver.
+  unsigned numThreads = 1;
+  // Hash-cons the edge functions and memoize their compositions and joins,
+  // see EdgeFunctionInterner. Requires the problem's edge functions to be
+  // pure. The interner keeps every edge function it has seen alive until the
+  // solver is destroyed, hence it pays off only for problems with few
+  // distinct edge functions.
+  bool internEdgeFunctions = false;
+  // Maximum number of edge functions kept by each of the solver's edge
+  // function caches; the least recently used ones are evicted and
+  // reconstructed on demand. Zero means unbounded.
+  std::size_t edgeFunctionCacheSize = 0;
+  // Move the tables of procedures that have no pending path edges anymore to
+  // a temporary file: their end summaries, incoming edges and jump
+  // functions, except for those at start points, call sites, return sites,
+  // exit points and seeds. They are read back as soon as the procedure is
+  // reached again; the jump functions are read from the file in phase II.
+  // The edge functions stay in memory. Only effective with a single thread.
+  // If nodes or facts cannot be written to a file as raw bytes, the jump
+  // functions are dropped and re-derived on demand instead, which is only
+  // done for IDE problems if no values are computed.
+  bool evictFinishedProcedures = false;
+  // Number of path edges that are processed after a procedure has run out
+  // of pending path edges before it is evicted; the delay of a procedure is
+  // doubled each time it is reached again after its eviction.
+  std::size_t evictionDelay = 4096;
+  // Approximate number of bytes that the edges recorded for recordEdges may
+  // occupy in memory; beyond that, they are moved to a temporary file until
+  // the solver has finished. Zero means unbounded.
+  std::size_t recordedEdgesMemoryBudget = 0;
+  // Directory of the SummaryStore that end summaries are persisted to and
+  // reused from if computePersistedSummaries is set. The directory must be
+  // specific to the analysis problem. Empty disables persisted summaries.
+  // They are only stored, not reused, by an IDESolver that computes values
+  // and for problems whose flow functions have side effects. Reusing them
+  // skips the unchanged functions of a re-run, which is otherwise still
+  // solved from its initial seeds.
+  std::string summaryDirectory;
+  // Let the IFDSSolver propagate a fact past the nodes that neither define
+  // nor use it, and that do not access memory if the fact is a memory
+  // location, without applying their flow functions. Requires the problem's
+  // normal flow functions to map such facts to themselves at such nodes.
+  bool sparsePropagation = false;
+  // Budgets of a solver run: wall-clock time in milliseconds, number of path
+  // edges and resident set size of the process in bytes. Once one of them is
+  // exceeded, the solver stops constructing the exploded super-graph and
+  // computes the values from the part that has been constructed so far; the
+  // results are then marked as incomplete. Zero means unbounded.
+  std::size_t timeBudget = 0;
+  std::size_t pathEdgeBudget = 0;
+  std::size_t memoryBudget = 0;
+  // Destination of the progress snapshots that are written periodically
+  // while the exploded super-graph is constructed: a file, or
+  // "unix:<path>" for a Unix domain socket, see ProgressStream. Empty
+  // disables them.
+  std::string progressDestination;
+  // Milliseconds between two progress snapshots.
+  std::size_t progressInterval = 1000;
+  // Number of procedures with the most processed path edges that are listed
+  // in each progress snapshot.
+  unsigned progressTopProcedures = 10;
+  // Freeze the computed values into a ColumnarTable once the solver has
+  // finished, which takes a fraction of the memory of the mutable result
+  // table; lookups then take logarithmic time.
+  bool compactResults = false;
   friend std::ostream &operator<<(std::ostream &os,
                                   const SolverConfiguration &sc);
 };
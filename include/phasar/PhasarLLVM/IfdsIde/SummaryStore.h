@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_IFDSIDE_SUMMARYSTORE_H_
+#define PHASAR_PHASARLLVM_IFDSIDE_SUMMARYSTORE_H_
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <phasar/PhasarLLVM/IfdsIde/IDESummary.h>
+
+namespace llvm {
+class Function;
+class Value;
+} // namespace llvm
+
+namespace psr {
+
+/**
+ * Assigns IDs to the values a data-flow fact of a function may refer to,
+ * which are stable across analysis runs as long as the function is not
+ * changed: formal arguments are encoded by their position ("a0", "a1", ...),
+ * instructions by their position within the function ("i0", "i1", ...) and
+ * global values by their name ("g:<name>"). Other values have no ID.
+ */
+class FunctionLocalIDs {
+private:
+  const llvm::Function *F;
+  std::unordered_map<const llvm::Value *, std::string> IDs;
+  std::unordered_map<std::string, const llvm::Value *> Values;
+
+public:
+  explicit FunctionLocalIDs(const llvm::Function *F);
+
+  /**
+   * Returns the ID of V, or an empty string if V cannot be encoded.
+   */
+  std::string getID(const llvm::Value *V) const;
+
+  /**
+   * Returns the value identified by ID, or nullptr if there is no such value.
+   */
+  const llvm::Value *getValue(const std::string &ID) const;
+};
+
+/**
+ * Persists IDESummary objects in a local directory, one JSON file per
+ * function and hash. The directory should be specific to the analysis
+ * problem, and to its configuration, that computed the summaries.
+ *
+ * I/O errors are reported by throwing std::ios_base::failure; summaries that
+ * cannot be parsed are treated as missing.
+ */
+class SummaryStore {
+private:
+  std::string Directory;
+
+  std::string getPath(const std::string &FunctionName, std::size_t Hash) const;
+
+public:
+  explicit SummaryStore(std::string Directory);
+
+  std::optional<IDESummary> load(const std::string &FunctionName,
+                                 std::size_t Hash) const;
+
+  /**
+   * Persists S, merged with the summaries of the same function and hash that
+   * have been persisted before. Concurrent calls, also from different
+   * processes, are serialized by a lock file next to the summary.
+   */
+  void store(const IDESummary &S) const;
+};
+
+} // namespace psr
+
+#endif
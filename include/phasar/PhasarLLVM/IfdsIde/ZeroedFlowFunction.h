@@ -17,6 +17,7 @@
 #ifndef PHASAR_PHASARLLVM_IFDSIDE_ZEROEDFLOWFUNCTIONS_H_
 #define PHASAR_PHASARLLVM_IFDSIDE_ZEROEDFLOWFUNCTIONS_H_
 
+#include <algorithm>
 #include <memory>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 #include <set>
@@ -40,6 +41,17 @@ public:
       return delegate->computeTargets(source);
     }
   }
+  void computeTargetsInto(
+      D source, typename FlowFunction<D>::container_type &Targets) override {
+    auto Begin = Targets.size();
+    delegate->computeTargetsInto(source, Targets);
+    if (source == zerovalue &&
+        std::find(Targets.begin() + Begin, Targets.end(), zerovalue) ==
+            Targets.end()) {
+      Targets.push_back(zerovalue);
+    }
+  }
+  bool isIdentity() const override { return delegate->isIdentity(); }
 };
 } // namespace psr
 
@@ -140,7 +140,7 @@ public:
    * 	@brief Computes all types, which are transitiv reachable from
    * 	       the given type.
    * 	@param TypeName Name of the type.
-   * 	@return Set of reachable types.
+   * 	@return Set of reachable types, empty for unknown types.
    */
   std::set<std::string> getTransitivelyReachableTypes(std::string TypeName);
 
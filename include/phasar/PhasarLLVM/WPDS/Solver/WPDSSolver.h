@@ -193,7 +193,7 @@ public:
           IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
               .getNormalFlowFunction(n, m);
       INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-      std::set<D> res = IDESolver<N, D, M, V, I>::computeNormalFlowFunction(
+      FFSet<D> res = IDESolver<N, D, M, V, I>::computeNormalFlowFunction(
           flowFunction, d1, d2);
       ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
                        PAMM_SEVERITY_LEVEL::Full);
@@ -268,7 +268,7 @@ public:
         LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                       << "Found and process special summary");
         for (N returnSiteN : returnSiteNs) {
-          std::set<D> res =
+          FFSet<D> res =
               IDESolver<N, D, M, V, I>::computeSummaryFlowFunction(specialSum,
                                                                    d1, d2);
           INC_COUNTER("SpecialSummary-FF Application", 1,
@@ -296,7 +296,7 @@ public:
             IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                 .getCallFlowFunction(n, sCalledProcN);
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-        std::set<D> res =
+        FFSet<D> res =
             IDESolver<N, D, M, V, I>::computeCallFlowFunction(function, d1, d2);
         ADD_TO_HISTOGRAM("Data-flow facts", res.size(), 1,
                          PAMM_SEVERITY_LEVEL::Full);
@@ -352,7 +352,7 @@ public:
                     IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                         .getRetFlowFunction(n, sCalledProcN, eP, retSiteN);
                 INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-                std::set<D> returnedFacts =
+                FFSet<D> returnedFacts =
                     IDESolver<N, D, M, V, I>::computeReturnFlowFunction(
                         retFunction, d3, d4, n, std::set<D>{d2});
                 ADD_TO_HISTOGRAM("Data-flow facts", returnedFacts.size(), 1,
@@ -449,7 +449,7 @@ public:
             IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                 .getCallToRetFlowFunction(n, returnSiteN, callees);
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-        std::set<D> returnFacts =
+        FFSet<D> returnFacts =
             IDESolver<N, D, M, V, I>::computeCallToReturnFlowFunction(
                 callToReturnFlowFunction, d1, d2);
         ADD_TO_HISTOGRAM("Data-flow facts", returnFacts.size(), 1,
@@ -532,7 +532,7 @@ public:
         INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
         // for each incoming-call value
         for (D d4 : entry.second) {
-          std::set<D> targets =
+          FFSet<D> targets =
               IDESolver<N, D, M, V, I>::computeReturnFlowFunction(
                   retFunction, d1, d2, c, entry.second);
           ADD_TO_HISTOGRAM("Data-flow facts", targets.size(), 1,
@@ -625,7 +625,7 @@ public:
               IDESolver<N, D, M, V, I>::cachedFlowEdgeFunctions
                   .getRetFlowFunction(c, methodThatNeedsSummary, n, retSiteC);
           INC_COUNTER("FF Queries", 1, PAMM_SEVERITY_LEVEL::Full);
-          std::set<D> targets =
+          FFSet<D> targets =
               IDESolver<N, D, M, V, I>::computeReturnFlowFunction(
                   retFunction, d1, d2, c,
                   std::set<D>{IDESolver<N, D, M, V, I>::zeroValue});
@@ -0,0 +1,396 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_COLUMNARTABLE_H_
+#define PHASAR_UTILS_COLUMNARTABLE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <phasar/Utils/DenseTable.h>
+#include <phasar/Utils/MappedFile.h>
+#include <phasar/Utils/Table.h>
+
+namespace psr {
+
+/**
+ * An immutable, compact form of a Table or DenseTable. Row keys and column
+ * keys are replaced by dense IDs; the cells are stored in parallel arrays of
+ * column IDs and values, sorted by row and column, and the cells of a row are
+ * found by an offset index. Looking up a cell or a row takes O(log n).
+ *
+ * A ColumnarTable can be saved to a file and loaded from it again. The file
+ * is mapped into memory rather than read, hence loading costs next to nothing
+ * besides decoding the keys. Keys are saved as strings produced by the given
+ * encoders, whereas values are saved as raw bytes: they must be trivially
+ * copyable and the file is only meaningful on machines of the same
+ * architecture.
+ *
+ * I/O errors and malformed files are reported by throwing
+ * std::ios_base::failure.
+ *
+ * @param <R> The type of row keys.
+ * @param <C> The type of column keys.
+ * @param <V> The type of values.
+ */
+template <typename R, typename C, typename V> class ColumnarTable {
+public:
+  using RowEncoder = std::function<std::string(R)>;
+  using ColumnEncoder = std::function<std::string(C)>;
+  using RowDecoder = std::function<R(const std::string &)>;
+  using ColumnDecoder = std::function<C(const std::string &)>;
+
+private:
+  struct FileHeader {
+    char Magic[8];
+    std::uint64_t ValueSize;
+    std::uint64_t NumRows;
+    std::uint64_t NumColumns;
+    std::uint64_t NumCells;
+    std::uint64_t RowKeyBytes;
+    std::uint64_t ColumnKeyBytes;
+  };
+
+  static constexpr char FileMagic[8] = {'P', 'S', 'R', 'C',
+                                        'O', 'L', 'T', '1'};
+
+  // keys by ID
+  std::vector<R> RowKeys;
+  std::vector<C> ColumnKeys;
+  // pairs of key and ID, sorted by key
+  std::vector<std::pair<R, std::uint32_t>> RowIndex;
+  std::vector<std::pair<C, std::uint32_t>> ColumnIndex;
+
+  // the columns, which point either into the owned vectors or into the
+  // mapped file; the cells of row i are the ones in [CellOffsets[i],
+  // CellOffsets[i + 1])
+  std::vector<std::uint64_t> OwnedCellOffsets;
+  std::vector<std::uint32_t> OwnedColumnIds;
+  std::vector<V> OwnedValues;
+  std::unique_ptr<MappedFile> Mapping;
+  const std::uint64_t *CellOffsets = nullptr;
+  const std::uint32_t *ColumnIds = nullptr;
+  const V *Values = nullptr;
+  std::size_t NumCells = 0;
+
+  template <typename K>
+  static std::vector<std::pair<K, std::uint32_t>>
+  indexKeys(const std::vector<K> &Keys) {
+    std::vector<std::pair<K, std::uint32_t>> Index;
+    Index.reserve(Keys.size());
+    for (std::uint32_t Id = 0; Id < Keys.size(); ++Id) {
+      Index.emplace_back(Keys[Id], Id);
+    }
+    std::sort(Index.begin(), Index.end());
+    return Index;
+  }
+
+  template <typename K>
+  static const std::uint32_t *
+  findId(const std::vector<std::pair<K, std::uint32_t>> &Index, K Key) {
+    auto Search = std::lower_bound(
+        Index.begin(), Index.end(), Key,
+        [](const std::pair<K, std::uint32_t> &Entry, const K &Key) {
+          return Entry.first < Key;
+        });
+    return (Search != Index.end() && !(Key < Search->first)) ? &Search->second
+                                                             : nullptr;
+  }
+
+  // returns the index of the cell at R, C or NumCells if there is none
+  std::size_t findCell(R Row, C Column) const {
+    const std::uint32_t *RowId = findId(RowIndex, Row);
+    const std::uint32_t *ColumnId = findId(ColumnIndex, Column);
+    if (!RowId || !ColumnId) {
+      return NumCells;
+    }
+    const std::uint32_t *Begin = ColumnIds + CellOffsets[*RowId];
+    const std::uint32_t *End = ColumnIds + CellOffsets[*RowId + 1];
+    const std::uint32_t *Search = std::lower_bound(Begin, End, *ColumnId);
+    return (Search != End && *Search == *ColumnId) ? Search - ColumnIds
+                                                   : NumCells;
+  }
+
+  void pointToOwnedColumns() {
+    CellOffsets = OwnedCellOffsets.data();
+    ColumnIds = OwnedColumnIds.data();
+    Values = OwnedValues.data();
+    NumCells = OwnedValues.size();
+  }
+
+  static std::size_t padded(std::size_t Size) { return (Size + 7) & ~7; }
+
+  template <typename K, typename EncoderT>
+  static void writeKeys(std::ofstream &OS, const std::vector<K> &Keys,
+                        EncoderT &Encode) {
+    std::vector<std::uint64_t> Offsets{0};
+    std::string Chars;
+    for (const K &Key : Keys) {
+      Chars += Encode(Key);
+      Offsets.push_back(Chars.size());
+    }
+    OS.write(reinterpret_cast<const char *>(Offsets.data()),
+             Offsets.size() * sizeof(std::uint64_t));
+    Chars.resize(padded(Chars.size()));
+    OS.write(Chars.data(), Chars.size());
+  }
+
+  template <typename K, typename DecoderT>
+  static std::vector<K> readKeys(const char *&Pos, std::size_t NumKeys,
+                                 std::size_t KeyBytes, DecoderT &Decode) {
+    const auto *Offsets = reinterpret_cast<const std::uint64_t *>(Pos);
+    const char *Chars = Pos + (NumKeys + 1) * sizeof(std::uint64_t);
+    std::vector<K> Keys;
+    Keys.reserve(NumKeys);
+    for (std::size_t Idx = 0; Idx < NumKeys; ++Idx) {
+      if (Offsets[Idx] > Offsets[Idx + 1] || Offsets[Idx + 1] > KeyBytes) {
+        throw std::ios_base::failure("malformed result file");
+      }
+      Keys.push_back(Decode(
+          std::string(Chars + Offsets[Idx], Offsets[Idx + 1] - Offsets[Idx])));
+    }
+    Pos = Chars + padded(Offsets[NumKeys]);
+    return Keys;
+  }
+
+  static std::size_t keysSize(std::size_t NumKeys, std::size_t KeyBytes) {
+    return (NumKeys + 1) * sizeof(std::uint64_t) + padded(KeyBytes);
+  }
+
+  // takes the given cells over, which are sorted in place
+  void freeze(std::vector<std::tuple<R, C, const V *>> &Cells) {
+    std::sort(Cells.begin(), Cells.end(),
+              [](const std::tuple<R, C, const V *> &Lhs,
+                 const std::tuple<R, C, const V *> &Rhs) {
+                return std::tie(std::get<0>(Lhs), std::get<1>(Lhs)) <
+                       std::tie(std::get<0>(Rhs), std::get<1>(Rhs));
+              });
+    // IDs are assigned in the order of the keys, such that the cells of a
+    // row are sorted by both
+    for (auto &Cell : Cells) {
+      ColumnKeys.push_back(std::get<1>(Cell));
+    }
+    std::sort(ColumnKeys.begin(), ColumnKeys.end());
+    ColumnKeys.erase(std::unique(ColumnKeys.begin(), ColumnKeys.end()),
+                     ColumnKeys.end());
+    ColumnKeys.shrink_to_fit();
+    ColumnIndex = indexKeys(ColumnKeys);
+    OwnedColumnIds.reserve(Cells.size());
+    OwnedValues.reserve(Cells.size());
+    OwnedCellOffsets.push_back(0);
+    for (auto &Cell : Cells) {
+      if (RowKeys.empty() || RowKeys.back() < std::get<0>(Cell)) {
+        if (!RowKeys.empty()) {
+          OwnedCellOffsets.push_back(OwnedValues.size());
+        }
+        RowKeys.push_back(std::get<0>(Cell));
+      }
+      OwnedColumnIds.push_back(*findId(ColumnIndex, std::get<1>(Cell)));
+      OwnedValues.push_back(*std::get<2>(Cell));
+    }
+    if (!RowKeys.empty()) {
+      OwnedCellOffsets.push_back(OwnedValues.size());
+    }
+    RowIndex = indexKeys(RowKeys);
+    pointToOwnedColumns();
+  }
+
+public:
+  ColumnarTable() {
+    OwnedCellOffsets.push_back(0);
+    pointToOwnedColumns();
+  }
+
+  /**
+   * Freezes the contents of T.
+   */
+  explicit ColumnarTable(const Table<R, C, V> &T) {
+    std::vector<std::tuple<R, C, const V *>> Cells;
+    for (auto &RowAndCells : T) {
+      for (auto &Cell : RowAndCells.second) {
+        Cells.emplace_back(RowAndCells.first, Cell.first, &Cell.second);
+      }
+    }
+    freeze(Cells);
+  }
+
+  /**
+   * Freezes the contents of T.
+   */
+  explicit ColumnarTable(const DenseTable<R, C, V> &T) {
+    std::vector<std::tuple<R, C, const V *>> Cells;
+    T.forEachCell([&Cells](R Row, C Column, const V &Value) {
+      Cells.emplace_back(Row, Column, &Value);
+    });
+    freeze(Cells);
+  }
+
+  ~ColumnarTable() = default;
+
+  ColumnarTable(const ColumnarTable &) = delete;
+
+  ColumnarTable &operator=(const ColumnarTable &) = delete;
+
+  // moving a vector keeps its buffer, hence the columns stay valid
+  ColumnarTable(ColumnarTable &&) = default;
+
+  ColumnarTable &operator=(ColumnarTable &&) = default;
+
+  bool contains(R Row, C Column) const {
+    return findCell(Row, Column) != NumCells;
+  }
+
+  bool containsRow(R Row) const { return findId(RowIndex, Row) != nullptr; }
+
+  /**
+   * Returns the value at Row, Column, or a default-constructed value if
+   * there is no such cell.
+   */
+  V get(R Row, C Column) const {
+    std::size_t Cell = findCell(Row, Column);
+    return Cell != NumCells ? Values[Cell] : V();
+  }
+
+  std::unordered_map<C, V> row(R Row) const {
+    std::unordered_map<C, V> Cells;
+    if (const std::uint32_t *RowId = findId(RowIndex, Row)) {
+      for (std::uint64_t Cell = CellOffsets[*RowId];
+           Cell < CellOffsets[*RowId + 1]; ++Cell) {
+        Cells.emplace(ColumnKeys[ColumnIds[Cell]], Values[Cell]);
+      }
+    }
+    return Cells;
+  }
+
+  /**
+   * Calls Handler(Row, Column, Value) for every cell, sorted by row and by
+   * column.
+   */
+  template <typename HandlerT> void forEach(HandlerT Handler) const {
+    for (auto &RowAndId : RowIndex) {
+      for (std::uint64_t Cell = CellOffsets[RowAndId.second];
+           Cell < CellOffsets[RowAndId.second + 1]; ++Cell) {
+        Handler(RowAndId.first, ColumnKeys[ColumnIds[Cell]], Values[Cell]);
+      }
+    }
+  }
+
+  std::size_t size() const { return NumCells; }
+
+  bool empty() const { return NumCells == 0; }
+
+  std::size_t numRows() const { return RowKeys.size(); }
+
+  const std::vector<R> &rowKeys() const { return RowKeys; }
+
+  void save(const std::string &Path, RowEncoder EncodeRow,
+            ColumnEncoder EncodeColumn) const {
+    static_assert(std::is_trivially_copyable<V>::value,
+                  "only trivially copyable values can be saved");
+    std::ofstream OS(Path, std::ios::binary | std::ios::trunc);
+    if (!OS) {
+      throw std::ios_base::failure("could not write file: " + Path);
+    }
+    std::size_t RowKeyBytes = 0;
+    for (const R &Row : RowKeys) {
+      RowKeyBytes += EncodeRow(Row).size();
+    }
+    std::size_t ColumnKeyBytes = 0;
+    for (const C &Column : ColumnKeys) {
+      ColumnKeyBytes += EncodeColumn(Column).size();
+    }
+    FileHeader Header;
+    std::memcpy(Header.Magic, FileMagic, sizeof(FileMagic));
+    Header.ValueSize = sizeof(V);
+    Header.NumRows = RowKeys.size();
+    Header.NumColumns = ColumnKeys.size();
+    Header.NumCells = NumCells;
+    Header.RowKeyBytes = RowKeyBytes;
+    Header.ColumnKeyBytes = ColumnKeyBytes;
+    OS.write(reinterpret_cast<const char *>(&Header), sizeof(Header));
+    writeKeys(OS, RowKeys, EncodeRow);
+    writeKeys(OS, ColumnKeys, EncodeColumn);
+    OS.write(reinterpret_cast<const char *>(CellOffsets),
+             (RowKeys.size() + 1) * sizeof(std::uint64_t));
+    std::string Padding(padded(NumCells * sizeof(std::uint32_t)) -
+                            NumCells * sizeof(std::uint32_t),
+                        '\0');
+    OS.write(reinterpret_cast<const char *>(ColumnIds),
+             NumCells * sizeof(std::uint32_t));
+    OS.write(Padding.data(), Padding.size());
+    OS.write(reinterpret_cast<const char *>(Values), NumCells * sizeof(V));
+    if (!OS.flush()) {
+      throw std::ios_base::failure("could not write file: " + Path);
+    }
+  }
+
+  /**
+   * Loads a table that has been saved by save(). The cells remain in the
+   * mapped file, only the keys are decoded and kept in memory.
+   */
+  static ColumnarTable load(const std::string &Path, RowDecoder DecodeRow,
+                            ColumnDecoder DecodeColumn) {
+    static_assert(std::is_trivially_copyable<V>::value,
+                  "only trivially copyable values can be loaded");
+    static_assert(alignof(V) <= 8, "values must be at most 8-byte aligned");
+    ColumnarTable Result;
+    Result.Mapping = std::make_unique<MappedFile>(Path);
+    const char *Begin = Result.Mapping->data();
+    std::size_t Size = Result.Mapping->size();
+    FileHeader Header;
+    if (Size < sizeof(Header)) {
+      throw std::ios_base::failure("malformed result file: " + Path);
+    }
+    std::memcpy(&Header, Begin, sizeof(Header));
+    std::size_t Expected =
+        sizeof(Header) +
+        keysSize(Header.NumRows, Header.RowKeyBytes) +
+        keysSize(Header.NumColumns, Header.ColumnKeyBytes) +
+        (Header.NumRows + 1) * sizeof(std::uint64_t) +
+        padded(Header.NumCells * sizeof(std::uint32_t)) +
+        Header.NumCells * sizeof(V);
+    if (std::memcmp(Header.Magic, FileMagic, sizeof(FileMagic)) != 0 ||
+        Header.ValueSize != sizeof(V) || Size != Expected) {
+      throw std::ios_base::failure("malformed result file: " + Path);
+    }
+    const char *Pos = Begin + sizeof(Header);
+    Result.RowKeys =
+        readKeys<R>(Pos, Header.NumRows, Header.RowKeyBytes, DecodeRow);
+    Result.ColumnKeys = readKeys<C>(Pos, Header.NumColumns,
+                                    Header.ColumnKeyBytes, DecodeColumn);
+    Result.RowIndex = indexKeys(Result.RowKeys);
+    Result.ColumnIndex = indexKeys(Result.ColumnKeys);
+    Result.CellOffsets = reinterpret_cast<const std::uint64_t *>(Pos);
+    if (Result.CellOffsets[Header.NumRows] != Header.NumCells) {
+      throw std::ios_base::failure("malformed result file: " + Path);
+    }
+    Pos += (Header.NumRows + 1) * sizeof(std::uint64_t);
+    Result.ColumnIds = reinterpret_cast<const std::uint32_t *>(Pos);
+    Pos += padded(Header.NumCells * sizeof(std::uint32_t));
+    Result.Values = reinterpret_cast<const V *>(Pos);
+    Result.NumCells = Header.NumCells;
+    Result.OwnedCellOffsets.clear();
+    return Result;
+  }
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,216 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_DENSETABLE_H_
+#define PHASAR_UTILS_DENSETABLE_H_
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <phasar/Utils/FlatIdMap.h>
+#include <phasar/Utils/Interner.h>
+
+namespace psr {
+
+/**
+ * A table whose row and column keys are replaced by the dense IDs of two
+ * interners, which may be shared with other tables. The rows are kept in a
+ * vector indexed by the row ID, each row being a FlatIdMap from column IDs
+ * to values. Hence, a cell costs a slot of a column ID and a value instead
+ * of a hash node that holds both keys, and looking up a row is an array
+ * access.
+ *
+ * Rows are added on demand. Inserting into a row that exists, see addRow(),
+ * neither moves nor modifies any other row, hence distinct rows may be
+ * written by distinct threads if the interners are synchronized.
+ *
+ * @param <R> The type of row keys.
+ * @param <C> The type of column keys.
+ * @param <V> The type of values, which must be default-constructible.
+ */
+template <typename R, typename C, typename V> class DenseTable {
+public:
+  using IdType = std::uint32_t;
+  using RowType = FlatIdMap<IdType, V>;
+
+private:
+  Interner<R> *RowIds;
+  Interner<C> *ColumnIds;
+  // the row of the key with ID Id is Rows[Id], if there is one
+  std::vector<RowType> Rows;
+
+  const RowType *findRow(R RowKey) const {
+    auto Id = RowIds->find(RowKey);
+    return Id && *Id < Rows.size() ? &Rows[*Id] : nullptr;
+  }
+
+  RowType *findRow(R RowKey) {
+    return const_cast<RowType *>(
+        static_cast<const DenseTable *>(this)->findRow(RowKey));
+  }
+
+  RowType &getOrInsertRow(R RowKey) {
+    IdType Id = RowIds->getOrInsert(RowKey);
+    if (Id >= Rows.size()) {
+      Rows.resize(Id + 1);
+    }
+    return Rows[Id];
+  }
+
+public:
+  DenseTable(Interner<R> &RowIds, Interner<C> &ColumnIds)
+      : RowIds(&RowIds), ColumnIds(&ColumnIds) {}
+
+  ~DenseTable() = default;
+
+  DenseTable(const DenseTable &) = default;
+
+  DenseTable &operator=(const DenseTable &) = default;
+
+  DenseTable(DenseTable &&) = default;
+
+  DenseTable &operator=(DenseTable &&) = default;
+
+  Interner<R> &rowIds() const { return *RowIds; }
+
+  Interner<C> &columnIds() const { return *ColumnIds; }
+
+  /**
+   * Makes sure that the row of RowKey exists, such that inserting into it
+   * does not modify the table itself.
+   */
+  void addRow(R RowKey) { getOrInsertRow(RowKey); }
+
+  /**
+   * Returns the value of the given cell, a default-constructed value is
+   * inserted if there is none.
+   */
+  V &get(R RowKey, C ColumnKey) {
+    return getOrInsertRow(RowKey)[ColumnIds->getOrInsert(ColumnKey)];
+  }
+
+  /**
+   * Returns a pointer to the value of the given cell, or nullptr if there is
+   * none. In contrast to get(), no cell is inserted.
+   */
+  V *find(R RowKey, C ColumnKey) {
+    RowType *Row = findRow(RowKey);
+    auto ColumnId = Row ? ColumnIds->find(ColumnKey) : std::nullopt;
+    return ColumnId ? Row->find(*ColumnId) : nullptr;
+  }
+
+  const V *find(R RowKey, C ColumnKey) const {
+    const RowType *Row = findRow(RowKey);
+    auto ColumnId = Row ? ColumnIds->find(ColumnKey) : std::nullopt;
+    return ColumnId ? Row->find(*ColumnId) : nullptr;
+  }
+
+  bool contains(R RowKey, C ColumnKey) const {
+    return find(RowKey, ColumnKey) != nullptr;
+  }
+
+  /**
+   * Returns true if the row of RowKey holds at least one cell.
+   */
+  bool containsRow(R RowKey) const {
+    const RowType *Row = findRow(RowKey);
+    return Row && !Row->empty();
+  }
+
+  void insert(R RowKey, C ColumnKey, V Value) {
+    get(RowKey, ColumnKey) = std::move(Value);
+  }
+
+  /**
+   * Removes the given cell and returns true if it has been there.
+   */
+  bool remove(R RowKey, C ColumnKey) {
+    RowType *Row = findRow(RowKey);
+    auto ColumnId = Row ? ColumnIds->find(ColumnKey) : std::nullopt;
+    return ColumnId && Row->erase(*ColumnId);
+  }
+
+  /**
+   * Removes all cells of the given row and releases their memory.
+   */
+  void remove(R RowKey) {
+    if (RowType *Row = findRow(RowKey)) {
+      Row->clear();
+    }
+  }
+
+  void clear() { std::vector<RowType>().swap(Rows); }
+
+  /**
+   * Returns the number of cells, which takes a pass over the rows.
+   */
+  std::size_t size() const {
+    std::size_t NumCells = 0;
+    for (auto &Row : Rows) {
+      NumCells += Row.size();
+    }
+    return NumCells;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  /**
+   * Returns a copy of the given row.
+   */
+  std::unordered_map<C, V> row(R RowKey) const {
+    std::unordered_map<C, V> Result;
+    forEachInRow(RowKey, [&Result](C ColumnKey, const V &Value) {
+      Result.emplace(ColumnKey, Value);
+    });
+    return Result;
+  }
+
+  /**
+   * Calls Handler(c, v) for every cell of the given row.
+   */
+  template <typename HandlerT>
+  void forEachInRow(R RowKey, HandlerT Handler) const {
+    if (const RowType *Row = findRow(RowKey)) {
+      for (auto &Cell : *Row) {
+        Handler(ColumnIds->get(Cell.first), Cell.second);
+      }
+    }
+  }
+
+  /**
+   * Calls Handler(r, c, v) for every cell. The rows are visited in the order
+   * of their IDs, the cells of a row in no particular order.
+   */
+  template <typename HandlerT> void forEachCell(HandlerT Handler) const {
+    for (IdType Id = 0; Id < Rows.size(); ++Id) {
+      for (auto &Cell : Rows[Id]) {
+        Handler(RowIds->get(Id), ColumnIds->get(Cell.first), Cell.second);
+      }
+    }
+  }
+
+  /**
+   * Calls Handler(r, row) for every row that holds at least one cell, where
+   * row is the FlatIdMap from column IDs to values.
+   */
+  template <typename HandlerT> void forEachRow(HandlerT Handler) const {
+    for (IdType Id = 0; Id < Rows.size(); ++Id) {
+      if (!Rows[Id].empty()) {
+        Handler(RowIds->get(Id), Rows[Id]);
+      }
+    }
+  }
+};
+
+} // namespace psr
+
+#endif
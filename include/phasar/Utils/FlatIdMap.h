@@ -0,0 +1,344 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_FLATIDMAP_H_
+#define PHASAR_UTILS_FLATIDMAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace psr {
+
+/**
+ * Packs two IDs, e.g. the ones of a node and a fact, into a single key of a
+ * FlatIdMap or FlatIdSet.
+ */
+inline std::uint64_t combineIds(std::uint32_t First, std::uint32_t Second) {
+  return (static_cast<std::uint64_t>(First) << 32) | Second;
+}
+
+inline std::uint32_t firstIdOf(std::uint64_t Ids) {
+  return static_cast<std::uint32_t>(Ids >> 32);
+}
+
+inline std::uint32_t secondIdOf(std::uint64_t Ids) {
+  return static_cast<std::uint32_t>(Ids);
+}
+
+namespace detail {
+
+/**
+ * An open-addressing hash table with linear probing, which stores its slots
+ * in a single array. The largest value of KeyT marks empty slots and cannot
+ * be used as a key. Entries are erased by shifting the following entries of
+ * their probe sequence back, hence there are no tombstones. Tables of up to
+ * MaxFullSlots slots are filled completely, as probing them is cheap anyway;
+ * larger ones up to a load factor of 3/4.
+ *
+ * @param <KeyT> An unsigned integer type, usually IDs handed out by an
+ * Interner.
+ * @param <SlotT> Either KeyT itself or a pair of KeyT and a value.
+ */
+template <typename KeyT, typename SlotT> class FlatIdTable {
+protected:
+  static constexpr KeyT EmptyKey = std::numeric_limits<KeyT>::max();
+  static constexpr std::uint32_t MaxFullSlots = 8;
+
+  std::unique_ptr<SlotT[]> Slots;
+  // a power of two, or zero as long as nothing has been inserted
+  std::uint32_t NumSlots = 0;
+  std::uint32_t NumEntries = 0;
+
+  static KeyT &keyOf(KeyT &Slot) { return Slot; }
+  static KeyT keyOf(const KeyT &Slot) { return Slot; }
+  template <typename V> static KeyT &keyOf(std::pair<KeyT, V> &Slot) {
+    return Slot.first;
+  }
+  template <typename V> static KeyT keyOf(const std::pair<KeyT, V> &Slot) {
+    return Slot.first;
+  }
+
+  // the low bits of consecutive IDs are distinct already, the high bits of
+  // combined IDs are folded in
+  std::uint32_t indexOf(KeyT Key) const {
+    std::uint64_t Hash = static_cast<std::uint64_t>(Key);
+    return static_cast<std::uint32_t>(Hash ^ (Hash >> 32)) & (NumSlots - 1);
+  }
+
+  // returns the slot that holds Key, or the empty slot it would be put in,
+  // or NumSlots if the table is full and does not hold Key
+  std::uint32_t probe(KeyT Key) const {
+    std::uint32_t Idx = indexOf(Key);
+    for (std::uint32_t Step = 0; Step < NumSlots; ++Step) {
+      if (keyOf(Slots[Idx]) == Key || keyOf(Slots[Idx]) == EmptyKey) {
+        return Idx;
+      }
+      Idx = (Idx + 1) & (NumSlots - 1);
+    }
+    return NumSlots;
+  }
+
+  bool needsGrowth() const {
+    return NumSlots <= MaxFullSlots ? NumEntries == NumSlots
+                                    : 4 * (NumEntries + 1) > 3 * NumSlots;
+  }
+
+  static std::unique_ptr<SlotT[]> allocate(std::uint32_t Size) {
+    std::unique_ptr<SlotT[]> NewSlots(new SlotT[Size]);
+    for (std::uint32_t Idx = 0; Idx < Size; ++Idx) {
+      keyOf(NewSlots[Idx]) = EmptyKey;
+    }
+    return NewSlots;
+  }
+
+  void grow() {
+    std::uint32_t OldSize = NumSlots;
+    std::unique_ptr<SlotT[]> OldSlots = std::move(Slots);
+    NumSlots = OldSize ? 2 * OldSize : 1;
+    Slots = allocate(NumSlots);
+    for (std::uint32_t Idx = 0; Idx < OldSize; ++Idx) {
+      if (keyOf(OldSlots[Idx]) != EmptyKey) {
+        Slots[probe(keyOf(OldSlots[Idx]))] = std::move(OldSlots[Idx]);
+      }
+    }
+  }
+
+  // returns the slot of Key and whether it has been inserted
+  std::pair<std::uint32_t, bool> findOrInsertSlot(KeyT Key) {
+    std::uint32_t Idx = probe(Key);
+    if (Idx != NumSlots && keyOf(Slots[Idx]) == Key) {
+      return {Idx, false};
+    }
+    if (needsGrowth()) {
+      grow();
+      Idx = probe(Key);
+    }
+    keyOf(Slots[Idx]) = Key;
+    ++NumEntries;
+    return {Idx, true};
+  }
+
+  const SlotT *findSlot(KeyT Key) const {
+    std::uint32_t Idx = probe(Key);
+    return Idx != NumSlots && keyOf(Slots[Idx]) == Key ? &Slots[Idx]
+                                                        : nullptr;
+  }
+
+  SlotT *findSlot(KeyT Key) {
+    return const_cast<SlotT *>(
+        static_cast<const FlatIdTable *>(this)->findSlot(Key));
+  }
+
+public:
+  /**
+   * Iterates over the occupied slots. Keys must not be modified.
+   */
+  template <typename SlotRefT> class SlotIterator {
+    SlotRefT *Pos;
+    SlotRefT *End;
+
+    void skipEmpty() {
+      while (Pos != End && keyOf(*Pos) == EmptyKey) {
+        ++Pos;
+      }
+    }
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<SlotRefT>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = SlotRefT *;
+    using reference = SlotRefT &;
+
+    SlotIterator(SlotRefT *Pos, SlotRefT *End) : Pos(Pos), End(End) {
+      skipEmpty();
+    }
+
+    SlotRefT &operator*() const { return *Pos; }
+
+    SlotRefT *operator->() const { return Pos; }
+
+    SlotIterator &operator++() {
+      ++Pos;
+      skipEmpty();
+      return *this;
+    }
+
+    friend bool operator==(const SlotIterator &Lhs, const SlotIterator &Rhs) {
+      return Lhs.Pos == Rhs.Pos;
+    }
+
+    friend bool operator!=(const SlotIterator &Lhs, const SlotIterator &Rhs) {
+      return Lhs.Pos != Rhs.Pos;
+    }
+  };
+
+  using iterator = SlotIterator<SlotT>;
+  using const_iterator = SlotIterator<const SlotT>;
+
+  FlatIdTable() = default;
+
+  ~FlatIdTable() = default;
+
+  FlatIdTable(const FlatIdTable &Other)
+      : NumSlots(Other.NumSlots), NumEntries(Other.NumEntries) {
+    if (NumSlots) {
+      Slots.reset(new SlotT[NumSlots]);
+      std::copy(Other.Slots.get(), Other.Slots.get() + NumSlots, Slots.get());
+    }
+  }
+
+  FlatIdTable &operator=(const FlatIdTable &Other) {
+    if (this != &Other) {
+      *this = FlatIdTable(Other);
+    }
+    return *this;
+  }
+
+  FlatIdTable(FlatIdTable &&Other) noexcept
+      : Slots(std::move(Other.Slots)), NumSlots(Other.NumSlots),
+        NumEntries(Other.NumEntries) {
+    Other.NumSlots = 0;
+    Other.NumEntries = 0;
+  }
+
+  FlatIdTable &operator=(FlatIdTable &&Other) noexcept {
+    Slots = std::move(Other.Slots);
+    NumSlots = Other.NumSlots;
+    NumEntries = Other.NumEntries;
+    Other.NumSlots = 0;
+    Other.NumEntries = 0;
+    return *this;
+  }
+
+  bool contains(KeyT Key) const { return findSlot(Key) != nullptr; }
+
+  /**
+   * Removes Key and returns true if it has been there.
+   */
+  bool erase(KeyT Key) {
+    std::uint32_t Hole = probe(Key);
+    if (Hole == NumSlots || keyOf(Slots[Hole]) != Key) {
+      return false;
+    }
+    // move entries that would not be found across the hole back into it; a
+    // full table has no empty slot, there the scan wraps around to the hole
+    std::uint32_t Mask = NumSlots - 1;
+    for (std::uint32_t Idx = (Hole + 1) & Mask;
+         Idx != Hole && keyOf(Slots[Idx]) != EmptyKey;
+         Idx = (Idx + 1) & Mask) {
+      std::uint32_t Home = indexOf(keyOf(Slots[Idx]));
+      if (((Idx - Home) & Mask) >= ((Idx - Hole) & Mask)) {
+        Slots[Hole] = std::move(Slots[Idx]);
+        Hole = Idx;
+      }
+    }
+    // reset the slot, such that its value is released
+    Slots[Hole] = SlotT();
+    keyOf(Slots[Hole]) = EmptyKey;
+    --NumEntries;
+    return true;
+  }
+
+  std::size_t size() const { return NumEntries; }
+
+  bool empty() const { return NumEntries == 0; }
+
+  /**
+   * Removes all entries and releases the slots.
+   */
+  void clear() {
+    Slots.reset();
+    NumSlots = 0;
+    NumEntries = 0;
+  }
+
+  iterator begin() { return iterator(Slots.get(), Slots.get() + NumSlots); }
+
+  iterator end() {
+    return iterator(Slots.get() + NumSlots, Slots.get() + NumSlots);
+  }
+
+  const_iterator begin() const {
+    return const_iterator(Slots.get(), Slots.get() + NumSlots);
+  }
+
+  const_iterator end() const {
+    return const_iterator(Slots.get() + NumSlots, Slots.get() + NumSlots);
+  }
+};
+
+} // namespace detail
+
+/**
+ * A map from IDs, see Interner, to values that is designed to be small: it
+ * occupies 16 bytes plus one slot of key and value per entry, where small
+ * maps are full and larger ones are filled up to 3/4. Many of them are used
+ * as the rows of tables that are indexed by IDs, where most rows hold a
+ * handful of entries.
+ *
+ * Inserting or erasing an entry invalidates iterators and pointers to
+ * values.
+ *
+ * @param <KeyT> An unsigned integer type; its largest value is reserved.
+ * @param <ValueT> The type of values, which must be default-constructible.
+ */
+template <typename KeyT, typename ValueT>
+class FlatIdMap : public detail::FlatIdTable<KeyT, std::pair<KeyT, ValueT>> {
+  using Base = detail::FlatIdTable<KeyT, std::pair<KeyT, ValueT>>;
+
+public:
+  ValueT *find(KeyT Key) {
+    auto *Slot = this->findSlot(Key);
+    return Slot ? &Slot->second : nullptr;
+  }
+
+  const ValueT *find(KeyT Key) const {
+    auto *Slot = this->findSlot(Key);
+    return Slot ? &Slot->second : nullptr;
+  }
+
+  /**
+   * Returns the value of Key and whether it has been inserted, a new value
+   * is default-constructed.
+   */
+  std::pair<ValueT *, bool> tryEmplace(KeyT Key) {
+    auto Slot = this->findOrInsertSlot(Key);
+    return {&this->Slots[Slot.first].second, Slot.second};
+  }
+
+  ValueT &operator[](KeyT Key) { return *tryEmplace(Key).first; }
+};
+
+/**
+ * A set of IDs, see Interner, in the fashion of FlatIdMap: it occupies 16
+ * bytes plus one key per slot.
+ *
+ * @param <KeyT> An unsigned integer type; its largest value is reserved.
+ */
+template <typename KeyT>
+class FlatIdSet : public detail::FlatIdTable<KeyT, KeyT> {
+public:
+  /**
+   * Adds Key and returns true if it has not been there.
+   */
+  bool insert(KeyT Key) { return this->findOrInsertSlot(Key).second; }
+
+  std::size_t count(KeyT Key) const { return this->contains(Key) ? 1 : 0; }
+};
+
+} // namespace psr
+
+#endif
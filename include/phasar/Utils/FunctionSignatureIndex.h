@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_FUNCTIONSIGNATUREINDEX_H_
+#define PHASAR_UTILS_FUNCTIONSIGNATUREINDEX_H_
+
+#include <cstddef>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include <llvm/ADT/ArrayRef.h>
+
+namespace llvm {
+class Function;
+class FunctionType;
+class Type;
+} // namespace llvm
+
+namespace psr {
+
+/**
+ * Maps function signatures to the functions that match them in the sense of
+ * matchesSignature(), i.e. to the functions with the same return and
+ * parameter types, regardless of whether either takes variable arguments.
+ * Looking up the possible targets of an indirect call is a single hash
+ * lookup instead of a scan over all functions.
+ */
+class FunctionSignatureIndex {
+private:
+  // the return type followed by the parameter types
+  using Signature = std::vector<const llvm::Type *>;
+
+  struct SignatureHash {
+    std::size_t operator()(const Signature &S) const;
+  };
+
+  std::unordered_map<Signature, std::vector<const llvm::Function *>,
+                     SignatureHash>
+      Candidates;
+  std::size_t NumFunctions = 0;
+
+  static Signature getSignature(const llvm::FunctionType *FType);
+
+public:
+  /**
+   * Indexes Functions. If AddressTakenOnly is set, functions whose address
+   * is never taken are left out since they cannot be called indirectly.
+   * This is only sound if all uses of the functions are visible, e.g. once
+   * the modules have been linked for a whole-program analysis.
+   */
+  explicit FunctionSignatureIndex(
+      const std::set<const llvm::Function *> &Functions,
+      bool AddressTakenOnly = false);
+
+  /**
+   * Returns the indexed functions that match FType, in the order of the
+   * functions passed to the constructor.
+   */
+  llvm::ArrayRef<const llvm::Function *>
+  getCandidates(const llvm::FunctionType *FType) const;
+
+  std::size_t size() const { return NumFunctions; }
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_HASHEDTUPLE_H_
+#define PHASAR_UTILS_HASHEDTUPLE_H_
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+
+namespace psr {
+
+/**
+ * Mixes the hash value of Value into Seed.
+ */
+template <typename T> void hashCombine(std::size_t &Seed, const T &Value) {
+  Seed ^= std::hash<T>()(Value) + 0x9e3779b9 + (Seed << 6) + (Seed >> 2);
+}
+
+/**
+ * A tuple that carries its hash value, which is computed once on
+ * construction. Used as a key of hashed containers, it avoids rehashing the
+ * elements on every probe, and keys with different hash values are told
+ * apart without comparing their elements.
+ *
+ * @param <Ts> The types of the elements, each of which must be hashable by
+ * std::hash.
+ */
+template <typename... Ts> struct HashedTuple {
+  std::tuple<Ts...> Values;
+  std::size_t Hash;
+
+  explicit HashedTuple(const Ts &... Args) : Values(Args...), Hash(0) {
+    std::apply(
+        [this](const auto &... Elems) { (hashCombine(Hash, Elems), ...); },
+        Values);
+  }
+
+  friend bool operator==(const HashedTuple &Lhs, const HashedTuple &Rhs) {
+    return Lhs.Hash == Rhs.Hash && Lhs.Values == Rhs.Values;
+  }
+
+  friend bool operator!=(const HashedTuple &Lhs, const HashedTuple &Rhs) {
+    return !(Lhs == Rhs);
+  }
+};
+
+} // namespace psr
+
+namespace std {
+
+template <typename... Ts> struct hash<psr::HashedTuple<Ts...>> {
+  size_t operator()(const psr::HashedTuple<Ts...> &Key) const {
+    return Key.Hash;
+  }
+};
+
+} // namespace std
+
+#endif
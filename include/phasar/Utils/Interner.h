@@ -0,0 +1,187 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_INTERNER_H_
+#define PHASAR_UTILS_INTERNER_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Assigns dense 32-bit IDs to values of type T in the order in which they are
+ * first seen. The IDs can be used as indices into vectors, which replaces a
+ * hash lookup by a plain array access for all data that is stored per value.
+ * IDs are never reused and stay valid for the lifetime of the interner.
+ *
+ * The values are stored in chunks that are never moved, and the IDs are
+ * found through an open-addressing table of IDs, such that an interned value
+ * costs little more than the value itself. If the interner is synchronized,
+ * it may be shared between threads; get() never takes a lock, as an ID can
+ * only be known once its value has been stored.
+ *
+ * @param <T> The type of values to be interned.
+ */
+template <typename T> class Interner {
+public:
+  using IdType = std::uint32_t;
+
+private:
+  static constexpr IdType NoId = ~IdType(0);
+  // chunk K holds 2^(FirstChunkBits + K) values, the ones whose IDs follow
+  // those of chunk K - 1
+  static constexpr unsigned FirstChunkBits = 6;
+  static constexpr unsigned NumChunks = 33 - FirstChunkBits;
+
+  // the capacity of a chunk is reserved up front, hence its values are
+  // never moved
+  std::array<std::vector<T>, NumChunks> Chunks;
+  std::atomic<IdType> NumValues{0};
+  // the IDs hashed by their values; a power of two in size
+  std::vector<IdType> Slots;
+  bool Synchronized;
+  mutable std::shared_mutex Mutex;
+
+  static unsigned chunkOf(IdType Id) {
+    std::uint64_t Pos = (static_cast<std::uint64_t>(Id) >> FirstChunkBits) + 1;
+    return 63 - __builtin_clzll(Pos);
+  }
+
+  static IdType chunkBegin(unsigned Chunk) {
+    return ((IdType(1) << Chunk) - 1) << FirstChunkBits;
+  }
+
+  std::size_t slotOf(const T &Value) const {
+    std::uint64_t Hash = std::hash<T>()(Value);
+    return ((Hash * 0x9E3779B97F4A7C15ULL) >> 32) & (Slots.size() - 1);
+  }
+
+  // returns the slot that holds the ID of Value, or the empty slot it would
+  // be put in
+  std::size_t probe(const T &Value) const {
+    std::size_t Idx = slotOf(Value);
+    while (Slots[Idx] != NoId && !(get(Slots[Idx]) == Value)) {
+      Idx = (Idx + 1) & (Slots.size() - 1);
+    }
+    return Idx;
+  }
+
+  void grow() {
+    std::vector<IdType> OldSlots(Slots.empty() ? 8 : 2 * Slots.size(), NoId);
+    Slots.swap(OldSlots);
+    for (IdType Id : OldSlots) {
+      if (Id != NoId) {
+        Slots[probe(get(Id))] = Id;
+      }
+    }
+  }
+
+  std::optional<IdType> findUnlocked(const T &Value) const {
+    if (Slots.empty()) {
+      return std::nullopt;
+    }
+    IdType Id = Slots[probe(Value)];
+    return Id != NoId ? std::optional<IdType>(Id) : std::nullopt;
+  }
+
+  IdType insertUnlocked(const T &Value) {
+    // keep the load factor at or below 1/2
+    if (2 * (NumValues + 1) > Slots.size()) {
+      grow();
+    }
+    std::size_t Idx = probe(Value);
+    if (Slots[Idx] != NoId) {
+      return Slots[Idx];
+    }
+    IdType Id = NumValues;
+    unsigned Chunk = chunkOf(Id);
+    if (Chunks[Chunk].empty()) {
+      Chunks[Chunk].reserve(std::size_t(1) << (Chunk + FirstChunkBits));
+    }
+    Chunks[Chunk].push_back(Value);
+    Slots[Idx] = Id;
+    ++NumValues;
+    return Id;
+  }
+
+public:
+  /**
+   * @param Synchronized if set, the interner may be used by multiple threads
+   * at the same time.
+   */
+  explicit Interner(bool Synchronized = false) : Synchronized(Synchronized) {}
+
+  ~Interner() = default;
+
+  Interner(const Interner &) = delete;
+
+  Interner &operator=(const Interner &) = delete;
+
+  /**
+   * Returns the ID of the given value, a new ID is assigned if the value has
+   * not been seen before.
+   */
+  IdType getOrInsert(const T &Value) {
+    if (!Synchronized) {
+      return insertUnlocked(Value);
+    }
+    {
+      std::shared_lock<std::shared_mutex> Lock(Mutex);
+      if (auto Id = findUnlocked(Value)) {
+        return *Id;
+      }
+    }
+    std::unique_lock<std::shared_mutex> Lock(Mutex);
+    return insertUnlocked(Value);
+  }
+
+  /**
+   * Returns the ID of the given value, or std::nullopt if it has not been
+   * interned.
+   */
+  std::optional<IdType> find(const T &Value) const {
+    if (!Synchronized) {
+      return findUnlocked(Value);
+    }
+    std::shared_lock<std::shared_mutex> Lock(Mutex);
+    return findUnlocked(Value);
+  }
+
+  const T &get(IdType Id) const {
+    unsigned Chunk = chunkOf(Id);
+    return Chunks[Chunk][Id - chunkBegin(Chunk)];
+  }
+
+  std::size_t size() const { return NumValues; }
+
+  bool empty() const { return NumValues == 0; }
+
+  /**
+   * Forgets all values and releases their memory. Must not be called while
+   * other threads use the interner.
+   */
+  void clear() {
+    for (auto &Chunk : Chunks) {
+      std::vector<T>().swap(Chunk);
+    }
+    std::vector<IdType>().swap(Slots);
+    NumValues = 0;
+  }
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_JSONSTREAMWRITER_H_
+#define PHASAR_UTILS_JSONSTREAMWRITER_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <json.hpp>
+
+namespace psr {
+
+/**
+ * Writes a JSON document to a file piece by piece, such that large results
+ * never have to be held in memory as a whole. Objects and arrays are opened
+ * and closed explicitly; the leaves are written as complete json values.
+ * Separators and indentation are inserted as needed.
+ *
+ * Opening or writing the file throws std::ios_base::failure on errors.
+ * Keys are not checked for uniqueness.
+ */
+class JsonStreamWriter {
+public:
+  using json = nlohmann::json;
+
+private:
+  struct Scope {
+    char Closing;
+    bool Empty;
+  };
+  std::ofstream OS;
+  std::string Path;
+  std::vector<Scope> Scopes;
+  bool AfterKey = false;
+
+  void beginValue();
+  void beginScope(char Opening, char Closing);
+  void endScope(char Closing);
+  void indent();
+  void check();
+
+public:
+  explicit JsonStreamWriter(const std::string &Path);
+
+  ~JsonStreamWriter();
+
+  JsonStreamWriter(const JsonStreamWriter &) = delete;
+
+  JsonStreamWriter &operator=(const JsonStreamWriter &) = delete;
+
+  void beginObject();
+
+  void endObject();
+
+  void beginArray();
+
+  void endArray();
+
+  /**
+   * Writes the key of the next member of the innermost object.
+   */
+  void key(const std::string &Key);
+
+  /**
+   * Writes a complete value as the next member or element.
+   */
+  void value(const json &Value);
+
+  /**
+   * Closes all scopes that are still open and flushes the file.
+   */
+  void close();
+
+  const std::string &getPath() const { return Path; }
+};
+
+} // namespace psr
+
+#endif
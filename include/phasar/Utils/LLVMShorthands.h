@@ -189,6 +189,20 @@ std::size_t computeModuleHash(llvm::Module *M, bool considerIdentifier);
  */
 std::size_t computeModuleHash(const llvm::Module *M);
 
+/**
+ * Computes a hash value for the body of a function that does not change as
+ * long as the function itself is not changed. In contrast to the module
+ * hash, it ignores value names, debug information and other meta data, and
+ * refers to global values by name only, hence changes to other functions
+ * do not affect it. It covers the flags of the instructions, e.g. nsw or
+ * volatile, the incoming blocks of PHI nodes and the attributes of the
+ * function and of its call sites.
+ * @brief Computes a stable hash value for a given LLVM Function.
+ * @param F LLVM Function.
+ * @return Hash value.
+ */
+std::size_t computeFunctionHash(const llvm::Function *F);
+
 } // namespace psr
 
 #endif
@@ -0,0 +1,227 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_LRUCACHE_H_
+#define PHASAR_UTILS_LRUCACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/**
+ * A hash map with an optional size bound. If the capacity is zero, the cache
+ * is unbounded and behaves like a plain hash map. Otherwise, inserting into
+ * a full cache evicts the least recently used entry, where an entry counts as
+ * used when it is inserted or returned by lookup().
+ *
+ * The entries are stored in a single open-addressing table with linear
+ * probing, such that inserting an entry does not allocate a node. The order
+ * of use is an intrusive list of slot indices within that table. Removing an
+ * entry shifts the following entries of its probe sequence backwards, hence
+ * no tombstones are needed.
+ *
+ * The cache is not synchronized. Note that lookup() modifies a bounded cache,
+ * whereas find() never modifies the cache. References to cached values are
+ * invalidated by the next insertion.
+ *
+ * @param <KeyT> The type of keys.
+ * @param <ValueT> The type of cached values.
+ * @param <HashT> The hash function for keys.
+ */
+template <typename KeyT, typename ValueT, typename HashT = std::hash<KeyT>>
+class LRUCache {
+private:
+  static constexpr std::uint32_t None =
+      std::numeric_limits<std::uint32_t>::max();
+
+  struct Entry {
+    KeyT Key;
+    ValueT Value;
+    std::size_t Hash;
+    // neighbours in the order of use, the more recently used one is Prev
+    std::uint32_t Prev;
+    std::uint32_t Next;
+  };
+
+  // the number of slots is zero or a power of two and at most three quarters
+  // of them are occupied, hence every probe sequence ends at an empty slot
+  std::vector<std::optional<Entry>> Slots;
+  std::size_t NumEntries = 0;
+  // the most and the least recently used entries
+  std::uint32_t Head = None;
+  std::uint32_t Tail = None;
+  std::size_t Capacity;
+  std::size_t NumEvictions = 0;
+  HashT Hasher;
+
+  std::size_t mask() const { return Slots.size() - 1; }
+
+  std::uint32_t findSlot(const KeyT &Key, std::size_t Hash) const {
+    if (Slots.empty()) {
+      return None;
+    }
+    for (std::size_t Idx = Hash & mask(); Slots[Idx];
+         Idx = (Idx + 1) & mask()) {
+      if (Slots[Idx]->Hash == Hash && Slots[Idx]->Key == Key) {
+        return Idx;
+      }
+    }
+    return None;
+  }
+
+  void unlink(std::uint32_t Idx) {
+    Entry &E = *Slots[Idx];
+    (E.Prev != None ? Slots[E.Prev]->Next : Head) = E.Next;
+    (E.Next != None ? Slots[E.Next]->Prev : Tail) = E.Prev;
+  }
+
+  void pushFront(std::uint32_t Idx) {
+    Entry &E = *Slots[Idx];
+    E.Prev = None;
+    E.Next = Head;
+    (Head != None ? Slots[Head]->Prev : Tail) = Idx;
+    Head = Idx;
+  }
+
+  // lets the neighbours of the entry that has just been moved to Idx point
+  // to its new slot
+  void relink(std::uint32_t Idx) {
+    Entry &E = *Slots[Idx];
+    (E.Prev != None ? Slots[E.Prev]->Next : Head) = Idx;
+    (E.Next != None ? Slots[E.Next]->Prev : Tail) = Idx;
+  }
+
+  std::uint32_t place(Entry &&E) {
+    std::size_t Idx = E.Hash & mask();
+    while (Slots[Idx]) {
+      Idx = (Idx + 1) & mask();
+    }
+    Slots[Idx].emplace(std::move(E));
+    pushFront(Idx);
+    return Idx;
+  }
+
+  void grow() {
+    std::vector<std::optional<Entry>> Old(Slots.empty() ? 8 : 2 * Slots.size());
+    Old.swap(Slots);
+    // re-inserting from the least to the most recently used entry keeps the
+    // order of use
+    std::uint32_t Idx = Tail;
+    Head = Tail = None;
+    while (Idx != None) {
+      std::uint32_t Prev = Old[Idx]->Prev;
+      place(std::move(*Old[Idx]));
+      Idx = Prev;
+    }
+  }
+
+  void erase(std::uint32_t Hole) {
+    unlink(Hole);
+    Slots[Hole].reset();
+    --NumEntries;
+    for (std::size_t Idx = (Hole + 1) & mask(); Slots[Idx];
+         Idx = (Idx + 1) & mask()) {
+      std::size_t Home = Slots[Idx]->Hash & mask();
+      // move the entry into the hole unless the hole lies before its home
+      // slot on its probe sequence
+      if (((Idx - Home) & mask()) >= ((Idx - Hole) & mask())) {
+        Slots[Hole] = std::move(Slots[Idx]);
+        Slots[Idx].reset();
+        relink(Hole);
+        Hole = Idx;
+      }
+    }
+  }
+
+public:
+  explicit LRUCache(std::size_t Capacity = 0) : Capacity(Capacity) {}
+
+  ~LRUCache() = default;
+
+  LRUCache(const LRUCache &) = delete;
+
+  LRUCache &operator=(const LRUCache &) = delete;
+
+  /**
+   * Returns the value cached for Key, or nullptr if there is none, without
+   * marking the entry as used.
+   */
+  const ValueT *find(const KeyT &Key) const {
+    std::uint32_t Idx = findSlot(Key, Hasher(Key));
+    return Idx != None ? &Slots[Idx]->Value : nullptr;
+  }
+
+  /**
+   * Returns the value cached for Key, or nullptr if there is none, and marks
+   * the entry as the most recently used one.
+   */
+  ValueT *lookup(const KeyT &Key) {
+    std::uint32_t Idx = findSlot(Key, Hasher(Key));
+    if (Idx == None) {
+      return nullptr;
+    }
+    if (isBounded() && Idx != Head) {
+      unlink(Idx);
+      pushFront(Idx);
+    }
+    return &Slots[Idx]->Value;
+  }
+
+  /**
+   * Caches Value for Key unless a value is already cached for it, and returns
+   * the cached value. May evict the least recently used entry.
+   */
+  ValueT &insert(const KeyT &Key, ValueT Value) {
+    std::size_t Hash = Hasher(Key);
+    std::uint32_t Idx = findSlot(Key, Hash);
+    if (Idx != None) {
+      if (isBounded() && Idx != Head) {
+        unlink(Idx);
+        pushFront(Idx);
+      }
+      return Slots[Idx]->Value;
+    }
+    if (4 * (NumEntries + 1) > 3 * Slots.size()) {
+      grow();
+    }
+    place(Entry{Key, std::move(Value), Hash, None, None});
+    ++NumEntries;
+    if (isBounded() && NumEntries > Capacity) {
+      erase(Tail);
+      ++NumEvictions;
+    }
+    // the new entry may have been shifted by the eviction, but it is still
+    // the most recently used one
+    return Slots[Head]->Value;
+  }
+
+  bool isBounded() const { return Capacity != 0; }
+
+  std::size_t size() const { return NumEntries; }
+
+  std::size_t capacity() const { return Capacity; }
+
+  std::size_t getNumEvictions() const { return NumEvictions; }
+
+  void clear() {
+    Slots.clear();
+    NumEntries = 0;
+    Head = Tail = None;
+  }
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,45 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_MAPPEDFILE_H_
+#define PHASAR_UTILS_MAPPEDFILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace psr {
+
+/**
+ * Maps a file read-only into memory; the pages are only read from disk once
+ * they are accessed. The mapping is removed when the object is destroyed.
+ *
+ * I/O errors are reported by throwing std::ios_base::failure.
+ */
+class MappedFile {
+private:
+  void *Data = nullptr;
+  std::size_t Size = 0;
+
+public:
+  explicit MappedFile(const std::string &Path);
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  const char *data() const { return static_cast<const char *>(Data); }
+
+  std::size_t size() const { return Size; }
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,52 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_PROGRESSSTREAM_H_
+#define PHASAR_UTILS_PROGRESSSTREAM_H_
+
+#include <string>
+
+namespace psr {
+
+/**
+ * Writes progress reports, one line each, to a local file or, if the
+ * destination is given as "unix:<path>", to the Unix domain stream socket
+ * listening at path. Lines written to a file are appended, hence several
+ * analyses may share a destination.
+ *
+ * Opening the destination throws std::ios_base::failure on errors. Write
+ * errors, e.g. a reader that went away, only close the stream, such that a
+ * running analysis is not affected by them.
+ */
+class ProgressStream {
+private:
+  int FD = -1;
+  std::string Destination;
+
+public:
+  explicit ProgressStream(const std::string &Destination);
+
+  ~ProgressStream();
+
+  ProgressStream(const ProgressStream &) = delete;
+
+  ProgressStream &operator=(const ProgressStream &) = delete;
+
+  /**
+   * Writes Line followed by a newline. Returns false if the stream has been
+   * closed.
+   */
+  bool writeLine(const std::string &Line);
+
+  bool isOpen() const { return FD >= 0; }
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_RESOURCEBUDGET_H_
+#define PHASAR_UTILS_RESOURCEBUDGET_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+
+#include <wise_enum.h>
+
+namespace psr {
+
+/**
+ * The kinds of budgets a ResourceBudget may exceed; None if no budget has
+ * been exceeded.
+ */
+WISE_ENUM_CLASS(BudgetKind, None, Time, PathEdges, Memory)
+
+std::ostream &operator<<(std::ostream &os, const BudgetKind &BK);
+
+/**
+ * Returns the resident set size of the running process in bytes, or zero if
+ * it cannot be determined on this platform.
+ */
+std::size_t getResidentSetSize();
+
+/**
+ * Limits the wall-clock time, the number of path edges and the resident set
+ * size of an analysis. A limit of zero means unbounded. exceeded() is meant
+ * to be called from the solver's main loop: the number of path edges is
+ * checked on every call, whereas the clock and the resident set size are
+ * only sampled every CheckInterval calls to keep the checks cheap. Once a
+ * budget has been exceeded, it stays exceeded. exceeded() may be called
+ * concurrently.
+ */
+class ResourceBudget {
+private:
+  static constexpr unsigned CheckInterval = 1024;
+
+  std::chrono::steady_clock::time_point Start;
+  std::chrono::milliseconds TimeLimit;
+  std::size_t PathEdgeLimit;
+  std::size_t MemoryLimit;
+  std::atomic<unsigned> NumChecks;
+  std::atomic<BudgetKind> Exceeded;
+
+public:
+  ResourceBudget(std::chrono::milliseconds TimeLimit = {},
+                 std::size_t PathEdgeLimit = 0, std::size_t MemoryLimit = 0);
+
+  /**
+   * (Re)starts the clock and forgets about exceeded budgets.
+   */
+  void start();
+
+  bool isBounded() const {
+    return TimeLimit.count() > 0 || PathEdgeLimit > 0 || MemoryLimit > 0;
+  }
+
+  /**
+   * Returns true if one of the budgets is exceeded, given the number of path
+   * edges processed so far.
+   */
+  bool exceeded(std::size_t NumPathEdges);
+
+  /**
+   * Returns the budget that has been exceeded first.
+   */
+  BudgetKind getExceeded() const { return Exceeded; }
+};
+
+} // namespace psr
+
+#endif
@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_SNAPSHOTVIEW_H_
+#define PHASAR_UTILS_SNAPSHOTVIEW_H_
+
+#include <memory>
+
+namespace psr {
+
+/**
+ * A read-only view of a container that is owned by some other data structure.
+ * If the container is shared between threads, the view holds a snapshot of
+ * it that has been taken while the owner's lock was held. Otherwise, the view
+ * refers to the container itself and remains valid as long as the container
+ * is neither modified nor destroyed. A missing container is viewed as an
+ * empty one.
+ *
+ * @param <ContainerT> The type of the viewed container.
+ */
+template <typename ContainerT> class SnapshotView {
+private:
+  std::unique_ptr<const ContainerT> Snapshot;
+  const ContainerT *Container;
+
+  static const ContainerT &emptyContainer() {
+    static const ContainerT Empty;
+    return Empty;
+  }
+
+public:
+  SnapshotView(const ContainerT *Container, bool TakeSnapshot)
+      : Container(Container ? Container : &emptyContainer()) {
+    if (TakeSnapshot && Container) {
+      Snapshot = std::make_unique<const ContainerT>(*Container);
+      this->Container = Snapshot.get();
+    }
+  }
+
+  auto begin() const { return Container->begin(); }
+
+  auto end() const { return Container->end(); }
+
+  const ContainerT &operator*() const { return *Container; }
+
+  const ContainerT *operator->() const { return Container; }
+};
+
+} // namespace psr
+
+#endif
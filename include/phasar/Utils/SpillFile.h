@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_SPILLFILE_H_
+#define PHASAR_UTILS_SPILLFILE_H_
+
+#include <cstddef>
+#include <cstdio>
+#include <ios>
+#include <type_traits>
+
+namespace psr {
+
+/**
+ * An anonymous temporary file that holds fixed-size records which have been
+ * moved out of memory. The file is removed automatically once it is closed.
+ * Records are stored as raw bytes, hence they are only meaningful within the
+ * process that has written them and must be trivially copyable.
+ *
+ * I/O errors are reported by throwing std::ios_base::failure.
+ */
+class SpillFile {
+private:
+  std::FILE *File;
+  std::size_t NumBytes = 0;
+
+  void writeBytes(const void *Data, std::size_t Size);
+  bool readBytes(void *Data, std::size_t Size);
+  void seek(std::size_t Offset);
+
+public:
+  SpillFile();
+
+  ~SpillFile();
+
+  SpillFile(const SpillFile &) = delete;
+
+  SpillFile &operator=(const SpillFile &) = delete;
+
+  template <typename RecordT> void write(const RecordT &Record) {
+    static_assert(std::is_trivially_copyable<RecordT>::value,
+                  "only trivially copyable records can be spilled");
+    writeBytes(&Record, sizeof(RecordT));
+  }
+
+  /**
+   * Calls Handler on every record that has been written, in the order of
+   * writing. All records must be of type RecordT.
+   */
+  template <typename RecordT, typename HandlerT>
+  void forEach(HandlerT Handler) {
+    static_assert(std::is_trivially_copyable<RecordT>::value,
+                  "only trivially copyable records can be spilled");
+    forEach<RecordT>(0, NumBytes, Handler);
+  }
+
+  /**
+   * Calls Handler on the records that have been written between the file
+   * sizes Begin and End, in the order of writing. Records written by Handler
+   * are not visited.
+   */
+  template <typename RecordT, typename HandlerT>
+  void forEach(std::size_t Begin, std::size_t End, HandlerT Handler) {
+    static_assert(std::is_trivially_copyable<RecordT>::value,
+                  "only trivially copyable records can be spilled");
+    seek(Begin);
+    std::size_t Written = NumBytes;
+    RecordT Record;
+    for (std::size_t Offset = Begin; Offset + sizeof(RecordT) <= End;
+         Offset += sizeof(RecordT)) {
+      // writing moves the file position to the end
+      if (NumBytes != Written) {
+        seek(Offset);
+        Written = NumBytes;
+      }
+      if (!readBytes(&Record, sizeof(RecordT))) {
+        throw std::ios_base::failure("could not read spill file");
+      }
+      Handler(Record);
+    }
+  }
+
+  /**
+   * Discards all records.
+   */
+  void clear();
+
+  std::size_t size() const { return NumBytes; }
+
+  bool empty() const { return NumBytes == 0; }
+};
+
+} // namespace psr
+
+#endif
@@ -170,6 +170,17 @@ public:
     return table[rowKey][columnKey];
   }
 
+  V *find(R rowKey, C columnKey) {
+    // Returns a pointer to the value corresponding to the given row and column
+    // keys, or nullptr if no such mapping exists. In contrast to get(), no
+    // mapping is inserted.
+    auto row = table.find(rowKey);
+    if (row == table.end())
+      return nullptr;
+    auto cell = row->second.find(columnKey);
+    return cell != row->second.end() ? &cell->second : nullptr;
+  }
+
   V remove(R rowKey, C columnKey) {
     // Removes the mapping, if any, associated with the given keys.
     V v = table[rowKey][columnKey];
@@ -192,6 +203,17 @@ public:
     return s;
   }
 
+  typename std::unordered_map<R, std::unordered_map<C, V>>::const_iterator
+  begin() const {
+    // Iterates over the row keys and rows of the table without copying them.
+    return table.begin();
+  }
+
+  typename std::unordered_map<R, std::unordered_map<C, V>>::const_iterator
+  end() const {
+    return table.end();
+  }
+
   std::unordered_map<R, std::unordered_map<C, V>> rowMap() {
     // Returns a view that associates each row key with the corresponding map
     // from column keys to values.
@@ -0,0 +1,212 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_WORKSTEALINGSCHEDULER_H_
+#define PHASAR_UTILS_WORKSTEALINGSCHEDULER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Distributes tasks of type T over a fixed number of worker threads. Every
+ * worker owns a double-ended queue: it pushes and pops tasks at the back of
+ * its own queue and, once that queue has run dry, steals the oldest tasks
+ * from the front of the other workers' queues.
+ *
+ * Tasks may push new tasks while they are being handled; such tasks are put
+ * into the queue of the worker that executes the current task. Tasks that
+ * are pushed from outside of run() are put into the first worker's queue.
+ * run() returns as soon as all tasks, including the ones pushed during the
+ * run, have been handled, or once it has been aborted.
+ *
+ * @param <T> The type of tasks.
+ */
+template <typename T> class WorkStealingScheduler {
+private:
+  struct WorkerQueue {
+    std::mutex Mutex;
+    std::deque<T> Tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> Queues;
+  // number of tasks that have been pushed but not yet completely handled
+  std::atomic<std::size_t> PendingTasks;
+  std::atomic<unsigned> IdleWorkers;
+  std::atomic<bool> Aborted;
+  std::mutex IdleMutex;
+  std::condition_variable IdleCV;
+  std::exception_ptr FirstException;
+
+  // index of the worker that is executed by the calling thread, threads that
+  // do not belong to a running scheduler use the first worker's queue
+  static unsigned &currentWorker() {
+    static thread_local unsigned Worker = 0;
+    return Worker;
+  }
+
+  std::optional<T> tryPop(unsigned Worker) {
+    WorkerQueue &Own = *Queues[Worker];
+    std::lock_guard<std::mutex> Lock(Own.Mutex);
+    if (Own.Tasks.empty()) {
+      return std::nullopt;
+    }
+    std::optional<T> Task(std::move(Own.Tasks.back()));
+    Own.Tasks.pop_back();
+    return Task;
+  }
+
+  std::optional<T> trySteal(unsigned Thief) {
+    for (std::size_t Offset = 1; Offset < Queues.size(); ++Offset) {
+      WorkerQueue &Victim = *Queues[(Thief + Offset) % Queues.size()];
+      std::lock_guard<std::mutex> Lock(Victim.Mutex);
+      if (!Victim.Tasks.empty()) {
+        std::optional<T> Task(std::move(Victim.Tasks.front()));
+        Victim.Tasks.pop_front();
+        return Task;
+      }
+    }
+    return std::nullopt;
+  }
+
+  template <typename HandlerT> void work(unsigned Worker, HandlerT &Handler) {
+    currentWorker() = Worker;
+    while (!Aborted) {
+      std::optional<T> Task = tryPop(Worker);
+      if (!Task) {
+        Task = trySteal(Worker);
+      }
+      if (Task) {
+        try {
+          Handler(*Task);
+        } catch (...) {
+          std::lock_guard<std::mutex> Lock(IdleMutex);
+          if (!FirstException) {
+            FirstException = std::current_exception();
+          }
+          Aborted = true;
+        }
+        if (--PendingTasks == 0 || Aborted) {
+          std::lock_guard<std::mutex> Lock(IdleMutex);
+          IdleCV.notify_all();
+        }
+        continue;
+      }
+      // Nothing to do right now. Other workers may still produce tasks, so
+      // wait until we are notified about new ones. The timeout only guards
+      // against a notification that was sent just before we went to sleep.
+      std::unique_lock<std::mutex> Lock(IdleMutex);
+      if (PendingTasks == 0) {
+        break;
+      }
+      ++IdleWorkers;
+      IdleCV.wait_for(Lock, std::chrono::milliseconds(1));
+      --IdleWorkers;
+    }
+    currentWorker() = 0;
+  }
+
+public:
+  explicit WorkStealingScheduler(unsigned NumWorkers)
+      : PendingTasks(0), IdleWorkers(0), Aborted(false) {
+    for (unsigned Idx = 0; Idx < (NumWorkers ? NumWorkers : 1); ++Idx) {
+      Queues.push_back(std::make_unique<WorkerQueue>());
+    }
+  }
+
+  ~WorkStealingScheduler() = default;
+
+  WorkStealingScheduler(const WorkStealingScheduler &) = delete;
+  WorkStealingScheduler &operator=(const WorkStealingScheduler &) = delete;
+
+  void push(T Task) {
+    // account for the task before it becomes visible to other workers,
+    // otherwise they could handle it and detect termination too early
+    ++PendingTasks;
+    WorkerQueue &Own = *Queues[currentWorker() % Queues.size()];
+    {
+      std::lock_guard<std::mutex> Lock(Own.Mutex);
+      Own.Tasks.push_back(std::move(Task));
+    }
+    if (IdleWorkers > 0) {
+      IdleCV.notify_one();
+    }
+  }
+
+  /**
+   * Handles all pending tasks by calling Handler on each of them from
+   * getNumWorkers() threads. Handler must be safe to call concurrently. If
+   * Handler throws, the remaining tasks are discarded and the first
+   * exception is rethrown once all workers have stopped.
+   */
+  template <typename HandlerT> void run(HandlerT Handler) {
+    Aborted = false;
+    FirstException = nullptr;
+    std::vector<std::thread> Workers;
+    for (unsigned Worker = 1; Worker < Queues.size(); ++Worker) {
+      Workers.emplace_back(
+          [this, Worker, &Handler]() { work(Worker, Handler); });
+    }
+    // the calling thread participates as the first worker
+    work(0, Handler);
+    for (auto &Thread : Workers) {
+      Thread.join();
+    }
+    if (Aborted) {
+      for (auto &Queue : Queues) {
+        Queue->Tasks.clear();
+      }
+      PendingTasks = 0;
+    }
+    if (FirstException) {
+      std::rethrow_exception(FirstException);
+    }
+  }
+
+  /**
+   * Makes run() return once the tasks that are currently being handled are
+   * finished; all other pending tasks are discarded. May be called from
+   * within Handler.
+   */
+  void abort() {
+    std::lock_guard<std::mutex> Lock(IdleMutex);
+    Aborted = true;
+    IdleCV.notify_all();
+  }
+
+  bool empty() const { return PendingTasks == 0; }
+
+  /**
+   * Returns the number of tasks that have been pushed but not yet completely
+   * handled.
+   */
+  std::size_t size() const { return PendingTasks; }
+
+  /**
+   * Returns the index of the worker that is executed by the calling thread,
+   * or 0 if the calling thread does not belong to a running scheduler.
+   */
+  unsigned getCurrentWorker() const { return currentWorker() % Queues.size(); }
+
+  unsigned getNumWorkers() const { return Queues.size(); }
+};
+
+} // namespace psr
+
+#endif
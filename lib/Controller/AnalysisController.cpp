@@ -49,6 +49,8 @@
 #include <phasar/PhasarLLVM/Plugins/PluginFactories.h>
 #include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
 #include <phasar/PhasarLLVM/Pointer/VTable.h>
+#include <phasar/Utils/JsonStreamWriter.h>
+#include <phasar/Utils/LLVMShorthands.h>
 
 using namespace std;
 using namespace psr;
@@ -59,12 +61,46 @@ std::ostream &operator<<(std::ostream &os, const ExportType &E) {
   return os << wise_enum::to_string(E);
 }
 
+/**
+ * Applies the budgets, the progress reporting, the result compaction and the
+ * edge function interning that have been given as program options.
+ */
+static void configureSolver(SolverConfiguration &SC) {
+  if (VariablesMap.count("time-budget")) {
+    SC.timeBudget = VariablesMap["time-budget"].as<size_t>() * 1000;
+  }
+  if (VariablesMap.count("path-edge-budget")) {
+    SC.pathEdgeBudget = VariablesMap["path-edge-budget"].as<size_t>();
+  }
+  if (VariablesMap.count("memory-budget")) {
+    SC.memoryBudget = VariablesMap["memory-budget"].as<size_t>() << 20;
+  }
+  if (VariablesMap.count("progress")) {
+    SC.progressDestination = VariablesMap["progress"].as<string>();
+  }
+  if (VariablesMap.count("compact-results")) {
+    SC.compactResults = VariablesMap["compact-results"].as<bool>();
+  }
+  if (VariablesMap.count("intern-edge-functions")) {
+    SC.internEdgeFunctions = VariablesMap["intern-edge-functions"].as<bool>();
+  }
+}
+
 AnalysisController::AnalysisController(
     ProjectIRDB &&IRDB, std::vector<DataFlowAnalysisType> Analyses,
-    bool WPA_MODE, bool PrintEdgeRecorder, std::string graph_id)
-    : FinalResultsJson() {
+    bool WPA_MODE, bool PrintEdgeRecorder, std::string graph_id,
+    std::string OutputFile)
+    : FinalResultsJson(), StreamFile(move(OutputFile)) {
   PAMM_GET_INSTANCE;
   auto &lg = lg::get();
+  // streams a solver's results if possible, otherwise collects them
+  auto AddSolverResults = [&](auto &Solver) {
+    if (!StreamFile.empty()) {
+      Solver.writeJson(getResultsWriter());
+    } else {
+      FinalResultsJson += Solver.getAsJson();
+    }
+  };
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
                 << "Constructed the analysis controller.");
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
@@ -103,6 +139,10 @@ AnalysisController::AnalysisController(
     START_TIMER("Link to WPA Module", PAMM_SEVERITY_LEVEL::Full);
     IRDB.linkForWPA();
     STOP_TIMER("Link to WPA Module", PAMM_SEVERITY_LEVEL::Full);
+    // all uses of a function are visible in the linked module
+    IRDB.setAddressTakenTargetsOnly(
+        !VariablesMap.count("address-taken-targets") ||
+        VariablesMap["address-taken-targets"].as<bool>());
     LOG_IF_ENABLE(
         BOOST_LOG_SEV(lg, INFO)
         << "link all llvm modules into a single module for WPA ended\n");
@@ -161,8 +201,15 @@ AnalysisController::AnalysisController(
           : CallGraphAnalysisType::OTF);
   // Perform whole program analysis (WPA) analysis
   if (WPA_MODE) {
+    unsigned CGThreads =
+        VariablesMap.count("callgraph-threads")
+            ? VariablesMap["callgraph-threads"].as<unsigned>()
+            : 1;
+    string CGCacheFile = VariablesMap.count("callgraph-cache")
+                             ? VariablesMap["callgraph-cache"].as<string>()
+                             : "";
     START_TIMER("CG Construction", PAMM_SEVERITY_LEVEL::Core);
-    LLVMBasedICFG ICFG(CH, IRDB, CGType, EntryPoints);
+    LLVMBasedICFG ICFG(CH, IRDB, CGType, EntryPoints, CGThreads, CGCacheFile);
 
     if (VariablesMap.count("callgraph-plugin")) {
       throw runtime_error("callgraph plugin not found");
@@ -195,12 +242,24 @@ AnalysisController::AnalysisController(
         TaintConfiguration<const llvm::Value *> TSF;
         IFDSTaintAnalysis TaintAnalysisProblem(ICFG, CH, IRDB, TSF,
                                                EntryPoints);
+        configureSolver(TaintAnalysisProblem.solver_config);
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> LLVMTaintSolver(
             TaintAnalysisProblem, false);
         cout << "IFDS Taint Analysis ..." << endl;
         LLVMTaintSolver.solve();
         cout << "IFDS Taint Analysis ended" << endl;
         // FinalResultsJson += LLVMTaintSolver.getAsJson();
+        if (!LLVMTaintSolver.isComplete()) {
+          // keep the partial results and the leaks found so far
+          json Partial = LLVMTaintSolver.getAsJson();
+          for (auto &Leak : TaintAnalysisProblem.Leaks) {
+            for (auto LeakedValue : Leak.second) {
+              Partial["Leaks"][llvmIRToString(Leak.first)].push_back(
+                  llvmIRToString(LeakedValue));
+            }
+          }
+          addResults(move(Partial));
+        }
         if (PrintEdgeRecorder) {
           LLVMTaintSolver.exportJson(graph_id);
         }
@@ -208,10 +267,11 @@ AnalysisController::AnalysisController(
       }
       case DataFlowAnalysisType::IDE_TaintAnalysis: {
         IDETaintAnalysis taintanalysisproblem(ICFG, CH, IRDB, EntryPoints);
+        configureSolver(taintanalysisproblem.solver_config);
         LLVMIDESolver<const llvm::Value *, const llvm::Value *, LLVMBasedICFG &>
             llvmtaintsolver(taintanalysisproblem, true);
         llvmtaintsolver.solve();
-        FinalResultsJson += llvmtaintsolver.getAsJson();
+        AddSolverResults(llvmtaintsolver);
         if (PrintEdgeRecorder) {
           llvmtaintsolver.exportJson(graph_id);
         }
@@ -221,10 +281,11 @@ AnalysisController::AnalysisController(
         CSTDFILEIOTypeStateDescription fileIODesc;
         IDETypeStateAnalysis typestateproblem(ICFG, CH, IRDB, fileIODesc,
                                               EntryPoints);
+        configureSolver(typestateproblem.solver_config);
         LLVMIDESolver<const llvm::Value *, int, LLVMBasedICFG &>
             llvmtypestatesolver(typestateproblem, true);
         llvmtypestatesolver.solve();
-        FinalResultsJson += llvmtypestatesolver.getAsJson();
+        AddSolverResults(llvmtypestatesolver);
         if (PrintEdgeRecorder) {
           llvmtypestatesolver.exportJson(graph_id);
         }
@@ -232,10 +293,11 @@ AnalysisController::AnalysisController(
       }
       case DataFlowAnalysisType::IFDS_TypeAnalysis: {
         IFDSTypeAnalysis typeanalysisproblem(ICFG, CH, IRDB, EntryPoints);
+        configureSolver(typeanalysisproblem.solver_config);
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> llvmtypesolver(
             typeanalysisproblem, true);
         llvmtypesolver.solve();
-        FinalResultsJson += llvmtypesolver.getAsJson();
+        AddSolverResults(llvmtypesolver);
         if (PrintEdgeRecorder) {
           llvmtypesolver.exportJson(graph_id);
         }
@@ -244,12 +306,16 @@ AnalysisController::AnalysisController(
       case DataFlowAnalysisType::IFDS_UninitializedVariables: {
         IFDSUninitializedVariables uninitializedvarproblem(ICFG, CH, IRDB,
                                                            EntryPoints);
+        configureSolver(uninitializedvarproblem.solver_config);
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> llvmunivsolver(
             uninitializedvarproblem, false);
         cout << "IFDS UninitVar Analysis ..." << endl;
         llvmunivsolver.solve();
         cout << "IFDS UninitVar Analysis ended" << endl;
         // FinalResultsJson += llvmunivsolver.getAsJson();
+        if (!llvmunivsolver.isComplete()) {
+          AddSolverResults(llvmunivsolver);
+        }
         if (PrintEdgeRecorder) {
           llvmunivsolver.exportJson(graph_id);
         }
@@ -257,10 +323,11 @@ AnalysisController::AnalysisController(
       }
       case DataFlowAnalysisType::IFDS_LinearConstantAnalysis: {
         IFDSLinearConstantAnalysis lcaproblem(ICFG, CH, IRDB, EntryPoints);
+        configureSolver(lcaproblem.solver_config);
         LLVMIFDSSolver<LCAPair, LLVMBasedICFG &> llvmlcasolver(lcaproblem,
                                                                true);
         llvmlcasolver.solve();
-        FinalResultsJson += llvmlcasolver.getAsJson();
+        AddSolverResults(llvmlcasolver);
         if (PrintEdgeRecorder) {
           llvmlcasolver.exportJson(graph_id);
         }
@@ -268,10 +335,11 @@ AnalysisController::AnalysisController(
       }
       case DataFlowAnalysisType::IDE_LinearConstantAnalysis: {
         IDELinearConstantAnalysis lcaproblem(ICFG, CH, IRDB, EntryPoints);
+        configureSolver(lcaproblem.solver_config);
         LLVMIDESolver<const llvm::Value *, int64_t, LLVMBasedICFG &>
             llvmlcasolver(lcaproblem, true);
         llvmlcasolver.solve();
-        FinalResultsJson += llvmlcasolver.getAsJson();
+        AddSolverResults(llvmlcasolver);
         if (PrintEdgeRecorder) {
           llvmlcasolver.exportJson(graph_id);
         }
@@ -280,10 +348,11 @@ AnalysisController::AnalysisController(
       case DataFlowAnalysisType::IFDS_ConstAnalysis: {
         IFDSConstAnalysis constproblem(
             ICFG, CH, IRDB, IRDB.getAllMemoryLocations(), EntryPoints);
+        configureSolver(constproblem.solver_config);
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> llvmconstsolver(
             constproblem, true);
         llvmconstsolver.solve();
-        FinalResultsJson += llvmconstsolver.getAsJson();
+        AddSolverResults(llvmconstsolver);
         if (PrintEdgeRecorder) {
           llvmconstsolver.exportJson(graph_id);
         }
@@ -291,12 +360,16 @@ AnalysisController::AnalysisController(
       }
       case DataFlowAnalysisType::IFDS_SolverTest: {
         IFDSSolverTest ifdstest(ICFG, CH, IRDB, EntryPoints);
+        configureSolver(ifdstest.solver_config);
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> llvmifdstestsolver(
             ifdstest, false);
         cout << "IFDS Solvertest ..." << endl;
         llvmifdstestsolver.solve();
         cout << "IFDS Solvertest ended" << endl;
         // FinalResultsJson += llvmifdstestsolver.getAsJson();
+        if (!llvmifdstestsolver.isComplete()) {
+          AddSolverResults(llvmifdstestsolver);
+        }
         if (PrintEdgeRecorder) {
           llvmifdstestsolver.exportJson(graph_id);
         }
@@ -304,12 +377,13 @@ AnalysisController::AnalysisController(
       }
       case DataFlowAnalysisType::IFDS_EnvironmentVariableTracing: {
         IFDSEnvironmentVariableTracing variableTracing(ICFG, EntryPoints);
+        configureSolver(variableTracing.solver_config);
         LLVMIFDSSolver<ExtendedValue, LLVMBasedICFG &> llvmifdsenvsolver(
             variableTracing, true);
         cout << "IFDS EnvironmentVariableTracing ..." << endl;
         llvmifdsenvsolver.solve();
         cout << "IFDS EnvironmentVariableTracing ended" << endl;
-        FinalResultsJson += llvmifdsenvsolver.getAsJson();
+        AddSolverResults(llvmifdsenvsolver);
         if (PrintEdgeRecorder) {
           llvmifdsenvsolver.exportJson(graph_id);
         }
@@ -317,10 +391,11 @@ AnalysisController::AnalysisController(
       }
       case DataFlowAnalysisType::IDE_SolverTest: {
         IDESolverTest idetest(ICFG, CH, IRDB, EntryPoints);
+        configureSolver(idetest.solver_config);
         LLVMIDESolver<const llvm::Value *, const llvm::Value *, LLVMBasedICFG &>
             llvmidetestsolver(idetest, true);
         llvmidetestsolver.solve();
-        FinalResultsJson += llvmidetestsolver.getAsJson();
+        AddSolverResults(llvmidetestsolver);
         if (PrintEdgeRecorder) {
           llvmidetestsolver.exportJson(graph_id);
         }
@@ -365,6 +440,13 @@ AnalysisController::AnalysisController(
 #ifdef PHASAR_PLUGINS_ENABLED
         AnalysisPluginController PluginController(
             AnalysisPlugins, ICFG, EntryPoints, FinalResultsJson);
+        if (!StreamFile.empty()) {
+          json PluginResults = move(FinalResultsJson);
+          FinalResultsJson = json();
+          for (auto &Results : PluginResults) {
+            addResults(move(Results));
+          }
+        }
 #endif
         break;
       }
@@ -386,7 +468,35 @@ AnalysisController::AnalysisController(
   }
 }
 
+AnalysisController::~AnalysisController() = default;
+
+JsonStreamWriter &AnalysisController::getResultsWriter() {
+  if (!ResultsWriter) {
+    ResultsWriter = make_unique<JsonStreamWriter>(StreamFile);
+    ResultsWriter->beginArray();
+  }
+  return *ResultsWriter;
+}
+
+void AnalysisController::addResults(json Results) {
+  if (!StreamFile.empty()) {
+    getResultsWriter().value(Results);
+  } else {
+    FinalResultsJson += move(Results);
+  }
+}
+
 void AnalysisController::writeResults(std::string filename) {
+  if (!StreamFile.empty()) {
+    // the results have already been streamed
+    getResultsWriter().close();
+    if (filename != StreamFile) {
+      std::ifstream ifs(StreamFile);
+      std::ofstream ofs(filename);
+      ofs << ifs.rdbuf();
+    }
+    return;
+  }
   std::ofstream ofs(filename);
   ofs << FinalResultsJson.dump(1);
 }
@@ -310,6 +310,8 @@ void ProjectIRDB::linkForWPA() {
     for (auto &entry : globals) {
       entry.second = MainMod->getModuleIdentifier();
     }
+    SignatureIndex.reset();
+    AddressTakenSignatureIndex.reset();
     std::cout << "remaining contexts: " << contexts.size() << std::endl;
     std::cout << "remaining modules: " << modules.size() << std::endl;
     WPAMOD = MainMod;
@@ -554,6 +556,16 @@ std::set<const llvm::Function *> ProjectIRDB::getAllFunctions() {
   return functions;
 }
 
+const FunctionSignatureIndex &
+ProjectIRDB::getFunctionSignatureIndex(bool AddressTakenOnly) {
+  auto &Index = AddressTakenOnly ? AddressTakenSignatureIndex : SignatureIndex;
+  if (!Index) {
+    Index = std::make_unique<FunctionSignatureIndex>(getAllFunctions(),
+                                                     AddressTakenOnly);
+  }
+  return *Index;
+}
+
 bool ProjectIRDB::empty() { return modules.empty(); }
 
 void ProjectIRDB::insertModule(std::unique_ptr<llvm::Module> M) {
@@ -572,6 +584,8 @@ void ProjectIRDB::insertModule(std::unique_ptr<llvm::Module> M) {
       std::make_pair(M->getModuleIdentifier(),
                      std::unique_ptr<llvm::LLVMContext>(&M->getContext())));
   modules.insert(std::make_pair(M->getModuleIdentifier(), std::move(M)));
+  SignatureIndex.reset();
+  AddressTakenSignatureIndex.reset();
 }
 
 set<const llvm::Type *> ProjectIRDB::getAllocatedTypes() {
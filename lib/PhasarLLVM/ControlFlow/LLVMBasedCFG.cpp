@@ -30,53 +30,44 @@ const llvm::Function *LLVMBasedCFG::getMethodOf(const llvm::Instruction *stmt) {
   return stmt->getFunction();
 }
 
+const LLVMCFGIndex &
+LLVMBasedCFG::getCFGIndex(const llvm::Function *fun) const {
+  return IndexCache->getIndex(fun);
+}
+
+LLVMCFGIndex::InstRef
+LLVMBasedCFG::getPredsOfRef(const llvm::Instruction *stmt) const {
+  return getCFGIndex(stmt->getFunction()).getPredsOf(stmt);
+}
+
+LLVMCFGIndex::InstRef
+LLVMBasedCFG::getSuccsOfRef(const llvm::Instruction *stmt) const {
+  return getCFGIndex(stmt->getFunction()).getSuccsOf(stmt);
+}
+
+LLVMCFGIndex::InstRef
+LLVMBasedCFG::getAllInstructionsOfRef(const llvm::Function *fun) const {
+  return getCFGIndex(fun).getInstructions();
+}
+
 vector<const llvm::Instruction *>
 LLVMBasedCFG::getPredsOf(const llvm::Instruction *I) {
-  vector<const llvm::Instruction *> Preds;
-  if (I->getPrevNode()) {
-    Preds.push_back(I->getPrevNode());
-  }
-  /*
-   * If we do not have a predecessor yet, look for basic blocks which
-   * lead to our instruction in question!
-   */
-  if (Preds.empty()) {
-    for (auto &BB : *I->getFunction()) {
-      if (const llvm::Instruction *T = BB.getTerminator()) {
-        for (unsigned i = 0; i < T->getNumSuccessors(); ++i) {
-          if (&*T->getSuccessor(i)->begin() == I) {
-            Preds.push_back(T);
-          }
-        }
-      }
-    }
-  }
-  return Preds;
+  return getPredsOfRef(I).vec();
 }
 
 vector<const llvm::Instruction *>
 LLVMBasedCFG::getSuccsOf(const llvm::Instruction *I) {
-  vector<const llvm::Instruction *> Successors;
-  if (I->getNextNode()) {
-    Successors.push_back(I->getNextNode());
-  }
-  if (I->isTerminator()) {
-    for (unsigned i = 0; i < I->getNumSuccessors(); ++i) {
-      Successors.push_back(&*I->getSuccessor(i)->begin());
-    }
-  }
-  return Successors;
+  return getSuccsOfRef(I).vec();
 }
 
 vector<pair<const llvm::Instruction *, const llvm::Instruction *>>
 LLVMBasedCFG::getAllControlFlowEdges(const llvm::Function *fun) {
+  const LLVMCFGIndex &Index = getCFGIndex(fun);
   vector<pair<const llvm::Instruction *, const llvm::Instruction *>> Edges;
-  for (auto &BB : *fun) {
-    for (auto &I : BB) {
-      auto Successors = getSuccsOf(&I);
-      for (auto Successor : Successors) {
-        Edges.push_back(make_pair(&I, Successor));
-      }
+  Edges.reserve(Index.getNumEdges());
+  for (uint32_t Id = 0; Id < Index.size(); ++Id) {
+    for (auto Successor : Index.getSuccsOf(Id)) {
+      Edges.emplace_back(Index.getInstruction(Id), Successor);
     }
   }
   return Edges;
@@ -84,13 +75,7 @@ LLVMBasedCFG::getAllControlFlowEdges(const llvm::Function *fun) {
 
 vector<const llvm::Instruction *>
 LLVMBasedCFG::getAllInstructionsOf(const llvm::Function *fun) {
-  vector<const llvm::Instruction *> Instructions;
-  for (auto &BB : *fun) {
-    for (auto &I : BB) {
-      Instructions.push_back(&I);
-    }
-  }
-  return Instructions;
+  return getAllInstructionsOfRef(fun).vec();
 }
 
 bool LLVMBasedCFG::isExitStmt(const llvm::Instruction *stmt) {
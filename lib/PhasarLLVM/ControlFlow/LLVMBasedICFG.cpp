@@ -14,6 +14,10 @@
  *      Author: pdschbrt
  */
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <memory>
 
 #include <llvm/IR/CallSite.h>
@@ -27,6 +31,7 @@
 #include <boost/graph/depth_first_search.hpp>
 #include <boost/graph/graph_utility.hpp>
 #include <boost/graph/graphviz.hpp>
+#include <boost/graph/strong_components.hpp>
 #include <boost/log/sources/record_ostream.hpp>
 
 #include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
@@ -36,10 +41,12 @@
 #include <phasar/PhasarLLVM/ControlFlow/Resolver/RTAResolver.h>
 #include <phasar/PhasarLLVM/ControlFlow/Resolver/Resolver.h>
 
+#include <phasar/Utils/HashedTuple.h>
 #include <phasar/Utils/LLVMShorthands.h>
 #include <phasar/Utils/Logger.h>
 #include <phasar/Utils/Macros.h>
 #include <phasar/Utils/PAMMMacros.h>
+#include <phasar/Utils/WorkStealingScheduler.h>
 
 #include <phasar/DB/ProjectIRDB.h>
 #include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
@@ -74,7 +81,8 @@ LLVMBasedICFG::LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB)
 
 LLVMBasedICFG::LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB,
                              CallGraphAnalysisType CGType,
-                             const vector<string> &EntryPoints)
+                             const vector<string> &EntryPoints,
+                             unsigned NumThreads, const string &CacheFile)
     : CGType(CGType), CH(STH), IRDB(IRDB) {
   PAMM_GET_INSTANCE;
   auto &lg = lg::get();
@@ -101,6 +109,10 @@ LLVMBasedICFG::LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB,
           break;
         }
       }());
+  bool FromCache = !CacheFile.empty() && loadCallGraph(CacheFile, EntryPoints);
+  bool Parallel =
+      !FromCache && NumThreads > 1 && resolver->isParallelizable();
+  vector<const llvm::Function *> EntryFunctions;
   for (auto &EntryPoint : EntryPoints) {
     llvm::Function *F = IRDB.getFunction(EntryPoint);
     if (F == nullptr) {
@@ -109,7 +121,17 @@ LLVMBasedICFG::LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB,
     }
     PointsToGraph &ptg = *IRDB.getPointsToGraph(EntryPoint);
     WholeModulePTG.mergeWith(ptg, F);
-    constructionWalker(F, resolver.get());
+    if (Parallel) {
+      EntryFunctions.push_back(F);
+    } else if (!FromCache) {
+      constructionWalker(F, resolver.get());
+    }
+  }
+  if (Parallel) {
+    parallelConstructionWalker(EntryFunctions, resolver.get(), NumThreads);
+  }
+  if (!FromCache && !CacheFile.empty()) {
+    storeCallGraph(CacheFile, EntryPoints);
   }
   REG_COUNTER("WM-PTG Vertices", WholeModulePTG.getNumOfVertices(),
               PAMM_SEVERITY_LEVEL::Full);
@@ -117,13 +139,14 @@ LLVMBasedICFG::LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB,
               PAMM_SEVERITY_LEVEL::Full);
   REG_COUNTER("CG Vertices", getNumOfVertices(), PAMM_SEVERITY_LEVEL::Full);
   REG_COUNTER("CG Edges", getNumOfEdges(), PAMM_SEVERITY_LEVEL::Full);
+  buildCallGraphIndex();
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Call graph has been constructed");
 }
 
 LLVMBasedICFG::LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB,
                              const llvm::Module &M,
                              CallGraphAnalysisType CGType,
-                             vector<string> EntryPoints)
+                             vector<string> EntryPoints, unsigned NumThreads)
     : CGType(CGType), CH(STH), IRDB(IRDB) {
   auto &lg = lg::get();
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
@@ -154,21 +177,102 @@ LLVMBasedICFG::LLVMBasedICFG(LLVMTypeHierarchy &STH, ProjectIRDB &IRDB,
           break;
         }
       }());
+  bool Parallel = NumThreads > 1 && resolver->isParallelizable();
+  vector<const llvm::Function *> EntryFunctions;
   for (auto &EntryPoint : EntryPoints) {
     llvm::Function *F = M.getFunction(EntryPoint);
     if (F && !F->isDeclaration()) {
       PointsToGraph &ptg = *IRDB.getPointsToGraph(EntryPoint);
       WholeModulePTG.mergeWith(ptg, F);
-      constructionWalker(F, resolver.get());
+      if (Parallel) {
+        EntryFunctions.push_back(F);
+      } else {
+        constructionWalker(F, resolver.get());
+      }
     }
   }
+  if (Parallel) {
+    parallelConstructionWalker(EntryFunctions, resolver.get(), NumThreads);
+  }
+  buildCallGraphIndex();
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Call graph has been constructed");
 }
 
+// only the very first function that is walked is reported to a resolver
+static bool first_function = true;
+
+set<const llvm::Function *>
+LLVMBasedICFG::resolveCallSite(llvm::ImmutableCallSite cs, Resolver *resolver) {
+  auto &lg = lg::get();
+  set<const llvm::Function *> possible_targets;
+  // check if function call can be resolved statically
+  if (cs.getCalledFunction() != nullptr) {
+    possible_targets.insert(cs.getCalledFunction());
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Found static call-site: "
+                  << llvmIRToString(cs.getInstruction()));
+  } else {
+    // still try to resolve the called function statically
+    const llvm::Value *v = cs.getCalledValue();
+    const llvm::Value *sv = v->stripPointerCasts();
+    if (sv->hasName() && IRDB.getFunction(sv->getName())) {
+      possible_targets.insert(IRDB.getFunction(sv->getName()));
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "Found static call-site: "
+                    << llvmIRToString(cs.getInstruction()));
+    } else {
+      // the function call must be resolved dynamically
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                    << "Found dynamic call-site: "
+                    << llvmIRToString(cs.getInstruction()));
+      // call the resolve routine
+      set<string> possible_target_names;
+      if (isVirtualFunctionCall(cs)) {
+        possible_target_names = resolver->resolveVirtualCall(cs);
+      } else {
+        possible_target_names = resolver->resolveFunctionPointer(cs);
+      }
+
+      for (auto &possible_target_name : possible_target_names) {
+        if (IRDB.getFunction(possible_target_name)) {
+          possible_targets.insert(IRDB.getFunction(possible_target_name));
+        }
+      }
+    }
+  }
+
+  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                << "Found " << possible_targets.size()
+                << " possible target(s)");
+
+  resolver->TreatPossibleTarget(cs, possible_targets);
+  return possible_targets;
+}
+
+void LLVMBasedICFG::addFunctionVertex(const llvm::Function *F) {
+  if (!function_vertex_map.count(F->getName().str())) {
+    function_vertex_map[F->getName().str()] = boost::add_vertex(cg);
+    cg[function_vertex_map[F->getName().str()]] =
+        VertexProperties(F, F->isDeclaration());
+  }
+}
+
+void LLVMBasedICFG::addCallEdges(
+    const llvm::Function *F, const llvm::Instruction *CallSite,
+    const set<const llvm::Function *> &possible_targets) {
+  // Insert possible target inside the graph and add the link with
+  // the current function
+  for (auto &possible_target : possible_targets) {
+    addFunctionVertex(possible_target);
+    boost::add_edge(function_vertex_map[F->getName().str()],
+                    function_vertex_map[possible_target->getName().str()],
+                    EdgeProperties(CallSite), cg);
+  }
+}
+
 void LLVMBasedICFG::constructionWalker(const llvm::Function *F,
                                        Resolver *resolver) {
   PAMM_GET_INSTANCE;
-  static bool first_function = true;
   auto &lg = lg::get();
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                 << "Walking in function: " << F->getName().str());
@@ -181,10 +285,7 @@ void LLVMBasedICFG::constructionWalker(const llvm::Function *F,
   VisitedFunctions.insert(F);
 
   // add a node for function F to the call graph (if not present already)
-  if (!function_vertex_map.count(F->getName().str())) {
-    function_vertex_map[F->getName().str()] = boost::add_vertex(cg);
-    cg[function_vertex_map[F->getName().str()]] = VertexProperties(F);
-  }
+  addFunctionVertex(F);
 
   if (first_function) {
     first_function = false;
@@ -198,62 +299,9 @@ void LLVMBasedICFG::constructionWalker(const llvm::Function *F,
       resolver->preCall(&Inst);
 
       llvm::ImmutableCallSite cs(&Inst);
-      set<const llvm::Function *> possible_targets;
-      // check if function call can be resolved statically
-      if (cs.getCalledFunction() != nullptr) {
-        possible_targets.insert(cs.getCalledFunction());
-        LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                      << "Found static call-site: "
-                      << llvmIRToString(cs.getInstruction()));
-      } else {
-        // still try to resolve the called function statically
-        const llvm::Value *v = cs.getCalledValue();
-        const llvm::Value *sv = v->stripPointerCasts();
-        if (sv->hasName() && IRDB.getFunction(sv->getName())) {
-          possible_targets.insert(IRDB.getFunction(sv->getName()));
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "Found static call-site: "
-                        << llvmIRToString(cs.getInstruction()));
-        } else {
-          // the function call must be resolved dynamically
-          LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                        << "Found dynamic call-site: "
-                        << llvmIRToString(cs.getInstruction()));
-          // call the resolve routine
-          set<string> possible_target_names;
-          if (isVirtualFunctionCall(cs)) {
-            possible_target_names = resolver->resolveVirtualCall(cs);
-          } else {
-            possible_target_names = resolver->resolveFunctionPointer(cs);
-          }
-
-          for (auto &possible_target_name : possible_target_names) {
-            if (IRDB.getFunction(possible_target_name)) {
-              possible_targets.insert(IRDB.getFunction(possible_target_name));
-            }
-          }
-        }
-      }
-
-      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
-                    << "Found " << possible_targets.size()
-                    << " possible target(s)");
-
-      resolver->TreatPossibleTarget(cs, possible_targets);
-      // Insert possible target inside the graph and add the link with
-      // the current function
-      for (auto &possible_target : possible_targets) {
-        string target_name = possible_target->getName().str();
-        if (!function_vertex_map.count(target_name)) {
-          function_vertex_map[target_name] = boost::add_vertex(cg);
-          cg[function_vertex_map[target_name]] = VertexProperties(
-              possible_target, possible_target->isDeclaration());
-        }
-
-        boost::add_edge(function_vertex_map[F->getName().str()],
-                        function_vertex_map[target_name],
-                        EdgeProperties(cs.getInstruction()), cg);
-      }
+      set<const llvm::Function *> possible_targets =
+          resolveCallSite(cs, resolver);
+      addCallEdges(F, cs.getInstruction(), possible_targets);
 
       // continue resolving
       for (auto possible_target : possible_targets) {
@@ -267,6 +315,65 @@ void LLVMBasedICFG::constructionWalker(const llvm::Function *F,
   }
 }
 
+void LLVMBasedICFG::parallelConstructionWalker(
+    const vector<const llvm::Function *> &EntryFunctions, Resolver *resolver,
+    unsigned NumThreads) {
+  auto &lg = lg::get();
+  vector<const llvm::Function *> Frontier;
+  for (auto F : EntryFunctions) {
+    if (!F->isDeclaration() && VisitedFunctions.insert(F).second) {
+      Frontier.push_back(F);
+    }
+  }
+  if (first_function && !Frontier.empty()) {
+    first_function = false;
+    resolver->firstFunction(Frontier.front());
+  }
+  // The functions are walked breadth-first in rounds. The call sites of the
+  // functions of a round are resolved concurrently, while the graph is only
+  // changed in between the rounds and in a fixed order, hence the resulting
+  // call graph does not depend on the scheduling.
+  using CallTargets =
+      vector<pair<const llvm::Instruction *, set<const llvm::Function *>>>;
+  while (!Frontier.empty()) {
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
+                  << "Walking " << Frontier.size() << " function(s) with "
+                  << NumThreads << " thread(s)");
+    vector<CallTargets> Calls(Frontier.size());
+    WorkStealingScheduler<size_t> Scheduler(NumThreads);
+    for (size_t Idx = 0; Idx < Frontier.size(); ++Idx) {
+      Scheduler.push(Idx);
+    }
+    Scheduler.run([&](size_t Idx) {
+      for (auto &Inst : llvm::instructions(Frontier[Idx])) {
+        if (llvm::isa<llvm::CallInst>(Inst) ||
+            llvm::isa<llvm::InvokeInst>(Inst)) {
+          resolver->preCall(&Inst);
+          Calls[Idx].emplace_back(
+              &Inst, resolveCallSite(llvm::ImmutableCallSite(&Inst), resolver));
+          resolver->postCall(&Inst);
+        } else {
+          resolver->OtherInst(&Inst);
+        }
+      }
+    });
+    vector<const llvm::Function *> NextFrontier;
+    for (size_t Idx = 0; Idx < Frontier.size(); ++Idx) {
+      addFunctionVertex(Frontier[Idx]);
+      for (auto &Call : Calls[Idx]) {
+        addCallEdges(Frontier[Idx], Call.first, Call.second);
+        for (auto possible_target : Call.second) {
+          if (!possible_target->isDeclaration() &&
+              VisitedFunctions.insert(possible_target).second) {
+            NextFrontier.push_back(possible_target);
+          }
+        }
+      }
+    }
+    Frontier = move(NextFrontier);
+  }
+}
+
 bool LLVMBasedICFG::isVirtualFunctionCall(llvm::ImmutableCallSite CS) {
   if (CS.getNumArgOperands() > 0) {
     const llvm::Value *V = CS.getArgOperand(0);
@@ -307,6 +414,86 @@ set<const llvm::Function *> LLVMBasedICFG::getAllMethods() {
   return IRDB.getAllFunctions();
 }
 
+void LLVMBasedICFG::buildCallGraphIndex() {
+  CGIndex = CallGraphIndex();
+  size_t NumVertices = boost::num_vertices(cg);
+  vector<pair<const llvm::Instruction *, const llvm::Function *>> Calls;
+  vector<vector<const llvm::Instruction *>> CallersOf(NumVertices);
+  // only the vertices that are reachable by name take part in the queries
+  for (auto &Entry : function_vertex_map) {
+    vertex_t Vertex = Entry.second;
+    CGIndex.FunctionIds.emplace(cg[Vertex].function, Vertex);
+    out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = boost::out_edges(Vertex, cg); ei != ei_end;
+         ++ei) {
+      const string &TargetName = cg[boost::target(*ei, cg)].functionName;
+      // prefer the definition, the vertex may only hold a declaration
+      const llvm::Function *Callee = IRDB.getFunction(TargetName);
+      if (!Callee) {
+        // Either we have a special function called like glibc- or llvm
+        // intrinsic functions or a function that is defined in a thrid
+        // party library which we have no access to.
+        Callee = cg[boost::target(*ei, cg)].function;
+      }
+      Calls.emplace_back(cg[*ei].callsite, Callee);
+    }
+    in_edge_iterator ii, ii_end;
+    for (boost::tie(ii, ii_end) = boost::in_edges(Vertex, cg); ii != ii_end;
+         ++ii) {
+      CallersOf[Vertex].push_back(cg[*ii].callsite);
+    }
+  }
+  std::sort(Calls.begin(), Calls.end());
+  Calls.erase(std::unique(Calls.begin(), Calls.end()), Calls.end());
+  CGIndex.Callees.reserve(Calls.size());
+  for (auto &Call : Calls) {
+    auto &Range = CGIndex.CallSites[Call.first];
+    if (Range.second == 0) {
+      Range.first = CGIndex.Callees.size();
+    }
+    ++Range.second;
+    CGIndex.Callees.push_back(Call.second);
+  }
+  CGIndex.CallerOffsets.reserve(NumVertices + 1);
+  for (auto &Callers : CallersOf) {
+    std::sort(Callers.begin(), Callers.end());
+    Callers.erase(std::unique(Callers.begin(), Callers.end()), Callers.end());
+    CGIndex.CallerOffsets.push_back(CGIndex.Callers.size());
+    CGIndex.Callers.insert(CGIndex.Callers.end(), Callers.begin(),
+                           Callers.end());
+  }
+  CGIndex.CallerOffsets.push_back(CGIndex.Callers.size());
+}
+
+llvm::ArrayRef<const llvm::Function *>
+LLVMBasedICFG::getCalleesOfCallAtRef(const llvm::Instruction *n) const {
+  auto Search = CGIndex.CallSites.find(n);
+  if (Search == CGIndex.CallSites.end()) {
+    return {};
+  }
+  return llvm::ArrayRef<const llvm::Function *>(
+      CGIndex.Callees.data() + Search->second.first, Search->second.second);
+}
+
+llvm::ArrayRef<const llvm::Instruction *>
+LLVMBasedICFG::getCallersOfRef(const llvm::Function *m) const {
+  uint32_t Id;
+  auto Search = CGIndex.FunctionIds.find(m);
+  if (Search != CGIndex.FunctionIds.end()) {
+    Id = Search->second;
+  } else {
+    // m may be a declaration of the function in another module
+    auto Vertex = function_vertex_map.find(m->getName().str());
+    if (Vertex == function_vertex_map.end()) {
+      return {};
+    }
+    Id = Vertex->second;
+  }
+  return llvm::ArrayRef<const llvm::Instruction *>(
+      CGIndex.Callers.data() + CGIndex.CallerOffsets[Id],
+      CGIndex.CallerOffsets[Id + 1] - CGIndex.CallerOffsets[Id]);
+}
+
 /**
  * Returns all callee methods for a given call that might be called.
  */
@@ -314,29 +501,8 @@ set<const llvm::Function *>
 LLVMBasedICFG::getCalleesOfCallAt(const llvm::Instruction *n) {
   auto &lg = lg::get();
   if (llvm::isa<llvm::CallInst>(n) || llvm::isa<llvm::InvokeInst>(n)) {
-    llvm::ImmutableCallSite CS(n);
-    set<const llvm::Function *> Callees;
-    string CallerName = CS->getFunction()->getName().str();
-    out_edge_iterator ei, ei_end;
-    for (boost::tie(ei, ei_end) =
-             boost::out_edges(function_vertex_map[CallerName], cg);
-         ei != ei_end; ++ei) {
-      auto source = boost::source(*ei, cg);
-      auto edge = cg[*ei];
-      auto target = boost::target(*ei, cg);
-      if (CS.getInstruction() == edge.callsite) {
-        // cout << "Name: " << cg[target].functionName << endl;
-        if (IRDB.getFunction(cg[target].functionName)) {
-          Callees.insert(IRDB.getFunction(cg[target].functionName));
-        } else {
-          // Either we have a special function called like glibc- or
-          // llvm intrinsic functions or a function that is defined in
-          // a thrid party library which we have no access to.
-          Callees.insert(cg[target].function);
-        }
-      }
-    }
-    return Callees;
+    auto Callees = getCalleesOfCallAtRef(n);
+    return set<const llvm::Function *>(Callees.begin(), Callees.end());
   } else {
     LOG_IF_ENABLE(
         BOOST_LOG_SEV(lg, ERROR)
@@ -350,17 +516,8 @@ LLVMBasedICFG::getCalleesOfCallAt(const llvm::Instruction *n) {
  */
 set<const llvm::Instruction *>
 LLVMBasedICFG::getCallersOf(const llvm::Function *m) {
-  set<const llvm::Instruction *> CallersOf;
-  in_edge_iterator ei, ei_end;
-  for (boost::tie(ei, ei_end) =
-           boost::in_edges(function_vertex_map[m->getName().str()], cg);
-       ei != ei_end; ++ei) {
-    auto source = boost::source(*ei, cg);
-    auto edge = cg[*ei];
-    auto target = boost::target(*ei, cg);
-    CallersOf.insert(edge.callsite);
-  }
-  return CallersOf;
+  auto Callers = getCallersOfRef(m);
+  return set<const llvm::Instruction *>(Callers.begin(), Callers.end());
 }
 
 /**
@@ -526,6 +683,7 @@ void LLVMBasedICFG::mergeWith(const LLVMBasedICFG &other) {
                           other.VisitedFunctions.end());
   // Merge the points-to graphs
   WholeModulePTG.mergeWith(other.WholeModulePTG, Calls);
+  buildCallGraphIndex();
 }
 
 bool LLVMBasedICFG::isPrimitiveFunction(const string &name) {
@@ -598,6 +756,223 @@ vector<string> LLVMBasedICFG::getDependencyOrderedFunctions() {
   return functionNames;
 }
 
+vector<vector<const llvm::Function *>> LLVMBasedICFG::getCallGraphSCCs() {
+  // Tarjan's algorithm numbers the components in the order in which it
+  // completes them, which is callees first
+  vector<size_t> Component(boost::num_vertices(cg));
+  size_t NumComponents = boost::strong_components(
+      cg, boost::make_iterator_property_map(
+              Component.begin(), boost::get(boost::vertex_index, cg)));
+  vector<vector<const llvm::Function *>> SCCs(NumComponents);
+  vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = boost::vertices(cg); vi != vi_end; ++vi) {
+    if (!cg[*vi].isDeclaration) {
+      SCCs[Component[*vi]].push_back(cg[*vi].function);
+    }
+  }
+  SCCs.erase(remove_if(SCCs.begin(), SCCs.end(),
+                       [](const vector<const llvm::Function *> &SCC) {
+                         return SCC.empty();
+                       }),
+             SCCs.end());
+  return SCCs;
+}
+
+// The header of a call-graph cache file. It is followed by the
+// length-prefixed names of the entry points and of the vertices, in the order
+// of the vertex ids, and by NumEdges records of CallGraphCacheEdge.
+struct CallGraphCacheHeader {
+  char Magic[8];
+  std::uint64_t ModuleHash;
+  std::uint32_t CGType;
+  std::uint32_t NumEntryPoints;
+  std::uint32_t NumFunctions;
+  std::uint32_t NumEdges;
+  std::uint64_t AddressTakenTargetsOnly;
+};
+
+struct CallGraphCacheEdge {
+  std::uint32_t Caller;
+  std::uint32_t Callee;
+  std::uint64_t CallSiteId;
+};
+
+static constexpr char CallGraphCacheMagic[8] = {'P', 'S', 'R', 'C',
+                                                'G', 'C', 'H', '2'};
+
+// combines the hashes of all modules in the order of their identifiers
+static size_t computeProjectHash(ProjectIRDB &IRDB) {
+  set<llvm::Module *> AllModules = IRDB.getAllModules();
+  vector<const llvm::Module *> Modules(AllModules.begin(), AllModules.end());
+  std::sort(Modules.begin(), Modules.end(),
+            [](const llvm::Module *A, const llvm::Module *B) {
+              return A->getModuleIdentifier() < B->getModuleIdentifier();
+            });
+  size_t Hash = 0;
+  for (auto M : Modules) {
+    hashCombine(Hash, computeModuleHash(M));
+  }
+  return Hash;
+}
+
+static void writeCacheString(ostream &OS, const string &S) {
+  uint32_t Size = S.size();
+  OS.write(reinterpret_cast<const char *>(&Size), sizeof(Size));
+  OS.write(S.data(), S.size());
+}
+
+static bool readCacheString(const char *&Pos, const char *End, string &S) {
+  uint32_t Size;
+  if (static_cast<size_t>(End - Pos) < sizeof(Size)) {
+    return false;
+  }
+  memcpy(&Size, Pos, sizeof(Size));
+  Pos += sizeof(Size);
+  if (static_cast<size_t>(End - Pos) < Size) {
+    return false;
+  }
+  S.assign(Pos, Size);
+  Pos += Size;
+  return true;
+}
+
+void LLVMBasedICFG::storeCallGraph(const string &Path,
+                                   const vector<string> &EntryPoints) {
+  ofstream OS(Path, ios::binary | ios::trunc);
+  if (!OS) {
+    throw ios_base::failure("could not write file: " + Path);
+  }
+  CallGraphCacheHeader Header;
+  memcpy(Header.Magic, CallGraphCacheMagic, sizeof(CallGraphCacheMagic));
+  Header.ModuleHash = computeProjectHash(IRDB);
+  Header.CGType = static_cast<uint32_t>(CGType);
+  Header.NumEntryPoints = EntryPoints.size();
+  Header.NumFunctions = boost::num_vertices(cg);
+  Header.NumEdges = boost::num_edges(cg);
+  Header.AddressTakenTargetsOnly = IRDB.addressTakenTargetsOnly();
+  OS.write(reinterpret_cast<const char *>(&Header), sizeof(Header));
+  for (auto &EntryPoint : EntryPoints) {
+    writeCacheString(OS, EntryPoint);
+  }
+  vertex_iterator vi, vi_end;
+  for (boost::tie(vi, vi_end) = boost::vertices(cg); vi != vi_end; ++vi) {
+    writeCacheString(OS, cg[*vi].functionName);
+  }
+  for (boost::tie(vi, vi_end) = boost::vertices(cg); vi != vi_end; ++vi) {
+    out_edge_iterator ei, ei_end;
+    for (boost::tie(ei, ei_end) = boost::out_edges(*vi, cg); ei != ei_end;
+         ++ei) {
+      CallGraphCacheEdge Edge;
+      Edge.Caller = *vi;
+      Edge.Callee = boost::target(*ei, cg);
+      Edge.CallSiteId = cg[*ei].id;
+      OS.write(reinterpret_cast<const char *>(&Edge), sizeof(Edge));
+    }
+  }
+  if (!OS.flush()) {
+    throw ios_base::failure("could not write file: " + Path);
+  }
+}
+
+bool LLVMBasedICFG::loadCallGraph(const string &Path,
+                                  const vector<string> &EntryPoints) {
+  auto &lg = lg::get();
+  ifstream IS(Path, ios::binary);
+  if (!IS) {
+    return false;
+  }
+  string Buffer((istreambuf_iterator<char>(IS)), istreambuf_iterator<char>());
+  const char *Pos = Buffer.data();
+  const char *End = Pos + Buffer.size();
+  CallGraphCacheHeader Header;
+  if (Buffer.size() < sizeof(Header)) {
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                  << "Ignoring malformed call-graph cache: " << Path);
+    return false;
+  }
+  memcpy(&Header, Pos, sizeof(Header));
+  Pos += sizeof(Header);
+  if (memcmp(Header.Magic, CallGraphCacheMagic, sizeof(CallGraphCacheMagic)) !=
+      0) {
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                  << "Ignoring malformed call-graph cache: " << Path);
+    return false;
+  }
+  if (Header.CGType != static_cast<uint32_t>(CGType) ||
+      Header.AddressTakenTargetsOnly != IRDB.addressTakenTargetsOnly() ||
+      Header.NumEntryPoints != EntryPoints.size() ||
+      Header.ModuleHash != computeProjectHash(IRDB)) {
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Call-graph cache is out of date: " << Path);
+    return false;
+  }
+  vector<string> Names(Header.NumEntryPoints + Header.NumFunctions);
+  for (auto &Name : Names) {
+    if (!readCacheString(Pos, End, Name)) {
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                    << "Ignoring malformed call-graph cache: " << Path);
+      return false;
+    }
+  }
+  if (!std::equal(EntryPoints.begin(), EntryPoints.end(), Names.begin())) {
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Call-graph cache is out of date: " << Path);
+    return false;
+  }
+  Names.erase(Names.begin(), Names.begin() + Header.NumEntryPoints);
+  if (static_cast<size_t>(End - Pos) !=
+      Header.NumEdges * sizeof(CallGraphCacheEdge)) {
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                  << "Ignoring malformed call-graph cache: " << Path);
+    return false;
+  }
+  // resolve all names and ids before touching the graph, declarations are
+  // looked up in the module of a call site that refers to them
+  vector<const llvm::Function *> Functions(Names.size());
+  for (size_t Idx = 0; Idx < Names.size(); ++Idx) {
+    Functions[Idx] = IRDB.getFunction(Names[Idx]);
+  }
+  vector<pair<CallGraphCacheEdge, const llvm::Instruction *>> Edges;
+  Edges.reserve(Header.NumEdges);
+  for (; Pos != End; Pos += sizeof(CallGraphCacheEdge)) {
+    CallGraphCacheEdge Edge;
+    memcpy(&Edge, Pos, sizeof(Edge));
+    const llvm::Instruction *CallSite =
+        Edge.Caller < Names.size() && Edge.Callee < Names.size()
+            ? IRDB.getInstruction(Edge.CallSiteId)
+            : nullptr;
+    if (!CallSite) {
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                    << "Call-graph cache is out of date: " << Path);
+      return false;
+    }
+    if (!Functions[Edge.Callee]) {
+      Functions[Edge.Callee] =
+          CallSite->getModule()->getFunction(Names[Edge.Callee]);
+    }
+    Edges.emplace_back(Edge, CallSite);
+  }
+  if (std::count(Functions.begin(), Functions.end(), nullptr)) {
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                  << "Call-graph cache is out of date: " << Path);
+    return false;
+  }
+  for (auto F : Functions) {
+    function_vertex_map[F->getName().str()] =
+        boost::add_vertex(VertexProperties(F, F->isDeclaration()), cg);
+    if (!F->isDeclaration()) {
+      VisitedFunctions.insert(F);
+    }
+  }
+  for (auto &Edge : Edges) {
+    boost::add_edge(Edge.first.Caller, Edge.first.Callee,
+                    EdgeProperties(Edge.second), cg);
+  }
+  LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO)
+                << "Loaded call graph from cache: " << Path);
+  return true;
+}
+
 unsigned LLVMBasedICFG::getNumOfVertices() { return boost::num_vertices(cg); }
 
 unsigned LLVMBasedICFG::getNumOfEdges() { return boost::num_edges(cg); }
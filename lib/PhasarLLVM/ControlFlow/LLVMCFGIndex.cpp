@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <mutex>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instruction.h>
+
+#include <phasar/PhasarLLVM/ControlFlow/LLVMCFGIndex.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+LLVMCFGIndex::LLVMCFGIndex(const llvm::Function &F) {
+  for (auto &BB : F) {
+    for (auto &I : BB) {
+      Ids.emplace(&I, Instructions.size());
+      Instructions.push_back(&I);
+    }
+  }
+  // the successors of an instruction are the next instruction of its basic
+  // block or, for terminators, the first instructions of the target blocks
+  SuccOffsets.reserve(Instructions.size() + 1);
+  vector<uint32_t> NumPreds(Instructions.size(), 0);
+  for (auto I : Instructions) {
+    SuccOffsets.push_back(Succs.size());
+    if (auto Next = I->getNextNode()) {
+      Succs.push_back(Next);
+    }
+    if (I->isTerminator()) {
+      for (unsigned Idx = 0; Idx < I->getNumSuccessors(); ++Idx) {
+        Succs.push_back(&I->getSuccessor(Idx)->front());
+      }
+    }
+  }
+  SuccOffsets.push_back(Succs.size());
+  for (auto Succ : Succs) {
+    ++NumPreds[Ids[Succ]];
+  }
+  // the predecessors are the reversed edges, visiting the sources in program
+  // order keeps them in the order of LLVMBasedCFG::getPredsOf()
+  PredOffsets.reserve(Instructions.size() + 1);
+  PredOffsets.push_back(0);
+  for (auto Num : NumPreds) {
+    PredOffsets.push_back(PredOffsets.back() + Num);
+  }
+  Preds.resize(Succs.size());
+  vector<uint32_t> Fill(PredOffsets.begin(), PredOffsets.end() - 1);
+  for (uint32_t Id = 0; Id < Instructions.size(); ++Id) {
+    for (auto Succ : getSuccsOf(Id)) {
+      Preds[Fill[Ids[Succ]]++] = Instructions[Id];
+    }
+  }
+}
+
+uint32_t LLVMCFGIndex::getId(const llvm::Instruction *I) const {
+  auto Search = Ids.find(I);
+  assert(Search != Ids.end() && "instruction is not part of the function");
+  return Search->second;
+}
+
+namespace {
+
+atomic<uint64_t> NextGeneration{0};
+
+struct LastIndex {
+  uint64_t Generation = numeric_limits<uint64_t>::max();
+  const llvm::Function *F = nullptr;
+  const LLVMCFGIndex *Index = nullptr;
+};
+
+thread_local LastIndex LastRequested;
+
+} // namespace
+
+LLVMCFGIndexCache::LLVMCFGIndexCache() : Generation(NextGeneration++) {}
+
+const LLVMCFGIndex &LLVMCFGIndexCache::getIndex(const llvm::Function *F) {
+  if (LastRequested.Generation == Generation && LastRequested.F == F) {
+    return *LastRequested.Index;
+  }
+  const LLVMCFGIndex &Index = lookupOrBuild(F);
+  LastRequested = {Generation, F, &Index};
+  return Index;
+}
+
+const LLVMCFGIndex &
+LLVMCFGIndexCache::lookupOrBuild(const llvm::Function *F) {
+  {
+    shared_lock<shared_mutex> Lock(IndicesMutex);
+    auto Search = Indices.find(F);
+    if (Search != Indices.end()) {
+      return *Search->second;
+    }
+  }
+  // build the index outside of the lock, another thread may win the race
+  auto Index = make_unique<LLVMCFGIndex>(*F);
+  unique_lock<shared_mutex> Lock(IndicesMutex);
+  return *Indices.emplace(F, move(Index)).first->second;
+}
+
+} // namespace psr
@@ -67,3 +67,5 @@ set<string> CHAResolver::resolveVirtualCall(const llvm::ImmutableCallSite &CS) {
 
   return possible_call_targets;
 }
+
+bool CHAResolver::isParallelizable() const { return true; }
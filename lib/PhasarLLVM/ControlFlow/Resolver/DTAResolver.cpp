@@ -211,3 +211,5 @@ set<string> DTAResolver::resolveVirtualCall(const llvm::ImmutableCallSite &CS) {
 
   return possible_call_targets;
 }
+
+bool DTAResolver::isParallelizable() const { return false; }
@@ -21,13 +21,16 @@
 #include <phasar/DB/ProjectIRDB.h>
 #include <phasar/PhasarLLVM/ControlFlow/Resolver/Resolver.h>
 #include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+#include <phasar/Utils/FunctionSignatureIndex.h>
 #include <phasar/Utils/LLVMShorthands.h>
 #include <phasar/Utils/Logger.h>
 
 using namespace std;
 using namespace psr;
 
-Resolver::Resolver(ProjectIRDB &DB, LLVMTypeHierarchy &H) : IRDB(DB), CH(H) {}
+Resolver::Resolver(ProjectIRDB &DB, LLVMTypeHierarchy &H)
+    : IRDB(DB), CH(H), FunctionSignatures(DB.getFunctionSignatureIndex(
+                           DB.addressTakenTargetsOnly())) {}
 
 int Resolver::getVtableIndex(const llvm::ImmutableCallSite &CS) const {
   // deal with a virtual member function
@@ -107,10 +110,10 @@ void Resolver::postCall(const llvm::Instruction *inst) {}
 void Resolver::OtherInst(const llvm::Instruction *inst) {}
 void Resolver::firstFunction(const llvm::Function *F) {}
 
+bool Resolver::isParallelizable() const { return false; }
+
 set<string>
 Resolver::resolveFunctionPointer(const llvm::ImmutableCallSite &CS) {
-  // We may want to optimise the time of this function as it is in fact most of
-  // the time spent in the ICFG construction and it grows rapidily
   auto &lg = lg::get();
   LOG_IF_ENABLE(BOOST_LOG_SEV(lg, DEBUG)
                 << "Call function pointer: "
@@ -123,10 +126,8 @@ Resolver::resolveFunctionPointer(const llvm::ImmutableCallSite &CS) {
       CS.getCalledValue()->getType()->isPointerTy()) {
     if (const llvm::FunctionType *ftype = llvm::dyn_cast<llvm::FunctionType>(
             CS.getCalledValue()->getType()->getPointerElementType())) {
-      for (auto f : IRDB.getAllFunctions()) {
-        if (matchesSignature(f, ftype)) {
-          possible_call_targets.insert(f->getName().str());
-        }
+      for (auto f : FunctionSignatures.getCandidates(ftype)) {
+        possible_call_targets.insert(f->getName().str());
       }
     }
   }
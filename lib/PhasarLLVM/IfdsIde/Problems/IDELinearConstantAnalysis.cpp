@@ -30,6 +30,7 @@
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/KillAll.h>
 #include <phasar/PhasarLLVM/IfdsIde/LLVMZeroValue.h>
 #include <phasar/PhasarLLVM/IfdsIde/Problems/IDELinearConstantAnalysis.h>
+#include <phasar/Utils/HashedTuple.h>
 #include <phasar/Utils/LLVMIRToSrc.h>
 #include <phasar/Utils/LLVMShorthands.h>
 #include <phasar/Utils/Logger.h>
@@ -40,9 +41,9 @@ using namespace psr;
 
 namespace psr {
 // Initialize debug counter for edge functions
-unsigned IDELinearConstantAnalysis::CurrGenConstant_Id = 0;
-unsigned IDELinearConstantAnalysis::CurrLCAID_Id = 0;
-unsigned IDELinearConstantAnalysis::CurrBinary_Id = 0;
+atomic<unsigned> IDELinearConstantAnalysis::CurrGenConstant_Id(0);
+atomic<unsigned> IDELinearConstantAnalysis::CurrLCAID_Id(0);
+atomic<unsigned> IDELinearConstantAnalysis::CurrBinary_Id(0);
 
 const IDELinearConstantAnalysis::v_t IDELinearConstantAnalysis::TOP =
     numeric_limits<IDELinearConstantAnalysis::v_t>::min();
@@ -320,6 +321,11 @@ bool IDELinearConstantAnalysis::isZeroValue(
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IDELinearConstantAnalysis::hasFlowFunctionSideEffects() const {
+  // the flow functions only compute facts
+  return false;
+}
+
 // In addition provide specifications for the IDE parts
 
 shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>>
@@ -671,11 +677,17 @@ IDELinearConstantAnalysis::GenConstant::joinWith(
 
 bool IDELinearConstantAnalysis::GenConstant::equal_to(
     shared_ptr<EdgeFunction<IDELinearConstantAnalysis::v_t>> other) const {
-  if (auto *StC =
-          dynamic_cast<IDELinearConstantAnalysis::GenConstant *>(other.get())) {
-    return (StC->IntConst == this->IntConst);
+  if (typeid(*other) != typeid(*this)) {
+    return false;
   }
-  return this == other.get();
+  return static_cast<IDELinearConstantAnalysis::GenConstant *>(other.get())
+             ->IntConst == this->IntConst;
+}
+
+size_t IDELinearConstantAnalysis::GenConstant::hash() const {
+  size_t Hash = typeid(*this).hash_code();
+  hashCombine(Hash, IntConst);
+  return Hash;
 }
 
 void IDELinearConstantAnalysis::GenConstant::print(ostream &OS,
@@ -98,6 +98,11 @@ bool IDEProtoAnalysis::isZeroValue(IDEProtoAnalysis::d_t d) const {
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IDEProtoAnalysis::hasFlowFunctionSideEffects() const {
+  // the flow functions only compute facts
+  return false;
+}
+
 // in addition provide specifications for the IDE parts
 
 shared_ptr<EdgeFunction<IDEProtoAnalysis::v_t>>
@@ -94,6 +94,11 @@ bool IDESolverTest::isZeroValue(IDESolverTest::d_t d) const {
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IDESolverTest::hasFlowFunctionSideEffects() const {
+  // the flow functions only compute facts
+  return false;
+}
+
 // in addition provide specifications for the IDE parts
 
 shared_ptr<EdgeFunction<IDESolverTest::v_t>>
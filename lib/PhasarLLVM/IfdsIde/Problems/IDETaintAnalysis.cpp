@@ -93,6 +93,11 @@ bool IDETaintAnalysis::isZeroValue(IDETaintAnalysis::d_t d) const {
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IDETaintAnalysis::hasFlowFunctionSideEffects() const {
+  // the flow functions only compute facts
+  return false;
+}
+
 // in addition provide specifications for the IDE parts
 
 shared_ptr<EdgeFunction<IDETaintAnalysis::v_t>>
@@ -329,6 +329,11 @@ bool IDETypeStateAnalysis::isZeroValue(IDETypeStateAnalysis::d_t d) const {
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IDETypeStateAnalysis::hasFlowFunctionSideEffects() const {
+  // the flow functions only compute facts
+  return false;
+}
+
 // in addition provide specifications for the IDE parts
 
 shared_ptr<EdgeFunction<IDETypeStateAnalysis::v_t>>
@@ -777,7 +782,7 @@ void IDETypeStateAnalysis::printIDEReport(
                 os << "\n=== ERROR STATE DETECTED ===\nAlloca: "
                    << DtoString(res.first) << '\n'
                    << llvmValueToSrc(res.first, false) << '\n';
-                for (auto Pred : icfg.getPredsOf(&I)) {
+                for (auto Pred : icfg.getPredsOfRef(&I)) {
                   os << "\nPredecessor: " << NtoString(Pred) << '\n'
                      << llvmValueToSrc(Pred, false) << '\n';
                   auto PredResults = SR.resultsAt(Pred, true);
@@ -804,7 +809,7 @@ void IDETypeStateAnalysis::printIDEReport(
                    << llvmValueToSrc(res.first, false)
                    << "\nAt IR Inst: " << NtoString(&I) << '\n'
                    << llvmValueToSrc(&I, false) << '\n';
-                for (auto Pred : icfg.getPredsOf(&I)) {
+                for (auto Pred : icfg.getPredsOfRef(&I)) {
                   os << "\nPredecessor: " << NtoString(Pred) << '\n'
                      << llvmValueToSrc(Pred, false) << '\n';
                   auto PredResults = SR.resultsAt(Pred, true);
@@ -266,6 +266,17 @@ bool IFDSConstAnalysis::isZeroValue(IFDSConstAnalysis::d_t d) const {
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IFDSConstAnalysis::hasFlowFunctionSideEffects() const {
+  // the flow functions mark the memory locations that are initialized
+  return true;
+}
+
+bool IFDSConstAnalysis::dependsOnProcessingOrder() const {
+  // whether a store generates a fact depends on the stores that have been
+  // processed before
+  return true;
+}
+
 void IFDSConstAnalysis::printNode(ostream &os, IFDSConstAnalysis::n_t n) const {
   os << llvmIRToString(n);
 }
@@ -337,14 +348,20 @@ set<IFDSConstAnalysis::d_t> IFDSConstAnalysis::getContextRelevantPointsToSet(
 }
 
 bool IFDSConstAnalysis::isInitialized(IFDSConstAnalysis::d_t d) const {
-  return llvm::isa<llvm::GlobalValue>(d) || Initialized.count(d);
+  if (llvm::isa<llvm::GlobalValue>(d)) {
+    return true;
+  }
+  lock_guard<mutex> Lock(InitializedMutex);
+  return Initialized.count(d);
 }
 
 void IFDSConstAnalysis::markAsInitialized(IFDSConstAnalysis::d_t d) {
+  lock_guard<mutex> Lock(InitializedMutex);
   Initialized.insert(d);
 }
 
 size_t IFDSConstAnalysis::initMemoryLocationCount() {
+  lock_guard<mutex> Lock(InitializedMutex);
   return Initialized.size();
 }
 
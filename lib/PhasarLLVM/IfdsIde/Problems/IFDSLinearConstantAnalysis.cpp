@@ -134,6 +134,11 @@ bool IFDSLinearConstantAnalysis::isZeroValue(
   return d == zerovalue;
 }
 
+bool IFDSLinearConstantAnalysis::hasFlowFunctionSideEffects() const {
+  // the flow functions only compute facts
+  return false;
+}
+
 void IFDSLinearConstantAnalysis::printNode(
     ostream &os, IFDSLinearConstantAnalysis::n_t n) const {
   os << llvmIRToString(n);
@@ -96,6 +96,11 @@ bool IFDSProtoAnalysis::isZeroValue(IFDSProtoAnalysis::d_t d) const {
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IFDSProtoAnalysis::hasFlowFunctionSideEffects() const {
+  // the flow functions only compute facts
+  return false;
+}
+
 void IFDSProtoAnalysis::printNode(ostream &os, IFDSProtoAnalysis::n_t n) const {
   os << llvmIRToString(n);
 }
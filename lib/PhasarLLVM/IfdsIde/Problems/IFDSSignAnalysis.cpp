@@ -91,6 +91,11 @@ bool IFDSSignAnalysis::isZeroValue(IFDSSignAnalysis::d_t d) const {
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IFDSSignAnalysis::hasFlowFunctionSideEffects() const {
+  // the flow functions only compute facts
+  return false;
+}
+
 void IFDSSignAnalysis::printNode(ostream &os, IFDSSignAnalysis::n_t n) const {
   os << llvmIRToString(n);
 }
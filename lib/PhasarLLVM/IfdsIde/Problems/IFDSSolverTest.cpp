@@ -99,6 +99,11 @@ bool IFDSSolverTest::isZeroValue(IFDSSolverTest::d_t d) const {
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IFDSSolverTest::hasFlowFunctionSideEffects() const {
+  // the flow functions only compute facts
+  return false;
+}
+
 void IFDSSolverTest::printNode(ostream &os, IFDSSolverTest::n_t n) const {
   os << llvmIRToString(n);
 }
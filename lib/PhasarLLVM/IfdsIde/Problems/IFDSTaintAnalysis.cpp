@@ -195,13 +195,14 @@ IFDSTaintAnalysis::getCallToRetFlowFunction(
         IFDSTaintAnalysis::m_t calledMthd;
         TaintConfiguration<IFDSTaintAnalysis::d_t>::SinkFunction Sink;
         map<IFDSTaintAnalysis::n_t, set<IFDSTaintAnalysis::d_t>> &Leaks;
+        mutex &LeaksMutex;
         const IFDSTaintAnalysis *taintanalysis;
         TAFF(llvm::ImmutableCallSite cs, IFDSTaintAnalysis::m_t calledMthd,
              TaintConfiguration<IFDSTaintAnalysis::d_t>::SinkFunction s,
              map<IFDSTaintAnalysis::n_t, set<IFDSTaintAnalysis::d_t>> &leaks,
-             const IFDSTaintAnalysis *ta)
+             mutex &leaksMutex, const IFDSTaintAnalysis *ta)
             : callSite(cs), calledMthd(calledMthd), Sink(s), Leaks(leaks),
-              taintanalysis(ta) {}
+              LeaksMutex(leaksMutex), taintanalysis(ta) {}
         set<IFDSTaintAnalysis::d_t>
         computeTargets(IFDSTaintAnalysis::d_t source) override {
           // check if a tainted value flows into a sink
@@ -210,6 +211,7 @@ IFDSTaintAnalysis::getCallToRetFlowFunction(
             for (unsigned Idx = 0; Idx < callSite.getNumArgOperands(); ++Idx) {
               if (source == callSite.getArgOperand(Idx) &&
                   Sink.isLeakedArg(Idx)) {
+                lock_guard<mutex> Lock(LeaksMutex);
                 cout << "FOUND LEAK" << endl;
                 Leaks[callSite.getInstruction()].insert(source);
               }
@@ -220,7 +222,7 @@ IFDSTaintAnalysis::getCallToRetFlowFunction(
       };
       return make_shared<TAFF>(llvm::ImmutableCallSite(callSite), Callee,
                                SourceSinkFunctions.getSink(FunctionName), Leaks,
-                               this);
+                               LeaksMutex, this);
     }
   }
   // Otherwise pass everything as it is
@@ -283,6 +285,11 @@ bool IFDSTaintAnalysis::isZeroValue(IFDSTaintAnalysis::d_t d) const {
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IFDSTaintAnalysis::hasFlowFunctionSideEffects() const {
+  // the flow functions record the leaks at the sinks
+  return true;
+}
+
 void IFDSTaintAnalysis::printNode(ostream &os, IFDSTaintAnalysis::n_t n) const {
   os << llvmIRToString(n);
 }
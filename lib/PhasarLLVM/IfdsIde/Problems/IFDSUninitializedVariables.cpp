@@ -201,10 +201,12 @@ IFDSUninitializedVariables::getNormalFlowFunction(
     const llvm::Instruction *inst;
     map<IFDSUninitializedVariables::n_t, set<IFDSUninitializedVariables::d_t>>
         &UndefValueUses;
+    mutex &UndefValueUsesMutex;
     UVFF(const llvm::Instruction *inst,
          map<IFDSUninitializedVariables::n_t,
-             set<IFDSUninitializedVariables::d_t>> &UVU)
-        : inst(inst), UndefValueUses(UVU) {}
+             set<IFDSUninitializedVariables::d_t>> &UVU,
+         mutex &UVUMutex)
+        : inst(inst), UndefValueUses(UVU), UndefValueUsesMutex(UVUMutex) {}
     set<IFDSUninitializedVariables::d_t>
     computeTargets(IFDSUninitializedVariables::d_t source) override {
       for (auto &operand : inst->operands()) {
@@ -219,15 +221,17 @@ IFDSUninitializedVariables::getNormalFlowFunction(
           //----------------------------------------------------------------
           if (!llvm::isa<llvm::GetElementPtrInst>(inst) &&
               !llvm::isa<llvm::CastInst>(inst) &&
-              !llvm::isa<llvm::PHINode>(inst))
+              !llvm::isa<llvm::PHINode>(inst)) {
+            lock_guard<mutex> Lock(UndefValueUsesMutex);
             UndefValueUses[inst].insert(operand);
+          }
           return {source, inst};
         }
       }
       return {source};
     }
   };
-  return make_shared<UVFF>(curr, UndefValueUses);
+  return make_shared<UVFF>(curr, UndefValueUses, UndefValueUsesMutex);
 
   // otherwise we do not care and nothing changes
   return Identity<IFDSUninitializedVariables::d_t>::getInstance();
@@ -436,6 +440,11 @@ bool IFDSUninitializedVariables::isZeroValue(
   return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
 }
 
+bool IFDSUninitializedVariables::hasFlowFunctionSideEffects() const {
+  // the flow functions record the uses of undefined values
+  return true;
+}
+
 void IFDSUninitializedVariables::printNode(
     ostream &os, IFDSUninitializedVariables::n_t n) const {
   os << llvmIRToString(n);
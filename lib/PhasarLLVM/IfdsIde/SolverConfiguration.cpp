@@ -16,13 +16,36 @@ using namespace psr;
 
 namespace psr {
 
+ostream &operator<<(ostream &os, const WorklistPolicy &WP) {
+  return os << wise_enum::to_string(WP);
+}
+
 ostream &operator<<(ostream &os, const SolverConfiguration &sc) {
   return os << "SolverConfiguration:\n"
             << "\tfollowReturnsPastSeeds: " << sc.followReturnsPastSeeds << "\n"
             << "\tautoAddZero: " << sc.autoAddZero << "\n"
             << "\tcomputeValues: " << sc.computeValues << "\n"
             << "\trecordEdges: " << sc.recordEdges << "\n"
-            << "\tcomputePersistedSummaries: " << sc.computePersistedSummaries;
+            << "\tcomputePersistedSummaries: " << sc.computePersistedSummaries
+            << "\n"
+            << "\tworklistPolicy: " << sc.worklistPolicy << "\n"
+            << "\tnumThreads: " << sc.numThreads << "\n"
+            << "\tinternEdgeFunctions: " << sc.internEdgeFunctions << "\n"
+            << "\tedgeFunctionCacheSize: " << sc.edgeFunctionCacheSize << "\n"
+            << "\tevictFinishedProcedures: " << sc.evictFinishedProcedures
+            << "\n"
+            << "\tevictionDelay: " << sc.evictionDelay << "\n"
+            << "\trecordedEdgesMemoryBudget: "
+            << sc.recordedEdgesMemoryBudget << "\n"
+            << "\tsummaryDirectory: " << sc.summaryDirectory << "\n"
+            << "\tsparsePropagation: " << sc.sparsePropagation << "\n"
+            << "\ttimeBudget: " << sc.timeBudget << "\n"
+            << "\tpathEdgeBudget: " << sc.pathEdgeBudget << "\n"
+            << "\tmemoryBudget: " << sc.memoryBudget << "\n"
+            << "\tprogressDestination: " << sc.progressDestination << "\n"
+            << "\tprogressInterval: " << sc.progressInterval << "\n"
+            << "\tprogressTopProcedures: " << sc.progressTopProcedures << "\n"
+            << "\tcompactResults: " << sc.compactResults;
 }
 
 } // namespace psr
@@ -0,0 +1,209 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <ios>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalValue.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Module.h>
+
+#include <json.hpp>
+
+#include <phasar/PhasarLLVM/IfdsIde/SummaryStore.h>
+#include <phasar/Utils/IO.h>
+#include <phasar/Utils/Logger.h>
+
+using namespace std;
+using namespace psr;
+using json = nlohmann::json;
+
+namespace {
+
+/**
+ * Holds an exclusive lock on the file at Path, which is created if needed,
+ * for as long as it lives. The lock is advisory and protects against other
+ * threads as well as other processes that use the same lock file.
+ */
+class FileLock {
+private:
+  int FD;
+
+public:
+  explicit FileLock(const string &Path) {
+    FD = open(Path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (FD < 0) {
+      throw ios_base::failure("could not open lock file " + Path + ": " +
+                              strerror(errno));
+    }
+    int Result;
+    do {
+      Result = flock(FD, LOCK_EX);
+    } while (Result != 0 && errno == EINTR);
+    if (Result != 0) {
+      close(FD);
+      throw ios_base::failure("could not lock file " + Path + ": " +
+                              strerror(errno));
+    }
+  }
+
+  ~FileLock() {
+    // closing the file releases the lock
+    close(FD);
+  }
+
+  FileLock(const FileLock &) = delete;
+
+  FileLock &operator=(const FileLock &) = delete;
+};
+
+} // anonymous namespace
+
+namespace psr {
+
+FunctionLocalIDs::FunctionLocalIDs(const llvm::Function *F) : F(F) {
+  for (const auto &Arg : F->args()) {
+    string ID = "a" + to_string(Arg.getArgNo());
+    IDs[&Arg] = ID;
+    Values[ID] = &Arg;
+  }
+  size_t InstNo = 0;
+  for (const auto &I : llvm::instructions(F)) {
+    string ID = "i" + to_string(InstNo++);
+    IDs[&I] = ID;
+    Values[ID] = &I;
+  }
+}
+
+string FunctionLocalIDs::getID(const llvm::Value *V) const {
+  auto Search = IDs.find(V);
+  if (Search != IDs.end()) {
+    return Search->second;
+  }
+  if (auto GV = llvm::dyn_cast<llvm::GlobalValue>(V)) {
+    if (GV->hasName()) {
+      return "g:" + GV->getName().str();
+    }
+  }
+  return "";
+}
+
+const llvm::Value *FunctionLocalIDs::getValue(const string &ID) const {
+  if (ID.compare(0, 2, "g:") == 0) {
+    return F->getParent()->getNamedValue(ID.substr(2));
+  }
+  auto Search = Values.find(ID);
+  return Search != Values.end() ? Search->second : nullptr;
+}
+
+SummaryStore::SummaryStore(string Directory) : Directory(move(Directory)) {
+  boost::system::error_code EC;
+  boost::filesystem::create_directories(this->Directory, EC);
+  if (EC) {
+    throw ios_base::failure("could not create summary directory: " +
+                            this->Directory);
+  }
+}
+
+string SummaryStore::getPath(const string &FunctionName, size_t Hash) const {
+  // function names may contain characters that are not allowed in file
+  // names, the file's contents tell apart functions that map to the same name
+  ostringstream FileName;
+  for (char C : FunctionName) {
+    FileName << (isalnum(static_cast<unsigned char>(C)) || C == '_' ? C : '-');
+  }
+  FileName << '.' << hex << Hash << ".json";
+  return (boost::filesystem::path(Directory) / FileName.str()).string();
+}
+
+optional<IDESummary> SummaryStore::load(const string &FunctionName,
+                                        size_t Hash) const {
+  auto &lg = lg::get();
+  string Path = getPath(FunctionName, Hash);
+  if (!boost::filesystem::exists(Path)) {
+    return nullopt;
+  }
+  try {
+    json J = json::parse(readFile(Path));
+    if (J.at("function").get<string>() != FunctionName ||
+        J.at("hash").get<size_t>() != Hash) {
+      return nullopt;
+    }
+    IDESummary S(FunctionName, Hash);
+    for (const auto &Fact : J.at("source_facts")) {
+      S.SourceFacts.insert(Fact.get<string>());
+    }
+    for (const auto &E : J.at("entries")) {
+      S.Entries.insert({E.at(0).get<string>(), E.at(1).get<string>(),
+                        E.at(2).get<string>()});
+    }
+    for (const auto &E : J.at("reached_facts")) {
+      S.ReachedFacts.insert({E.at(0).get<string>(), E.at(1).get<string>(),
+                             E.at(2).get<string>()});
+    }
+    return S;
+  } catch (json::exception &e) {
+    LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                  << "Ignoring malformed summary " << Path << ": "
+                  << e.what());
+    return nullopt;
+  }
+}
+
+void SummaryStore::store(const IDESummary &S) const {
+  // solvers that run concurrently, in this or in other processes, may store
+  // the summaries of the same function, hence they are merged with the ones
+  // that are already persisted; the lock keeps the merge and the write from
+  // interleaving with another store(), load() needs no lock as the summary
+  // file is replaced atomically
+  string Path = getPath(S.FunctionName, S.Hash);
+  FileLock Lock(Path + ".lock");
+  IDESummary Merged = S;
+  if (auto Stored = load(S.FunctionName, S.Hash)) {
+    Merged.SourceFacts.insert(Stored->SourceFacts.begin(),
+                              Stored->SourceFacts.end());
+    Merged.Entries.insert(Stored->Entries.begin(), Stored->Entries.end());
+    Merged.ReachedFacts.insert(Stored->ReachedFacts.begin(),
+                               Stored->ReachedFacts.end());
+  }
+  json J;
+  J["function"] = Merged.FunctionName;
+  J["hash"] = Merged.Hash;
+  J["source_facts"] = Merged.SourceFacts;
+  J["entries"] = json::array();
+  for (const auto &E : Merged.Entries) {
+    J["entries"].push_back({E.SourceFact, E.ExitStmt, E.TargetFact});
+  }
+  J["reached_facts"] = json::array();
+  for (const auto &E : Merged.ReachedFacts) {
+    J["reached_facts"].push_back({E.SourceFact, E.ExitStmt, E.TargetFact});
+  }
+  // write to a temporary file first, such that an aborted run never leaves
+  // a partially written summary behind
+  string TmpPath =
+      boost::filesystem::unique_path(Path + ".%%%%-%%%%.tmp").string();
+  writeFile(TmpPath, J.dump());
+  boost::system::error_code EC;
+  boost::filesystem::rename(TmpPath, Path, EC);
+  if (EC) {
+    throw ios_base::failure("could not write file: " + Path);
+  }
+}
+
+} // namespace psr
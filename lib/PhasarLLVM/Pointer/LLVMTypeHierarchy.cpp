@@ -318,8 +318,12 @@ void LLVMTypeHierarchy::pruneTypeHierarchyWithVtable(
 }
 
 set<string> LLVMTypeHierarchy::getTransitivelyReachableTypes(string TypeName) {
-  TypeName = debasify(TypeName);
-  return g[type_vertex_map[TypeName]].reachableTypes;
+  // use find() as the call-graph construction may query from several threads
+  auto Search = type_vertex_map.find(debasify(TypeName));
+  if (Search == type_vertex_map.end()) {
+    return {};
+  }
+  return g[Search->second].reachableTypes;
 }
 
 string LLVMTypeHierarchy::getVTableEntry(string TypeName, unsigned idx) const {
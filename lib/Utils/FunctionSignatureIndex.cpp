@@ -0,0 +1,62 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Function.h>
+
+#include <phasar/Utils/FunctionSignatureIndex.h>
+#include <phasar/Utils/HashedTuple.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+size_t FunctionSignatureIndex::SignatureHash::
+operator()(const Signature &S) const {
+  size_t Hash = S.size();
+  for (auto T : S) {
+    hashCombine(Hash, T);
+  }
+  return Hash;
+}
+
+FunctionSignatureIndex::Signature
+FunctionSignatureIndex::getSignature(const llvm::FunctionType *FType) {
+  Signature S;
+  S.reserve(FType->getNumParams() + 1);
+  S.push_back(FType->getReturnType());
+  S.insert(S.end(), FType->param_begin(), FType->param_end());
+  return S;
+}
+
+FunctionSignatureIndex::FunctionSignatureIndex(
+    const set<const llvm::Function *> &Functions, bool AddressTakenOnly) {
+  for (auto F : Functions) {
+    if (AddressTakenOnly && !F->hasAddressTaken()) {
+      continue;
+    }
+    Candidates[getSignature(F->getFunctionType())].push_back(F);
+    ++NumFunctions;
+  }
+}
+
+llvm::ArrayRef<const llvm::Function *>
+FunctionSignatureIndex::getCandidates(const llvm::FunctionType *FType) const {
+  if (FType == nullptr) {
+    return {};
+  }
+  auto Search = Candidates.find(getSignature(FType));
+  if (Search == Candidates.end()) {
+    return {};
+  }
+  return Search->second;
+}
+
+} // namespace psr
@@ -0,0 +1,120 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <cassert>
+#include <ios>
+
+#include <phasar/Utils/JsonStreamWriter.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+JsonStreamWriter::JsonStreamWriter(const string &Path) : Path(Path) {
+  OS.open(Path, ios::out | ios::trunc);
+  if (!OS) {
+    throw ios_base::failure("could not write file: " + Path);
+  }
+}
+
+JsonStreamWriter::~JsonStreamWriter() {
+  // do not throw from the destructor, an unfinished document is the
+  // caller's responsibility
+  if (OS.is_open()) {
+    while (!Scopes.empty()) {
+      OS << '\n' << Scopes.back().Closing;
+      Scopes.pop_back();
+    }
+    OS << '\n';
+  }
+}
+
+void JsonStreamWriter::indent() {
+  OS << '\n';
+  for (size_t I = 0; I < Scopes.size(); ++I) {
+    OS << ' ';
+  }
+}
+
+void JsonStreamWriter::check() {
+  if (!OS) {
+    throw ios_base::failure("could not write file: " + Path);
+  }
+}
+
+void JsonStreamWriter::beginValue() {
+  if (AfterKey) {
+    AfterKey = false;
+    return;
+  }
+  if (!Scopes.empty()) {
+    assert(Scopes.back().Closing == ']' && "object member without key");
+    if (!Scopes.back().Empty) {
+      OS << ',';
+    }
+    Scopes.back().Empty = false;
+    indent();
+  }
+}
+
+void JsonStreamWriter::beginScope(char Opening, char Closing) {
+  beginValue();
+  OS << Opening;
+  Scopes.push_back({Closing, true});
+}
+
+void JsonStreamWriter::endScope(char Closing) {
+  assert(!Scopes.empty() && Scopes.back().Closing == Closing &&
+         "mismatched end of scope");
+  bool Empty = Scopes.back().Empty;
+  Scopes.pop_back();
+  if (!Empty) {
+    indent();
+  }
+  OS << Closing;
+  check();
+}
+
+void JsonStreamWriter::beginObject() { beginScope('{', '}'); }
+
+void JsonStreamWriter::endObject() { endScope('}'); }
+
+void JsonStreamWriter::beginArray() { beginScope('[', ']'); }
+
+void JsonStreamWriter::endArray() { endScope(']'); }
+
+void JsonStreamWriter::key(const string &Key) {
+  assert(!Scopes.empty() && Scopes.back().Closing == '}' && !AfterKey &&
+         "key outside of an object");
+  if (!Scopes.back().Empty) {
+    OS << ',';
+  }
+  Scopes.back().Empty = false;
+  indent();
+  OS << json(Key).dump() << ": ";
+  AfterKey = true;
+}
+
+void JsonStreamWriter::value(const json &Value) {
+  beginValue();
+  OS << Value.dump();
+  check();
+}
+
+void JsonStreamWriter::close() {
+  while (!Scopes.empty()) {
+    endScope(Scopes.back().Closing);
+  }
+  OS << '\n';
+  OS.close();
+  check();
+}
+
+} // namespace psr
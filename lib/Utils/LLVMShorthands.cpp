@@ -14,14 +14,20 @@
  *      Author: philipp
  */
 
+#include <string>
+#include <unordered_map>
+
 #include <llvm/ADT/StringRef.h>
 #include <llvm/Bitcode/BitcodeReader.h>
 #include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/IR/Attributes.h>
 #include <llvm/IR/CallSite.h>
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Instructions.h>
+#include <llvm/IR/IntrinsicInst.h>
 #include <llvm/IR/Module.h>
+#include <llvm/IR/Operator.h>
 #include <llvm/IR/Value.h>
 #include <llvm/Support/raw_ostream.h>
 
@@ -290,6 +296,115 @@ std::size_t computeModuleHash(const llvm::Module *M) {
   return std::hash<std::string>{}(SourceCode);
 }
 
+// prints the attributes of the function, its return value and its
+// parameters, respectively of a call site
+static void printAttributes(llvm::raw_ostream &OS,
+                            const llvm::AttributeList &Attrs) {
+  for (unsigned Idx = Attrs.index_begin(); Idx != Attrs.index_end(); ++Idx) {
+    OS << " {" << Attrs.getAsString(Idx) << '}';
+  }
+}
+
+// prints the flags of I that change its semantics but are not reflected by
+// its operands
+static void printFlags(llvm::raw_ostream &OS, const llvm::Instruction &I) {
+  if (llvm::isa<llvm::OverflowingBinaryOperator>(I)) {
+    OS << (I.hasNoUnsignedWrap() ? " nuw" : "")
+       << (I.hasNoSignedWrap() ? " nsw" : "");
+  }
+  if (llvm::isa<llvm::PossiblyExactOperator>(I) && I.isExact()) {
+    OS << " exact";
+  }
+  if (llvm::isa<llvm::FPMathOperator>(I)) {
+    llvm::FastMathFlags FMF = I.getFastMathFlags();
+    OS << " fmf" << FMF.allowReassoc() << FMF.noNaNs() << FMF.noInfs()
+       << FMF.noSignedZeros() << FMF.allowReciprocal() << FMF.allowContract()
+       << FMF.approxFunc();
+  }
+  if (auto GEP = llvm::dyn_cast<llvm::GetElementPtrInst>(&I)) {
+    OS << (GEP->isInBounds() ? " inbounds" : "");
+  } else if (auto Load = llvm::dyn_cast<llvm::LoadInst>(&I)) {
+    OS << (Load->isVolatile() ? " volatile" : "") << " o"
+       << static_cast<unsigned>(Load->getOrdering());
+  } else if (auto Store = llvm::dyn_cast<llvm::StoreInst>(&I)) {
+    OS << (Store->isVolatile() ? " volatile" : "") << " o"
+       << static_cast<unsigned>(Store->getOrdering());
+  } else if (auto RMW = llvm::dyn_cast<llvm::AtomicRMWInst>(&I)) {
+    OS << (RMW->isVolatile() ? " volatile" : "") << " op"
+       << static_cast<unsigned>(RMW->getOperation()) << " o"
+       << static_cast<unsigned>(RMW->getOrdering());
+  } else if (auto CmpXchg = llvm::dyn_cast<llvm::AtomicCmpXchgInst>(&I)) {
+    OS << (CmpXchg->isVolatile() ? " volatile" : "")
+       << (CmpXchg->isWeak() ? " weak" : "") << " o"
+       << static_cast<unsigned>(CmpXchg->getSuccessOrdering()) << ' '
+       << static_cast<unsigned>(CmpXchg->getFailureOrdering());
+  }
+  llvm::ImmutableCallSite CS(&I);
+  if (CS) {
+    OS << " cc" << CS.getCallingConv();
+    printAttributes(OS, CS.getAttributes());
+  }
+}
+
+std::size_t computeFunctionHash(const llvm::Function *F) {
+  std::unordered_map<const llvm::Value *, std::size_t> LocalIDs;
+  for (const auto &Arg : F->args()) {
+    LocalIDs.emplace(&Arg, LocalIDs.size());
+  }
+  for (const auto &BB : *F) {
+    LocalIDs.emplace(&BB, LocalIDs.size());
+    for (const auto &I : BB) {
+      LocalIDs.emplace(&I, LocalIDs.size());
+    }
+  }
+  std::string Buffer;
+  llvm::raw_string_ostream RSO(Buffer);
+  F->getFunctionType()->print(RSO);
+  RSO << " cc" << F->getCallingConv();
+  printAttributes(RSO, F->getAttributes());
+  for (const auto &BB : *F) {
+    RSO << "\nbb";
+    for (const auto &I : BB) {
+      if (llvm::isa<llvm::DbgInfoIntrinsic>(I)) {
+        continue;
+      }
+      RSO << '\n' << I.getOpcodeName() << ' ';
+      I.getType()->print(RSO);
+      if (auto Cmp = llvm::dyn_cast<llvm::CmpInst>(&I)) {
+        RSO << " p" << Cmp->getPredicate();
+      } else if (auto Alloca = llvm::dyn_cast<llvm::AllocaInst>(&I)) {
+        RSO << ' ';
+        Alloca->getAllocatedType()->print(RSO);
+      } else if (auto GEP = llvm::dyn_cast<llvm::GetElementPtrInst>(&I)) {
+        RSO << ' ';
+        GEP->getSourceElementType()->print(RSO);
+      }
+      printFlags(RSO, I);
+      for (const auto &Op : I.operands()) {
+        auto Local = LocalIDs.find(Op);
+        if (Local != LocalIDs.end()) {
+          RSO << " %" << Local->second;
+        } else if (auto GV = llvm::dyn_cast<llvm::GlobalValue>(Op)) {
+          RSO << " @" << GV->getName();
+        } else if (llvm::isa<llvm::Constant>(Op)) {
+          RSO << ' ';
+          Op->printAsOperand(RSO, true, F->getParent());
+        } else if (!llvm::isa<llvm::MetadataAsValue>(Op)) {
+          RSO << " ?";
+        }
+      }
+      // the incoming blocks are not among the operands of a PHI node
+      if (auto PHI = llvm::dyn_cast<llvm::PHINode>(&I)) {
+        for (const llvm::BasicBlock *Incoming : PHI->blocks()) {
+          RSO << " from %" << LocalIDs.at(Incoming);
+        }
+      }
+    }
+  }
+  RSO.flush();
+  return std::hash<std::string>{}(Buffer);
+}
+
 const llvm::Instruction *getNthTermInstruction(const llvm::Function *F,
                                                unsigned termInstNo) {
   unsigned current = 1;
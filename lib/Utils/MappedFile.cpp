@@ -0,0 +1,53 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <ios>
+
+#include <phasar/Utils/MappedFile.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+MappedFile::MappedFile(const string &Path) {
+  int FD = open(Path.c_str(), O_RDONLY);
+  if (FD < 0) {
+    throw ios_base::failure("could not open file: " + Path);
+  }
+  struct stat Stat;
+  if (fstat(FD, &Stat) != 0) {
+    close(FD);
+    throw ios_base::failure("could not read file: " + Path);
+  }
+  Size = Stat.st_size;
+  // an empty file cannot be mapped, there is nothing to read either
+  if (Size > 0) {
+    Data = mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, FD, 0);
+  }
+  // the mapping stays valid after the file has been closed
+  close(FD);
+  if (Data == MAP_FAILED) {
+    Data = nullptr;
+    throw ios_base::failure("could not map file: " + Path);
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (Data) {
+    munmap(Data, Size);
+  }
+}
+
+} // namespace psr
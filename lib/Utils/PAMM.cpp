@@ -126,6 +126,7 @@ std::string PAMM::getPrintableDuration(unsigned long Duration) {
 }
 
 void PAMM::regCounter(const std::string &CounterId, unsigned IntialValue) {
+  std::lock_guard<std::mutex> Lock(Mutex);
   bool validCounterId = !Counter.count(CounterId);
   assert(validCounterId && "regCounter failed due to an invalid counter id");
   if (validCounterId) {
@@ -134,6 +135,7 @@ void PAMM::regCounter(const std::string &CounterId, unsigned IntialValue) {
 }
 
 void PAMM::incCounter(const std::string &CounterId, unsigned CValue) {
+  std::lock_guard<std::mutex> Lock(Mutex);
   bool validCounterId = Counter.count(CounterId);
   assert(validCounterId && "incCounter failed due to an invalid counter id");
   if (validCounterId) {
@@ -142,6 +144,7 @@ void PAMM::incCounter(const std::string &CounterId, unsigned CValue) {
 }
 
 void PAMM::decCounter(const std::string &CounterId, unsigned CValue) {
+  std::lock_guard<std::mutex> Lock(Mutex);
   bool validCounterId = Counter.count(CounterId);
   assert(validCounterId && "decCounter failed due to an invalid counter id");
   if (validCounterId) {
@@ -173,6 +176,7 @@ int PAMM::getSumCount(const std::set<std::string> &CounterIds) {
 }
 
 void PAMM::regHistogram(const std::string &HistogramId) {
+  std::lock_guard<std::mutex> Lock(Mutex);
   bool validHID = !Histogram.count(HistogramId);
   assert(validHID && "failed to register new histogram due to an invalid id");
   if (validHID) {
@@ -184,6 +188,7 @@ void PAMM::regHistogram(const std::string &HistogramId) {
 void PAMM::addToHistogram(const std::string &HistogramId,
                           const std::string &DataPointId,
                           unsigned long DataPointValue) {
+  std::lock_guard<std::mutex> Lock(Mutex);
   bool validHistoID = Histogram.count(HistogramId);
   assert(validHistoID &&
          "adding data point to histogram failed due to invalid id");
@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <cerrno>
+#include <cstring>
+#include <ios>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <phasar/Utils/Logger.h>
+#include <phasar/Utils/ProgressStream.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+ProgressStream::ProgressStream(const string &Destination)
+    : Destination(Destination) {
+  const string SocketPrefix = "unix:";
+  if (Destination.compare(0, SocketPrefix.size(), SocketPrefix) == 0) {
+    string Path = Destination.substr(SocketPrefix.size());
+    sockaddr_un Address{};
+    Address.sun_family = AF_UNIX;
+    if (Path.size() >= sizeof(Address.sun_path)) {
+      throw ios_base::failure("socket path too long: " + Path);
+    }
+    strncpy(Address.sun_path, Path.c_str(), sizeof(Address.sun_path) - 1);
+    FD = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (FD >= 0 && connect(FD, reinterpret_cast<sockaddr *>(&Address),
+                           sizeof(Address)) != 0) {
+      close(FD);
+      FD = -1;
+    }
+  } else {
+    FD = open(Destination.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  }
+  if (FD < 0) {
+    throw ios_base::failure("could not open progress stream " + Destination +
+                            ": " + strerror(errno));
+  }
+}
+
+ProgressStream::~ProgressStream() {
+  if (FD >= 0) {
+    close(FD);
+  }
+}
+
+bool ProgressStream::writeLine(const string &Line) {
+  if (FD < 0) {
+    return false;
+  }
+  string Data = Line + '\n';
+  size_t Written = 0;
+  while (Written < Data.size()) {
+    // MSG_NOSIGNAL keeps a closed socket from raising SIGPIPE
+    ssize_t Result =
+        send(FD, Data.data() + Written, Data.size() - Written, MSG_NOSIGNAL);
+    if (Result < 0 && errno == ENOTSOCK) {
+      Result = write(FD, Data.data() + Written, Data.size() - Written);
+    }
+    if (Result < 0 && errno == EINTR) {
+      continue;
+    }
+    if (Result <= 0) {
+      auto &lg = lg::get();
+      LOG_IF_ENABLE(BOOST_LOG_SEV(lg, WARNING)
+                    << "Could not write to progress stream " << Destination
+                    << ", closing it");
+      close(FD);
+      FD = -1;
+      return false;
+    }
+    Written += Result;
+  }
+  return true;
+}
+
+} // namespace psr
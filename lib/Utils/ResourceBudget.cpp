@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <fstream>
+#include <ostream>
+
+#include <unistd.h>
+
+#include <phasar/Utils/ResourceBudget.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+ostream &operator<<(ostream &os, const BudgetKind &BK) {
+  return os << wise_enum::to_string(BK);
+}
+
+size_t getResidentSetSize() {
+  // the second field is the number of resident pages
+  ifstream Statm("/proc/self/statm");
+  size_t NumPages = 0, NumResidentPages = 0;
+  if (!(Statm >> NumPages >> NumResidentPages)) {
+    return 0;
+  }
+  long PageSize = sysconf(_SC_PAGESIZE);
+  return PageSize > 0 ? NumResidentPages * PageSize : 0;
+}
+
+ResourceBudget::ResourceBudget(chrono::milliseconds TimeLimit,
+                               size_t PathEdgeLimit, size_t MemoryLimit)
+    : Start(chrono::steady_clock::now()), TimeLimit(TimeLimit),
+      PathEdgeLimit(PathEdgeLimit), MemoryLimit(MemoryLimit), NumChecks(0),
+      Exceeded(BudgetKind::None) {}
+
+void ResourceBudget::start() {
+  Start = chrono::steady_clock::now();
+  NumChecks = 0;
+  Exceeded = BudgetKind::None;
+}
+
+bool ResourceBudget::exceeded(size_t NumPathEdges) {
+  if (Exceeded != BudgetKind::None) {
+    return true;
+  }
+  BudgetKind Kind = BudgetKind::None;
+  if (PathEdgeLimit > 0 && NumPathEdges > PathEdgeLimit) {
+    Kind = BudgetKind::PathEdges;
+  } else if (++NumChecks % CheckInterval == 0) {
+    if (TimeLimit.count() > 0 &&
+        chrono::steady_clock::now() - Start > TimeLimit) {
+      Kind = BudgetKind::Time;
+    } else if (MemoryLimit > 0 && getResidentSetSize() > MemoryLimit) {
+      Kind = BudgetKind::Memory;
+    }
+  }
+  if (Kind == BudgetKind::None) {
+    return false;
+  }
+  // keep the budget that has been exceeded first
+  BudgetKind Expected = BudgetKind::None;
+  Exceeded.compare_exchange_strong(Expected, Kind);
+  return true;
+}
+
+} // namespace psr
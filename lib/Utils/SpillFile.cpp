@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include <ios>
+
+#include <phasar/Utils/SpillFile.h>
+
+using namespace std;
+using namespace psr;
+
+namespace psr {
+
+SpillFile::SpillFile() : File(tmpfile()) {
+  if (!File) {
+    throw ios_base::failure("could not create spill file");
+  }
+}
+
+SpillFile::~SpillFile() { fclose(File); }
+
+void SpillFile::writeBytes(const void *Data, size_t Size) {
+  // reads may have moved the file position
+  if (fseek(File, 0, SEEK_END) != 0 || fwrite(Data, 1, Size, File) != Size) {
+    throw ios_base::failure("could not write spill file");
+  }
+  NumBytes += Size;
+}
+
+bool SpillFile::readBytes(void *Data, size_t Size) {
+  size_t Read = fread(Data, 1, Size, File);
+  if (Read != Size && (Read != 0 || ferror(File))) {
+    throw ios_base::failure("could not read spill file");
+  }
+  return Read == Size;
+}
+
+void SpillFile::seek(size_t Offset) {
+  if (fflush(File) != 0 || fseek(File, Offset, SEEK_SET) != 0) {
+    throw ios_base::failure("could not read spill file");
+  }
+}
+
+void SpillFile::clear() {
+  FILE *Fresh = tmpfile();
+  if (!Fresh) {
+    throw ios_base::failure("could not create spill file");
+  }
+  fclose(File);
+  File = Fresh;
+  NumBytes = 0;
+}
+
+} // namespace psr
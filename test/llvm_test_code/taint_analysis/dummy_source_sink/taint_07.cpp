@@ -0,0 +1,10 @@
+extern int source();     // dummy source
+extern void sink(int p); // dummy sink
+
+void leak(int p) { sink(p); }
+
+int main(int argc, char **argv) {
+	int a = source();
+	leak(a);
+	return 0;
+}
\ No newline at end of file
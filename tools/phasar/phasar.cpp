@@ -232,9 +232,13 @@ int main(int argc, const char **argv) {
 			("module,m", bpo::value<std::vector<std::string>>()->multitoken()->zero_tokens()->composing()->notifier(validateParamModule), "Path to the module(s) under analysis")
       ("entry-points,E", bpo::value<std::vector<std::string>>()->multitoken()->zero_tokens()->composing(), "Set the entry point(s) to be used")
       ("output,O", bpo::value<std::string>()->notifier(validateParamOutput)->default_value("results.json"), "Filename for the results")
+      ("stream-results", bpo::value<bool>()->default_value(0), "Stream the results to the output file while the analyses run instead of collecting them in memory (1 or 0)")
 			("data-flow-analysis,D", bpo::value<std::vector<std::string>>()->multitoken()->zero_tokens()->composing()->notifier(validateParamDataFlowAnalysis), "Set the analysis to be run")
 			("pointer-analysis,P", bpo::value<std::string>()->notifier(validateParamPointerAnalysis), "Set the points-to analysis to be used (CFLSteens, CFLAnders)")
       ("callgraph-analysis,C", bpo::value<std::string>()->notifier(validateParamCallGraphAnalysis), "Set the call-graph algorithm to be used (CHA, RTA, DTA, VTA, OTF)")
+      ("callgraph-threads", bpo::value<unsigned>(), "Number of threads used to construct CHA and RTA call graphs")
+      ("callgraph-cache", bpo::value<std::string>(), "Load the call graph from this file if it matches the input, otherwise construct and store it there")
+      ("address-taken-targets", bpo::value<bool>()->default_value(1), "Resolve function pointers to address-taken functions only, applies in 'wpa' mode (1 or 0)")
 			("classhierachy-analysis,H", bpo::value<bool>(), "Class-hierarchy analysis")
 			("vtable-analysis,V", bpo::value<bool>(), "Virtual function table analysis")
 			("statistical-analysis,S", bpo::value<bool>(), "Statistics")
@@ -243,6 +247,12 @@ int main(int argc, const char **argv) {
 			("mem2reg,M", bpo::value<bool>()->default_value(1), "Promote memory to register pass (1 or 0)")
 			("printedgerec,R", bpo::value<bool>()->default_value(0), "Print exploded-super-graph edge recorder (1 or 0)")
       ("log,L", bpo::value<bool>()->default_value(false), "Enable logging (1 or 0)")
+      ("time-budget", bpo::value<std::size_t>(), "Wall-clock budget of each IFDS/IDE analysis in seconds, results are marked incomplete if it is exceeded")
+      ("path-edge-budget", bpo::value<std::size_t>(), "Path-edge budget of each IFDS/IDE analysis, results are marked incomplete if it is exceeded")
+      ("memory-budget", bpo::value<std::size_t>(), "Resident-set-size budget of each IFDS/IDE analysis in MiB, results are marked incomplete if it is exceeded")
+      ("progress", bpo::value<std::string>(), "Write progress snapshots of each IFDS/IDE analysis to a file, or to a Unix domain socket given as 'unix:<path>'")
+      ("compact-results", bpo::value<bool>()->default_value(0), "Freeze the results of each IFDS/IDE analysis into a compact sorted table (1 or 0)")
+      ("intern-edge-functions", bpo::value<bool>()->default_value(0), "Share equal edge functions and memoize their compositions and joins in each IDE analysis (1 or 0)")
       #ifdef PHASAR_PLUGINS_ENABLED
 			("analysis-plugin", bpo::value<std::vector<std::string>>()->notifier(validateParamAnalysisPlugin), "Analysis plugin(s) (absolute path to the shared object file(s))")
       ("callgraph-plugin", bpo::value<std::string>()->notifier(validateParamICFGPlugin), "ICFG plugin (absolute path to the shared object file)")
@@ -477,7 +487,10 @@ int main(int argc, const char **argv) {
         }(),
         ChosenDataFlowAnalyses, VariablesMap["wpa"].as<bool>(),
         VariablesMap["printedgerec"].as<bool>(),
-        VariablesMap["graph-id"].as<std::string>());
+        VariablesMap["graph-id"].as<std::string>(),
+        VariablesMap["stream-results"].as<bool>()
+            ? VariablesMap["output"].as<std::string>()
+            : "");
     LOG_IF_ENABLE(BOOST_LOG_SEV(lg, INFO) << "Write results to file");
     Controller.writeResults(VariablesMap["output"].as<std::string>());
   } else {
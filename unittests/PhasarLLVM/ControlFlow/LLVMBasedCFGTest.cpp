@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <gtest/gtest.h>
 #include <llvm/IR/InstIterator.h>
 #include <phasar/DB/ProjectIRDB.h>
@@ -181,6 +183,49 @@ TEST_F(LLVMBasedCFGTest, HandlesCallSuccessor) {
   ASSERT_EQ(succsOfCallInst, Successors);
 }
 
+TEST_F(LLVMBasedCFGTest, HandlesIndexedNeighbours) {
+  LLVMBasedCFG cfg;
+  ProjectIRDB IRDB({pathToLLFiles + "control_flow/switch_cpp.ll"});
+  auto F = IRDB.getFunction("main");
+
+  // the switch reaches the block of 'store i32 20' by two cases
+  auto SwitchInst = getNthTermInstruction(F, 1);
+  std::vector<const llvm::Instruction *> Predeccessor{SwitchInst, SwitchInst};
+  ASSERT_EQ(cfg.getPredsOfRef(getNthStoreInstruction(F, 4)).vec(),
+            Predeccessor);
+  // every edge of the index is found in both directions
+  size_t NumEdges = 0;
+  for (auto Inst : cfg.getAllInstructionsOfRef(F)) {
+    for (auto Succ : cfg.getSuccsOfRef(Inst)) {
+      auto Preds = cfg.getPredsOfRef(Succ);
+      ASSERT_NE(std::find(Preds.begin(), Preds.end(), Inst), Preds.end());
+      ++NumEdges;
+    }
+  }
+  ASSERT_EQ(cfg.getAllControlFlowEdges(F).size(), NumEdges);
+  ASSERT_EQ(cfg.getCFGIndex(F).getNumEdges(), NumEdges);
+}
+
+TEST_F(LLVMBasedCFGTest, HandlesAlternatingIndices) {
+  ProjectIRDB IRDB({pathToLLFiles + "control_flow/function_call_cpp.ll"});
+  auto Main = IRDB.getFunction("main");
+  auto Mult = IRDB.getFunction("_Z4multii");
+  // every thread remembers the index it has requested last, which must
+  // neither leak into queries of another function nor of another CFG
+  LLVMBasedCFG cfg, other;
+  for (int Round = 0; Round < 2; ++Round) {
+    for (auto F : {Main, Mult, Main}) {
+      for (auto Graph : {&cfg, &other}) {
+        ASSERT_EQ(&Graph->getCFGIndex(F), &Graph->getCFGIndex(F));
+        ASSERT_EQ(Graph->getCFGIndex(F).getInstruction(0), &F->front().front());
+        ASSERT_EQ(Graph->getSuccsOfRef(&F->front().front()).vec(),
+                  Graph->getSuccsOf(&F->front().front()));
+      }
+      ASSERT_NE(&cfg.getCFGIndex(F), &other.getCFGIndex(F));
+    }
+  }
+}
+
 TEST_F(LLVMBasedCFGTest, HandleFieldLoadsArray) {
   LLVMBasedCFG cfg;
   ProjectIRDB IRDB({pathToLLFiles + "fields/array_1_cpp.ll"});
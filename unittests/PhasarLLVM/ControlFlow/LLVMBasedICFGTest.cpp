@@ -1,8 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <set>
 #include <string>
 #include <vector>
 
+#include <boost/filesystem.hpp>
+
 #include <llvm/Support/raw_ostream.h>
 
 #include <phasar/DB/ProjectIRDB.h>
@@ -108,6 +112,40 @@ TEST_F(LLVMBasedICFGTest, FunctionPointer_1) {
   }
 }
 
+TEST_F(LLVMBasedICFGTest, FunctionPointer_AddressTakenTargets) {
+  ProjectIRDB IRDB({pathToLLFiles + "call_graphs/function_pointer_1_c.ll"},
+                   IRDBOptions::WPA);
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG AllTargets(TH, IRDB, CallGraphAnalysisType::CHA, {"main"});
+  IRDB.setAddressTakenTargetsOnly(true);
+  LLVMBasedICFG AddressTaken(TH, IRDB, CallGraphAnalysisType::CHA, {"main"});
+  llvm::Function *F = IRDB.getFunction("main");
+  llvm::Function *Foo = IRDB.getFunction("foo");
+  llvm::Function *Bar = IRDB.getFunction("bar");
+  ASSERT_TRUE(F);
+  ASSERT_TRUE(Foo);
+  ASSERT_TRUE(Bar);
+  const llvm::Instruction *IndirectCall = nullptr;
+  for (auto &BB : *F) {
+    for (auto &I : BB) {
+      if (auto Call = llvm::dyn_cast<llvm::CallInst>(&I)) {
+        if (!Call->getCalledFunction()) {
+          IndirectCall = Call;
+        }
+      }
+    }
+  }
+  ASSERT_TRUE(IndirectCall);
+  // both modes resolve the pointer to bar, but only the full one keeps foo,
+  // whose address is never taken
+  auto AllCallees = AllTargets.getCalleesOfCallAt(IndirectCall);
+  EXPECT_TRUE(AllCallees.count(Bar));
+  EXPECT_TRUE(AllCallees.count(Foo));
+  EXPECT_EQ(AddressTaken.getCalleesOfCallAt(IndirectCall),
+            set<const llvm::Function *>{Bar});
+}
+
 TEST_F(LLVMBasedICFGTest, StaticCallSite_3) {
   ProjectIRDB IRDB({pathToLLFiles + "call_graphs/static_callsite_3_c.ll"},
                    IRDBOptions::WPA);
@@ -259,6 +297,89 @@ TEST_F(LLVMBasedICFGTest, StaticCallSite_8) {
   ASSERT_TRUE(ICFG.isStartPoint(I));
 }
 
+TEST_F(LLVMBasedICFGTest, CallGraphSCCs) {
+  ProjectIRDB IRDB(
+      {pathToLLFiles + "uninitialized_variables/recursion_cpp_dbg.ll"},
+      IRDBOptions::WPA);
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::CHA, {"main"});
+  const llvm::Function *F = IRDB.getFunction("main");
+  const llvm::Function *Foo = IRDB.getFunction("_Z3fooRii");
+  ASSERT_TRUE(F);
+  ASSERT_TRUE(Foo);
+  auto SCCs = ICFG.getCallGraphSCCs();
+  ASSERT_EQ(SCCs.size(), 2);
+  // the recursive callee precedes its caller
+  EXPECT_EQ(SCCs[0], std::vector<const llvm::Function *>{Foo});
+  EXPECT_EQ(SCCs[1], std::vector<const llvm::Function *>{F});
+}
+
+TEST_F(LLVMBasedICFGTest, CallSiteIndex) {
+  ProjectIRDB IRDB(
+      {pathToLLFiles + "uninitialized_variables/recursion_cpp_dbg.ll"},
+      IRDBOptions::WPA);
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::CHA, {"main"});
+  const llvm::Function *F = IRDB.getFunction("main");
+  const llvm::Function *Foo = IRDB.getFunction("_Z3fooRii");
+  ASSERT_TRUE(F);
+  ASSERT_TRUE(Foo);
+  set<const llvm::Instruction *> CallsOfFoo;
+  for (auto Fun : {F, Foo}) {
+    for (auto &BB : *Fun) {
+      for (auto &I : BB) {
+        if (!ICFG.isCallStmt(&I)) {
+          continue;
+        }
+        auto Callees = ICFG.getCalleesOfCallAtRef(&I);
+        EXPECT_EQ(set<const llvm::Function *>(Callees.begin(), Callees.end()),
+                  ICFG.getCalleesOfCallAt(&I));
+        if (find(Callees.begin(), Callees.end(), Foo) != Callees.end()) {
+          CallsOfFoo.insert(&I);
+        }
+      }
+    }
+  }
+  // main calls foo, which calls itself
+  ASSERT_EQ(CallsOfFoo.size(), 2);
+  auto Callers = ICFG.getCallersOfRef(Foo);
+  EXPECT_EQ(set<const llvm::Instruction *>(Callers.begin(), Callers.end()),
+            CallsOfFoo);
+  EXPECT_TRUE(ICFG.getCallersOfRef(F).empty());
+}
+
+TEST_F(LLVMBasedICFGTest, CallGraphCache) {
+  ProjectIRDB IRDB({pathToLLFiles + "call_graphs/virtual_call_7_cpp.ll"},
+                   IRDBOptions::WPA);
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  string CacheFile =
+      boost::filesystem::unique_path(boost::filesystem::temp_directory_path() /
+                                     "callgraph-%%%%-%%%%")
+          .string();
+  LLVMBasedICFG Built(TH, IRDB, CallGraphAnalysisType::CHA, {"main"}, 1,
+                      CacheFile);
+  ASSERT_TRUE(boost::filesystem::exists(CacheFile));
+  LLVMBasedICFG Cached(TH, IRDB, CallGraphAnalysisType::CHA, {"main"}, 1,
+                       CacheFile);
+  boost::filesystem::remove(CacheFile);
+  EXPECT_EQ(Cached.getNumOfVertices(), Built.getNumOfVertices());
+  EXPECT_EQ(Cached.getNumOfEdges(), Built.getNumOfEdges());
+  for (auto F : IRDB.getAllFunctions()) {
+    EXPECT_EQ(Cached.getCallersOf(F), Built.getCallersOf(F));
+    for (auto &BB : *F) {
+      for (auto &I : BB) {
+        if (Built.isCallStmt(&I)) {
+          EXPECT_EQ(Cached.getCalleesOfCallAt(&I),
+                    Built.getCalleesOfCallAt(&I));
+        }
+      }
+    }
+  }
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
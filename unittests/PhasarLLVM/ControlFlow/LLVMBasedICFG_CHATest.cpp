@@ -117,6 +117,29 @@ TEST_F(LLVMBasedICFG_CHATest, VirtualCallSite_7) {
   }
 }
 
+TEST_F(LLVMBasedICFG_CHATest, ParallelConstruction) {
+  ProjectIRDB IRDB({pathToLLFiles + "call_graphs/virtual_call_7_cpp.ll"},
+                   IRDBOptions::WPA);
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::CHA, {"main"});
+  LLVMBasedICFG ParallelICFG(TH, IRDB, CallGraphAnalysisType::CHA, {"main"},
+                             4);
+  ASSERT_EQ(ParallelICFG.getNumOfVertices(), ICFG.getNumOfVertices());
+  ASSERT_EQ(ParallelICFG.getNumOfEdges(), ICFG.getNumOfEdges());
+  for (auto F : IRDB.getAllFunctions()) {
+    ASSERT_EQ(ParallelICFG.getCallersOf(F), ICFG.getCallersOf(F));
+    for (auto &BB : *F) {
+      for (auto &I : BB) {
+        if (llvm::isa<llvm::CallInst>(&I) || llvm::isa<llvm::InvokeInst>(&I)) {
+          ASSERT_EQ(ParallelICFG.getCalleesOfCallAt(&I),
+                    ICFG.getCalleesOfCallAt(&I));
+        }
+      }
+    }
+  }
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
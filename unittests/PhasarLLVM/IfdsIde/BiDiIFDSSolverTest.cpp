@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Instructions.h>
+
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedBackwardICFG.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Identity.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/LambdaFlow.h>
+#include <phasar/PhasarLLVM/IfdsIde/LLVMDefaultIFDSTabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/LLVMZeroValue.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/BiDiIFDSSolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
+#include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+#include <phasar/Utils/LLVMShorthands.h>
+
+using namespace std;
+using namespace psr;
+
+using n_t = const llvm::Instruction *;
+using d_t = const llvm::Value *;
+using m_t = const llvm::Function *;
+
+/* ============== TEST PROBLEMS ============== */
+
+// Facts are the memory locations that are stored to. Both directions pass
+// all facts through calls; they differ in where facts are generated.
+template <typename I>
+class StoredLocations : public LLVMDefaultIFDSTabulationProblem<d_t, I> {
+public:
+  // the solver that tabulates the requests, if any
+  BiDiFactExchange<n_t, d_t> *Exchange = nullptr;
+
+  StoredLocations(I icfg, const LLVMTypeHierarchy &th, const ProjectIRDB &irdb)
+      : LLVMDefaultIFDSTabulationProblem<d_t, I>(icfg, th, irdb) {
+    this->zerovalue = createZeroValue();
+  }
+
+  shared_ptr<FlowFunction<d_t>> getCallFlowFunction(n_t, m_t) override {
+    return Identity<d_t>::getInstance();
+  }
+
+  shared_ptr<FlowFunction<d_t>> getRetFlowFunction(n_t, m_t, n_t,
+                                                   n_t) override {
+    return Identity<d_t>::getInstance();
+  }
+
+  shared_ptr<FlowFunction<d_t>> getCallToRetFlowFunction(n_t, n_t,
+                                                         set<m_t>) override {
+    return Identity<d_t>::getInstance();
+  }
+
+  d_t createZeroValue() override { return LLVMZeroValue::getInstance(); }
+
+  bool isZeroValue(d_t d) const override {
+    return LLVMZeroValue::getInstance()->isLLVMZeroValue(d);
+  }
+
+  void printNode(ostream &os, n_t n) const override { os << llvmIRToString(n); }
+
+  void printDataFlowFact(ostream &os, d_t d) const override {
+    os << llvmIRToString(d);
+  }
+
+  void printMethod(ostream &os, m_t m) const override {
+    os << m->getName().str();
+  }
+};
+
+// Generates the pointer operand of a store after the store and requests the
+// backward direction to find where it is defined.
+class ForwardStores : public StoredLocations<LLVMBasedICFG &> {
+public:
+  using StoredLocations<LLVMBasedICFG &>::StoredLocations;
+
+  shared_ptr<FlowFunction<d_t>> getNormalFlowFunction(n_t curr,
+                                                      n_t) override {
+    auto Store = llvm::dyn_cast<llvm::StoreInst>(curr);
+    if (!Store) {
+      return Identity<d_t>::getInstance();
+    }
+    return make_shared<LambdaFlow<d_t>>([this, Store](d_t source) {
+      if (!isZeroValue(source)) {
+        return set<d_t>{source};
+      }
+      if (Exchange) {
+        Exchange->requestBackward(Store, Store->getPointerOperand());
+      }
+      return set<d_t>{source, Store->getPointerOperand()};
+    });
+  }
+
+  map<n_t, set<d_t>> initialSeeds() override {
+    return {{&icfg.getMethod("main")->front().front(), {zeroValue()}}};
+  }
+};
+
+// Propagates the requested locations backwards up to their definition and
+// requests the forward direction to start from there.
+class BackwardDefinitions : public StoredLocations<LLVMBasedBackwardsICFG &> {
+public:
+  using StoredLocations<LLVMBasedBackwardsICFG &>::StoredLocations;
+
+  shared_ptr<FlowFunction<d_t>> getNormalFlowFunction(n_t curr,
+                                                      n_t succ) override {
+    return make_shared<LambdaFlow<d_t>>([this, curr, succ](d_t source) {
+      // succ precedes curr in the program
+      if (source == succ && Exchange) {
+        Exchange->requestForward(curr, source);
+      }
+      return set<d_t>{source};
+    });
+  }
+
+  map<n_t, set<d_t>> initialSeeds() override { return {}; }
+};
+
+/* ============== TEST FIXTURE ============== */
+
+class BiDiIFDSSolverTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/linear_constant/";
+  const std::vector<std::string> EntryPoints = {"main"};
+
+  void SetUp() override {
+    bl::core::get()->set_logging_enabled(false);
+    ValueAnnotationPass::resetValueID();
+  }
+}; // Test Fixture
+
+TEST_F(BiDiIFDSSolverTest, ExchangesFactsBetweenDirections) {
+  ProjectIRDB IRDB({pathToLLFiles + "basic_01_cpp_dbg.ll"});
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+  LLVMBasedBackwardsICFG BackwardICFG(ICFG);
+  ForwardStores FwProblem(ICFG, TH, IRDB);
+  BackwardDefinitions BwProblem(BackwardICFG, TH, IRDB);
+  // both directions run on a single thread regardless of the configuration
+  FwProblem.solver_config.numThreads = 4;
+  BwProblem.solver_config.numThreads = 4;
+  BiDiIFDSSolver<n_t, d_t, m_t, LLVMBasedICFG &, LLVMBasedBackwardsICFG &>
+      Solver(FwProblem, BwProblem);
+  FwProblem.Exchange = &Solver;
+  BwProblem.Exchange = &Solver;
+  Solver.solve();
+  EXPECT_TRUE(Solver.getForwardSolver().isComplete());
+  EXPECT_TRUE(Solver.getBackwardSolver().isComplete());
+  // the forward direction on its own only knows the locations after the
+  // stores
+  ForwardStores PlainProblem(ICFG, TH, IRDB);
+  IFDSSolver<n_t, d_t, m_t, LLVMBasedICFG &> PlainSolver(PlainProblem);
+  PlainSolver.solve();
+  unsigned NumStores = 0;
+  for (auto &I : llvm::instructions(IRDB.getFunction("main"))) {
+    auto Store = llvm::dyn_cast<llvm::StoreInst>(&I);
+    if (!Store) {
+      continue;
+    }
+    ++NumStores;
+    auto Alloca = llvm::dyn_cast<llvm::AllocaInst>(Store->getPointerOperand());
+    ASSERT_TRUE(Alloca);
+    const llvm::Instruction *AfterAlloca = Alloca->getNextNode();
+    ASSERT_NE(AfterAlloca, Store);
+    EXPECT_TRUE(Solver.forwardResultsAt(Store->getNextNode()).count(Alloca));
+    // the store requested the backward direction to find the alloca ...
+    EXPECT_TRUE(Solver.backwardResultsAt(Alloca).count(Alloca));
+    // ... which requested the forward direction to start right after it
+    EXPECT_TRUE(Solver.forwardResultsAt(AfterAlloca).count(Alloca));
+    EXPECT_FALSE(PlainSolver.ifdsResultsAt(AfterAlloca).count(Alloca));
+  }
+  EXPECT_EQ(NumStores, 2u);
+}
+
+TEST_F(BiDiIFDSSolverTest, StopsDirectionThatExceedsItsBudget) {
+  ProjectIRDB IRDB({pathToLLFiles + "basic_01_cpp_dbg.ll"});
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+  LLVMBasedBackwardsICFG BackwardICFG(ICFG);
+  ForwardStores FwProblem(ICFG, TH, IRDB);
+  BackwardDefinitions BwProblem(BackwardICFG, TH, IRDB);
+  FwProblem.solver_config.pathEdgeBudget = 1;
+  BiDiIFDSSolver<n_t, d_t, m_t, LLVMBasedICFG &, LLVMBasedBackwardsICFG &>
+      Solver(FwProblem, BwProblem);
+  FwProblem.Exchange = &Solver;
+  BwProblem.Exchange = &Solver;
+  Solver.solve();
+  EXPECT_EQ(Solver.getForwardSolver().getExceededBudget(),
+            BudgetKind::PathEdges);
+  // the forward direction stopped before reaching a store, hence it has
+  // never requested anything
+  EXPECT_TRUE(Solver.getBackwardSolver().isComplete());
+  for (auto &I : llvm::instructions(IRDB.getFunction("main"))) {
+    EXPECT_TRUE(Solver.backwardResultsAt(&I).empty());
+  }
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Instructions.h>
+
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSUninitializedVariables.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/BottomUpSummaryGenerator.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
+#include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+
+using namespace std;
+using namespace psr;
+
+// Only the facts of this problem are looked at, hence the summaries may be
+// reused although its flow functions record the uses of undefined values.
+class UninitializedVariablesFacts : public IFDSUninitializedVariables {
+public:
+  using IFDSUninitializedVariables::IFDSUninitializedVariables;
+
+  bool hasFlowFunctionSideEffects() const override { return false; }
+};
+
+/* ============== TEST FIXTURE ============== */
+
+class BottomUpSummaryGeneratorTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/uninitialized_variables/";
+  const std::vector<std::string> EntryPoints = {"main"};
+  std::string SummaryDirectory;
+
+  void SetUp() override {
+    bl::core::get()->set_logging_enabled(false);
+    ValueAnnotationPass::resetValueID();
+    SummaryDirectory =
+        boost::filesystem::unique_path(
+            boost::filesystem::temp_directory_path() / "summaries-%%%%-%%%%")
+            .string();
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove_all(SummaryDirectory);
+  }
+}; // Test Fixture
+
+TEST_F(BottomUpSummaryGeneratorTest, ReusedSummariesMatchFullRun) {
+  ProjectIRDB IRDB({pathToLLFiles + "recursion_cpp_dbg.ll"});
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+  IFDSBottomUpSummaryGenerator<const llvm::Instruction *, const llvm::Value *,
+                               const llvm::Function *, LLVMBasedICFG &>
+      Generator(ICFG,
+                [&]() {
+                  return make_unique<UninitializedVariablesFacts>(
+                      ICFG, TH, IRDB, EntryPoints);
+                },
+                SummaryDirectory, nullptr, 4);
+  Generator.generateSummaries();
+  EXPECT_EQ(Generator.getNumReused(), 0);
+  // the zero value reaches the exit of foo, whose inputs are its parameters
+  const llvm::Function *Foo = IRDB.getFunction("_Z3fooRii");
+  ASSERT_TRUE(Foo);
+  EXPECT_TRUE(Generator.getSummaryPool().containsSummary(
+      &Foo->front().front(), {false, false}));
+  // there is a summary for each exit of foo
+  auto Summaries = Generator.getSummaryPool().getSummaries(
+      &Foo->front().front(), {false, false});
+  EXPECT_FALSE(Summaries.empty());
+  for (auto &Summary : Summaries) {
+    EXPECT_TRUE(llvm::isa<llvm::ReturnInst>(Summary.getEndNode()));
+    EXPECT_FALSE(Summary.getOutputs().empty());
+  }
+
+  IFDSUninitializedVariables FullProblem(ICFG, TH, IRDB, EntryPoints);
+  IFDSSolver<const llvm::Instruction *, const llvm::Value *,
+             const llvm::Function *, LLVMBasedICFG &>
+      FullSolver(FullProblem);
+  FullSolver.solve();
+  UninitializedVariablesFacts SummaryProblem(ICFG, TH, IRDB, EntryPoints);
+  SummaryProblem.solver_config.computePersistedSummaries = true;
+  SummaryProblem.solver_config.summaryDirectory = SummaryDirectory;
+  IFDSSolver<const llvm::Instruction *, const llvm::Value *,
+             const llvm::Function *, LLVMBasedICFG &>
+      SummarySolver(SummaryProblem);
+  SummarySolver.solve();
+  for (auto F : IRDB.getAllFunctions()) {
+    for (auto &I : llvm::instructions(F)) {
+      EXPECT_EQ(SummarySolver.ifdsResultsAt(&I), FullSolver.ifdsResultsAt(&I));
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <llvm/IR/InstIterator.h>
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSUninitializedVariables.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/DemandDrivenIFDSSolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
+#include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+
+using namespace std;
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+
+class DemandDrivenIFDSSolverTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/uninitialized_variables/";
+  const std::vector<std::string> EntryPoints = {"main"};
+
+  void SetUp() override {
+    bl::core::get()->set_logging_enabled(false);
+    ValueAnnotationPass::resetValueID();
+  }
+}; // Test Fixture
+
+TEST_F(DemandDrivenIFDSSolverTest, QueriesMatchFullRun) {
+  ProjectIRDB IRDB({pathToLLFiles + "callsite_cpp_dbg.ll"});
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+  IFDSUninitializedVariables FullProblem(ICFG, TH, IRDB, EntryPoints);
+  IFDSUninitializedVariables DemandProblem(ICFG, TH, IRDB, EntryPoints);
+  // queries are answered on a single thread regardless of the configuration
+  DemandProblem.solver_config.numThreads = 4;
+  IFDSSolver<const llvm::Instruction *, const llvm::Value *,
+             const llvm::Function *, LLVMBasedICFG &>
+      FullSolver(FullProblem);
+  FullSolver.solve();
+  DemandDrivenIFDSSolver<const llvm::Instruction *, const llvm::Value *,
+                         const llvm::Function *, LLVMBasedICFG &>
+      DemandSolver(DemandProblem);
+  for (auto F : IRDB.getAllFunctions()) {
+    for (auto &I : llvm::instructions(F)) {
+      for (auto Fact : FullSolver.ifdsResultsAt(&I)) {
+        EXPECT_TRUE(DemandSolver.query(&I, Fact));
+      }
+    }
+  }
+  for (auto F : IRDB.getAllFunctions()) {
+    for (auto &I : llvm::instructions(F)) {
+      EXPECT_EQ(DemandSolver.queryFactsAt(&I), FullSolver.ifdsResultsAt(&I));
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
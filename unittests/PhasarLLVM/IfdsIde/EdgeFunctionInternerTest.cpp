@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionComposer.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionInterner.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/AllBottom.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/EdgeIdentity.h>
+
+using namespace psr;
+
+struct MyEFC : EdgeFunctionComposer<int> {
+  MyEFC(std::shared_ptr<EdgeFunction<int>> F,
+        std::shared_ptr<EdgeFunction<int>> G)
+      : EdgeFunctionComposer<int>(F, G){};
+  std::shared_ptr<EdgeFunction<int>>
+  joinWith(std::shared_ptr<EdgeFunction<int>> otherFunction) override {
+    return std::make_shared<AllBottom<int>>(-1);
+  };
+};
+
+// a composer of another type, which joins differently
+struct OtherEFC : EdgeFunctionComposer<int> {
+  OtherEFC(std::shared_ptr<EdgeFunction<int>> F,
+           std::shared_ptr<EdgeFunction<int>> G)
+      : EdgeFunctionComposer<int>(F, G){};
+  std::shared_ptr<EdgeFunction<int>>
+  joinWith(std::shared_ptr<EdgeFunction<int>> otherFunction) override {
+    return std::make_shared<AllBottom<int>>(-2);
+  };
+};
+
+struct AddTwoEF : EdgeFunction<int>, std::enable_shared_from_this<AddTwoEF> {
+  int computeTarget(int source) override { return source + 2; };
+  std::shared_ptr<EdgeFunction<int>>
+  composeWith(std::shared_ptr<EdgeFunction<int>> secondFunction) override {
+    return std::make_shared<MyEFC>(this->shared_from_this(), secondFunction);
+  }
+  std::shared_ptr<EdgeFunction<int>>
+  joinWith(std::shared_ptr<EdgeFunction<int>> otherFunction) override {
+    return std::make_shared<AllBottom<int>>(-1);
+  };
+  bool equal_to(std::shared_ptr<EdgeFunction<int>> other) const override {
+    return this == other.get();
+  }
+};
+
+TEST(EdgeFunctionInternerTest, HandleEqualFunctions) {
+  EdgeFunctionInterner<int> Interner;
+  auto AB1 = Interner.intern(std::make_shared<AllBottom<int>>(-1));
+  auto AB2 = Interner.intern(std::make_shared<AllBottom<int>>(-1));
+  auto AB3 = Interner.intern(std::make_shared<AllBottom<int>>(-2));
+  EXPECT_EQ(AB1, AB2);
+  EXPECT_NE(AB1, AB3);
+  EXPECT_EQ(Interner.size(), 2u);
+}
+
+TEST(EdgeFunctionInternerTest, HandleMemoizedOperations) {
+  EdgeFunctionInterner<int> Interner;
+  auto EF1 = std::make_shared<AddTwoEF>();
+  auto EF2 = std::make_shared<AddTwoEF>();
+  auto EFC1 = Interner.compose(EF1, EF2);
+  auto EFC2 = Interner.compose(EF1, EF2);
+  EXPECT_EQ(EFC1, EFC2);
+  EXPECT_EQ(EFC1->computeTarget(0), 4);
+  // structurally equal composers share a single representative
+  EXPECT_EQ(Interner.intern(std::make_shared<MyEFC>(EF1, EF2)), EFC1);
+  // all joins yield equal functions
+  EXPECT_EQ(Interner.join(EF1, EF2), Interner.join(EF2, EF1));
+  auto Id = EdgeIdentity<int>::getInstance();
+  EXPECT_EQ(Interner.compose(Id, EF1), EF1);
+}
+
+// equal to every other instance, but hashed by its address
+struct LenientEF : AddTwoEF {
+  bool equal_to(std::shared_ptr<EdgeFunction<int>> other) const override {
+    return dynamic_cast<LenientEF *>(other.get()) != nullptr;
+  }
+};
+
+TEST(EdgeFunctionInternerTest, HandleComposerEquality) {
+  EdgeFunctionInterner<int> Interner;
+  auto EF1 = std::make_shared<AddTwoEF>();
+  auto EF2 = std::make_shared<AddTwoEF>();
+  auto EFC1 = std::make_shared<MyEFC>(EF1, EF2);
+  auto EFC2 = std::make_shared<MyEFC>(EF1, EF2);
+  EXPECT_TRUE(EFC1->equal_to(EFC2));
+  EXPECT_EQ(EFC1->hash(), EFC2->hash());
+  // composers of different types are never equal
+  auto Other = std::make_shared<OtherEFC>(EF1, EF2);
+  EXPECT_FALSE(EFC1->equal_to(Other));
+  EXPECT_FALSE(Other->equal_to(EFC1));
+  EXPECT_NE(Interner.intern(EFC1), Interner.intern(Other));
+  // parts that are equal but hashed differently make the composers unequal,
+  // such that equal composers always have the same hash value
+  auto L1 = std::make_shared<LenientEF>();
+  auto L2 = std::make_shared<LenientEF>();
+  ASSERT_TRUE(L1->equal_to(L2));
+  auto LEFC1 = std::make_shared<MyEFC>(L1, EF1);
+  auto LEFC2 = std::make_shared<MyEFC>(L2, EF1);
+  EXPECT_EQ(LEFC1->equal_to(LEFC2), LEFC1->hash() == LEFC2->hash());
+  EXPECT_NE(Interner.intern(LEFC1), Interner.intern(LEFC2));
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
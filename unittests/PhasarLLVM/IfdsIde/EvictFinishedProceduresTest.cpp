@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <llvm/IR/InstIterator.h>
+
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IDELinearConstantAnalysis.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSUninitializedVariables.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IDESolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
+#include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+
+using namespace std;
+using namespace psr;
+
+using n_t = const llvm::Instruction *;
+using d_t = const llvm::Value *;
+using m_t = const llvm::Function *;
+
+// Counts the methods it has evicted.
+template <typename SolverT> class EvictionCounting : public SolverT {
+public:
+  using SolverT::SolverT;
+
+  std::size_t NumEvictions = 0;
+
+  std::size_t getNumEndSummaries() const { return this->numEndSummaries(); }
+
+  void evictProcedure(m_t method) override {
+    ++NumEvictions;
+    SolverT::evictProcedure(method);
+  }
+};
+
+using LCASolver = EvictionCounting<
+    IDESolver<n_t, d_t, m_t, int64_t, LLVMBasedICFG &>>;
+
+using UninitSolver =
+    EvictionCounting<IFDSSolver<n_t, d_t, m_t, LLVMBasedICFG &>>;
+
+/* ============== TEST FIXTURE ============== */
+
+class EvictFinishedProceduresTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/";
+  const std::vector<std::string> EntryPoints = {"main"};
+
+  void SetUp() override {
+    bl::core::get()->set_logging_enabled(false);
+    ValueAnnotationPass::resetValueID();
+  }
+
+  // evicts every method as soon as it runs out of pending path edges
+  static void evictEagerly(SolverConfiguration &config) {
+    config.evictFinishedProcedures = true;
+    config.evictionDelay = 0;
+    config.worklistPolicy = WorklistPolicy::LIFO;
+  }
+
+  void compareLinearConstants(const std::string &IRFile) {
+    ProjectIRDB IRDB({pathToLLFiles + "linear_constant/" + IRFile});
+    IRDB.preprocessIR();
+    LLVMTypeHierarchy TH(IRDB);
+    LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+    IDELinearConstantAnalysis FullProblem(ICFG, TH, IRDB, EntryPoints);
+    LCASolver FullSolver(FullProblem);
+    FullSolver.solve();
+    IDELinearConstantAnalysis EvictingProblem(ICFG, TH, IRDB, EntryPoints);
+    evictEagerly(EvictingProblem.solver_config);
+    LCASolver EvictingSolver(EvictingProblem);
+    EvictingSolver.solve();
+    EXPECT_GT(EvictingSolver.NumEvictions, 0u);
+    EXPECT_EQ(EvictingSolver.getNumEndSummaries(),
+              FullSolver.getNumEndSummaries());
+    for (auto F : IRDB.getAllFunctions()) {
+      for (auto &I : llvm::instructions(F)) {
+        EXPECT_EQ(EvictingSolver.resultsAt(&I), FullSolver.resultsAt(&I));
+      }
+    }
+  }
+
+  void compareUninitializedVariables(const std::string &IRFile) {
+    ProjectIRDB IRDB({pathToLLFiles + "uninitialized_variables/" + IRFile});
+    IRDB.preprocessIR();
+    LLVMTypeHierarchy TH(IRDB);
+    LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+    IFDSUninitializedVariables FullProblem(ICFG, TH, IRDB, EntryPoints);
+    UninitSolver FullSolver(FullProblem);
+    FullSolver.solve();
+    IFDSUninitializedVariables EvictingProblem(ICFG, TH, IRDB, EntryPoints);
+    evictEagerly(EvictingProblem.solver_config);
+    UninitSolver EvictingSolver(EvictingProblem);
+    EvictingSolver.solve();
+    EXPECT_GT(EvictingSolver.NumEvictions, 0u);
+    EXPECT_EQ(EvictingSolver.getNumEndSummaries(),
+              FullSolver.getNumEndSummaries());
+    // the flow functions are not re-applied to the restored path edges
+    EXPECT_EQ(EvictingProblem.getAllUndefUses(), FullProblem.getAllUndefUses());
+    for (auto F : IRDB.getAllFunctions()) {
+      for (auto &I : llvm::instructions(F)) {
+        EXPECT_EQ(EvictingSolver.ifdsResultsAt(&I),
+                  FullSolver.ifdsResultsAt(&I));
+      }
+    }
+  }
+}; // Test Fixture
+
+TEST_F(EvictFinishedProceduresTest, ComputesValuesOfEvictedCallee) {
+  // increment() is called twice, hence it is reached again after eviction
+  compareLinearConstants("call_07_cpp_dbg.ll");
+}
+
+TEST_F(EvictFinishedProceduresTest, ComputesValuesOfEvictedRecursion) {
+  compareLinearConstants("call_08_cpp_dbg.ll");
+}
+
+TEST_F(EvictFinishedProceduresTest, KeepsPathEdgesOfEvictedCallee) {
+  compareUninitializedVariables("multiple_calls_cpp_dbg.ll");
+}
+
+TEST_F(EvictFinishedProceduresTest, KeepsPathEdgesOfEvictedNoReturn) {
+  compareUninitializedVariables("callnoret_c_dbg.ll");
+}
+
+TEST_F(EvictFinishedProceduresTest, DelaysEviction) {
+  ProjectIRDB IRDB({pathToLLFiles + "linear_constant/call_07_cpp_dbg.ll"});
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+  IDELinearConstantAnalysis Problem(ICFG, TH, IRDB, EntryPoints);
+  evictEagerly(Problem.solver_config);
+  // no method stays finished for that many path edges in this program
+  Problem.solver_config.evictionDelay = 1000000;
+  LCASolver Solver(Problem);
+  Solver.solve();
+  EXPECT_EQ(Solver.NumEvictions, 0u);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
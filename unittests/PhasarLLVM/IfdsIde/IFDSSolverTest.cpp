@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <llvm/IR/InstIterator.h>
+
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSConstAnalysis.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSUninitializedVariables.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IDESolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
+#include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+
+using namespace std;
+using namespace psr;
+
+using n_t = const llvm::Instruction *;
+using d_t = const llvm::Value *;
+using m_t = const llvm::Function *;
+
+// Solves an IFDS problem by means of its IDE encoding over the BinaryDomain,
+// i.e. with jump functions and edge functions.
+class GenericIFDSSolver
+    : public IDESolver<n_t, d_t, m_t, BinaryDomain, LLVMBasedICFG &> {
+public:
+  GenericIFDSSolver(IFDSTabulationProblem<n_t, d_t, m_t, LLVMBasedICFG &> &P)
+      : IDESolver<n_t, d_t, m_t, BinaryDomain, LLVMBasedICFG &>(P) {}
+
+  std::set<d_t> ifdsResultsAt(n_t stmt) {
+    std::set<d_t> facts;
+    for (auto &factAndValue : resultsAt(stmt)) {
+      facts.insert(factAndValue.first);
+    }
+    return facts;
+  }
+
+  std::size_t getNumEndSummaries() const { return numEndSummaries(); }
+};
+
+// Solves an IFDS problem by tracking reachability only.
+class ReachabilityIFDSSolver
+    : public IFDSSolver<n_t, d_t, m_t, LLVMBasedICFG &> {
+public:
+  using IFDSSolver<n_t, d_t, m_t, LLVMBasedICFG &>::IFDSSolver;
+
+  std::size_t getNumEndSummaries() const { return this->numEndSummaries(); }
+};
+
+/* ============== TEST FIXTURE ============== */
+
+class IFDSSolverTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/";
+  const std::vector<std::string> EntryPoints = {"main"};
+
+  void SetUp() override {
+    bl::core::get()->set_logging_enabled(false);
+    ValueAnnotationPass::resetValueID();
+  }
+
+  // both solvers must reach the same facts at every node and compute the
+  // same end summaries
+  void compareResults(ProjectIRDB &IRDB, ReachabilityIFDSSolver &Solver,
+                      GenericIFDSSolver &Generic) {
+    EXPECT_EQ(Solver.getNumEndSummaries(), Generic.getNumEndSummaries());
+    for (auto F : IRDB.getAllFunctions()) {
+      for (auto &I : llvm::instructions(F)) {
+        EXPECT_EQ(Solver.ifdsResultsAt(&I), Generic.ifdsResultsAt(&I));
+      }
+    }
+  }
+
+  void compareUninitializedVariables(const std::string &IRFile) {
+    ProjectIRDB IRDB({pathToLLFiles + "uninitialized_variables/" + IRFile});
+    IRDB.preprocessIR();
+    LLVMTypeHierarchy TH(IRDB);
+    LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+    IFDSUninitializedVariables Problem(ICFG, TH, IRDB, EntryPoints);
+    ReachabilityIFDSSolver Solver(Problem);
+    Solver.solve();
+    IFDSUninitializedVariables GenericProblem(ICFG, TH, IRDB, EntryPoints);
+    GenericIFDSSolver Generic(GenericProblem);
+    Generic.solve();
+    compareResults(IRDB, Solver, Generic);
+    EXPECT_EQ(Problem.getAllUndefUses(), GenericProblem.getAllUndefUses());
+  }
+
+  void compareConstness(const std::string &IRFile) {
+    ProjectIRDB IRDB({pathToLLFiles + "constness/" + IRFile});
+    IRDB.preprocessIR();
+    LLVMTypeHierarchy TH(IRDB);
+    LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+    IFDSConstAnalysis Problem(ICFG, TH, IRDB, IRDB.getAllMemoryLocations(),
+                              EntryPoints);
+    ReachabilityIFDSSolver Solver(Problem);
+    Solver.solve();
+    IFDSConstAnalysis GenericProblem(
+        ICFG, TH, IRDB, IRDB.getAllMemoryLocations(), EntryPoints);
+    GenericIFDSSolver Generic(GenericProblem);
+    Generic.solve();
+    compareResults(IRDB, Solver, Generic);
+    for (auto MemLoc : IRDB.getAllMemoryLocations()) {
+      EXPECT_EQ(Problem.isInitialized(MemLoc),
+                GenericProblem.isInitialized(MemLoc));
+    }
+  }
+}; // Test Fixture
+
+TEST_F(IFDSSolverTest, HandleUninitializedVariablesCallNoReturn) {
+  compareUninitializedVariables("callnoret_c_dbg.ll");
+}
+
+TEST_F(IFDSSolverTest, HandleUninitializedVariablesMultipleCalls) {
+  compareUninitializedVariables("multiple_calls_cpp_dbg.ll");
+}
+
+TEST_F(IFDSSolverTest, HandleUninitializedVariablesRecursion) {
+  compareUninitializedVariables("recursion_cpp_dbg.ll");
+}
+
+TEST_F(IFDSSolverTest, HandleUninitializedVariablesGrowingExample) {
+  compareUninitializedVariables("growing_example_cpp_dbg.ll");
+}
+
+TEST_F(IFDSSolverTest, HandleConstnessCallParam) {
+  compareConstness("call/param/call_param_03_cpp_m2r_dbg.ll");
+}
+
+TEST_F(IFDSSolverTest, HandleConstnessCallReturn) {
+  compareConstness("call/return/call_ret_02_cpp_m2r_dbg.ll");
+}
+
+TEST_F(IFDSSolverTest, HandleConstnessPointer) {
+  compareConstness("pointer/pointer_03_cpp_dbg.ll");
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdgeWorklist.h>
+#include <string>
+#include <vector>
+
+using namespace psr;
+
+// A single method whose nodes are numbered, given by its successor lists.
+struct TestCFG {
+  std::map<int, std::vector<int>> Succs;
+  std::vector<int> getStartPointsOf(std::string) const { return {0}; }
+  std::vector<int> getSuccsOf(int Node) const {
+    auto Search = Succs.find(Node);
+    return Search != Succs.end() ? Search->second : std::vector<int>();
+  }
+  std::string getMethodOf(int) const { return "main"; }
+};
+
+using TestWorklist = PathEdgeWorklist<int, int, std::string, const TestCFG &>;
+
+// pushes an edge with fact 0 for each of the given targets and returns the
+// targets in the order in which the edges are popped
+static std::vector<int> popOrder(TestWorklist &WL,
+                                 const std::vector<int> &Targets) {
+  for (int Target : Targets) {
+    WL.push(PathEdge<int, int>(0, Target, 0));
+  }
+  EXPECT_EQ(WL.size(), Targets.size());
+  std::vector<int> Order;
+  while (!WL.empty()) {
+    Order.push_back(WL.pop().getTarget());
+  }
+  return Order;
+}
+
+TEST(PathEdgeWorklistTest, HandleFIFO) {
+  TestCFG CFG;
+  TestWorklist WL(CFG, WorklistPolicy::FIFO);
+  EXPECT_TRUE(WL.empty());
+  EXPECT_EQ(popOrder(WL, {3, 1, 2, 0}), std::vector<int>({3, 1, 2, 0}));
+}
+
+TEST(PathEdgeWorklistTest, HandleLIFO) {
+  TestCFG CFG;
+  TestWorklist WL(CFG, WorklistPolicy::LIFO);
+  EXPECT_EQ(popOrder(WL, {3, 1, 2, 0}), std::vector<int>({0, 2, 1, 3}));
+}
+
+TEST(PathEdgeWorklistTest, HandleReversePostOrderOnDiamond) {
+  // 0 branches to 1 and 2, which both lead to 3
+  TestCFG CFG{{{0, {1, 2}}, {1, {3}}, {2, {3}}}};
+  TestWorklist WL(CFG, WorklistPolicy::ReversePostOrder);
+  // the depth-first search visits 1 first, hence 2 precedes it in the
+  // reverse post-order; the join point 3 comes after both branches
+  EXPECT_EQ(popOrder(WL, {3, 1, 2, 0}), std::vector<int>({0, 2, 1, 3}));
+}
+
+TEST(PathEdgeWorklistTest, HandleReversePostOrderOnLoop) {
+  // 0 -> 1 -> 2 -> 3 with the back edge 2 -> 1
+  TestCFG CFG{{{0, {1}}, {1, {2}}, {2, {1, 3}}}};
+  TestWorklist WL(CFG, WorklistPolicy::ReversePostOrder);
+  EXPECT_EQ(popOrder(WL, {3, 2, 1, 0}), std::vector<int>({0, 1, 2, 3}));
+  // edges with the same target are popped in the order they were pushed
+  WL.push(PathEdge<int, int>(0, 2, 7));
+  WL.push(PathEdge<int, int>(0, 1, 5));
+  WL.push(PathEdge<int, int>(0, 2, 8));
+  EXPECT_EQ(WL.pop().factAtTarget(), 5);
+  EXPECT_EQ(WL.pop().factAtTarget(), 7);
+  EXPECT_EQ(WL.pop().factAtTarget(), 8);
+  EXPECT_TRUE(WL.empty());
+}
+
+TEST(PathEdgeWorklistTest, HandleUnreachableNodes) {
+  TestCFG CFG{{{0, {1}}}};
+  TestWorklist WL(CFG, WorklistPolicy::ReversePostOrder);
+  // node 4 cannot be reached from the start point and goes last
+  EXPECT_EQ(popOrder(WL, {4, 1, 0}), std::vector<int>({0, 1, 4}));
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
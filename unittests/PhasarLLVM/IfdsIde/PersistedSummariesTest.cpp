@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <llvm/IR/InstIterator.h>
+
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSTaintAnalysis.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSUninitializedVariables.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSSolver.h>
+#include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+
+using namespace std;
+using namespace psr;
+
+using n_t = const llvm::Instruction *;
+using d_t = const llvm::Value *;
+using m_t = const llvm::Function *;
+
+// Counts the path edges it has processed, which tells whether summaries have
+// been reused.
+class CountingSolver : public IFDSSolver<n_t, d_t, m_t, LLVMBasedICFG &> {
+public:
+  using IFDSSolver<n_t, d_t, m_t, LLVMBasedICFG &>::IFDSSolver;
+
+  std::size_t getNumPathEdges() const { return this->PathEdgeCount; }
+};
+
+// Only the facts of this problem are looked at, hence the uses of undefined
+// values that its flow functions record may be skipped.
+class UninitializedVariablesFacts : public IFDSUninitializedVariables {
+public:
+  using IFDSUninitializedVariables::IFDSUninitializedVariables;
+
+  bool hasFlowFunctionSideEffects() const override { return false; }
+};
+
+/* ============== TEST FIXTURE ============== */
+
+class PersistedSummariesTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/uninitialized_variables/";
+  const std::string pathToTaintLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/taint_analysis/dummy_source_sink/";
+  const std::vector<std::string> EntryPoints = {"main"};
+  std::string SummaryDirectory;
+
+  void SetUp() override {
+    bl::core::get()->set_logging_enabled(false);
+    ValueAnnotationPass::resetValueID();
+    SummaryDirectory =
+        boost::filesystem::unique_path(
+            boost::filesystem::temp_directory_path() / "summaries-%%%%-%%%%")
+            .string();
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove_all(SummaryDirectory);
+  }
+
+  void persistSummaries(
+      IFDSTabulationProblem<n_t, d_t, m_t, LLVMBasedICFG &> &Problem) {
+    Problem.solver_config.computePersistedSummaries = true;
+    Problem.solver_config.summaryDirectory = SummaryDirectory;
+  }
+}; // Test Fixture
+
+TEST_F(PersistedSummariesTest, ReusedRunMatchesFullRun) {
+  ProjectIRDB IRDB({pathToLLFiles + "callnoret_c_dbg.ll"});
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+  UninitializedVariablesFacts FullProblem(ICFG, TH, IRDB, EntryPoints);
+  CountingSolver FullSolver(FullProblem);
+  FullSolver.solve();
+  // the first run stores the summaries that the second one reuses
+  UninitializedVariablesFacts StoringProblem(ICFG, TH, IRDB, EntryPoints);
+  persistSummaries(StoringProblem);
+  CountingSolver StoringSolver(StoringProblem);
+  StoringSolver.solve();
+  EXPECT_EQ(StoringSolver.getNumPathEdges(), FullSolver.getNumPathEdges());
+  UninitializedVariablesFacts ReusingProblem(ICFG, TH, IRDB, EntryPoints);
+  persistSummaries(ReusingProblem);
+  CountingSolver ReusingSolver(ReusingProblem);
+  ReusingSolver.solve();
+  EXPECT_LT(ReusingSolver.getNumPathEdges(), FullSolver.getNumPathEdges());
+  for (auto F : IRDB.getAllFunctions()) {
+    for (auto &I : llvm::instructions(F)) {
+      EXPECT_EQ(ReusingSolver.ifdsResultsAt(&I), FullSolver.ifdsResultsAt(&I));
+    }
+  }
+}
+
+TEST_F(PersistedSummariesTest, KeepsSideEffectsOfFlowFunctions) {
+  ProjectIRDB IRDB({pathToLLFiles + "callnoret_c_dbg.ll"});
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+  IFDSUninitializedVariables FullProblem(ICFG, TH, IRDB, EntryPoints);
+  CountingSolver FullSolver(FullProblem);
+  FullSolver.solve();
+  ASSERT_FALSE(FullProblem.getAllUndefUses().empty());
+  IFDSUninitializedVariables StoringProblem(ICFG, TH, IRDB, EntryPoints);
+  persistSummaries(StoringProblem);
+  CountingSolver(StoringProblem).solve();
+  // the summaries are not reused, as that would skip the flow functions
+  // that record the uses of undefined values
+  IFDSUninitializedVariables ReusingProblem(ICFG, TH, IRDB, EntryPoints);
+  persistSummaries(ReusingProblem);
+  CountingSolver ReusingSolver(ReusingProblem);
+  ReusingSolver.solve();
+  EXPECT_EQ(ReusingSolver.getNumPathEdges(), FullSolver.getNumPathEdges());
+  EXPECT_EQ(ReusingProblem.getAllUndefUses(), FullProblem.getAllUndefUses());
+}
+
+TEST_F(PersistedSummariesTest, KeepsTaintLeaksInCallees) {
+  // the leak is reported within leak(), whose summary is stored by the first
+  // run and found in the store by the second one
+  ProjectIRDB IRDB({pathToTaintLLFiles + "taint_07_cpp_dbg.ll"});
+  IRDB.preprocessIR();
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICFG(TH, IRDB, CallGraphAnalysisType::OTF, EntryPoints);
+  TaintConfiguration<const llvm::Value *> TSF(
+      {TaintConfiguration<const llvm::Value *>::SourceFunction("source()",
+                                                               true)},
+      {TaintConfiguration<const llvm::Value *>::SinkFunction(
+          "sink(int)", std::vector<unsigned>({0}))});
+  IFDSTaintAnalysis FullProblem(ICFG, TH, IRDB, TSF, EntryPoints);
+  CountingSolver FullSolver(FullProblem);
+  FullSolver.solve();
+  ASSERT_FALSE(FullProblem.Leaks.empty());
+  IFDSTaintAnalysis StoringProblem(ICFG, TH, IRDB, TSF, EntryPoints);
+  persistSummaries(StoringProblem);
+  CountingSolver(StoringProblem).solve();
+  EXPECT_EQ(StoringProblem.Leaks, FullProblem.Leaks);
+  IFDSTaintAnalysis ReusingProblem(ICFG, TH, IRDB, TSF, EntryPoints);
+  persistSummaries(ReusingProblem);
+  CountingSolver ReusingSolver(ReusingProblem);
+  ReusingSolver.solve();
+  EXPECT_EQ(ReusingSolver.getNumPathEdges(), FullSolver.getNumPathEdges());
+  EXPECT_EQ(ReusingProblem.Leaks, FullProblem.Leaks);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,3 +1,6 @@
+#include <cstdio>
+#include <fstream>
+
 #include <gtest/gtest.h>
 #include <phasar/DB/ProjectIRDB.h>
 #include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
@@ -5,6 +8,7 @@
 #include <phasar/PhasarLLVM/IfdsIde/Solver/LLVMIDESolver.h>
 #include <phasar/PhasarLLVM/Passes/ValueAnnotationPass.h>
 #include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+#include <phasar/Utils/JsonStreamWriter.h>
 
 using namespace psr;
 
@@ -261,6 +265,40 @@ TEST_F(IDELinearConstantAnalysisTest, HandleCallTest_05) {
   compareResults(gt, llvmlcasolver);
 }
 
+/* ============== PARALLEL SOLVER TESTS ============== */
+TEST_F(IDELinearConstantAnalysisTest, HandleParallelCallTest_02) {
+  Initialize({pathToLLFiles + "call_02_cpp_dbg.ll"});
+  LCAProblem->solver_config.numThreads = 4;
+  LLVMIDESolver<const llvm::Value *, int64_t, LLVMBasedICFG &> llvmlcasolver(
+      *LCAProblem, true, true);
+  llvmlcasolver.solve();
+  const std::map<std::string, int64_t> gt = {
+      {"0", 2},  {"3", 2},   {"4", 42},       {"6", 0},
+      {"7", 42}, {"10", 42}, {"_Z3fooi.0", 2}};
+  compareResults(gt, llvmlcasolver);
+}
+
+/* ============== RESULT EXPORT TESTS ============== */
+TEST_F(IDELinearConstantAnalysisTest, HandleStreamedResults) {
+  Initialize({pathToLLFiles + "call_05_cpp_dbg.ll"});
+  LLVMIDESolver<const llvm::Value *, int64_t, LLVMBasedICFG &> llvmlcasolver(
+      *LCAProblem, false, false);
+  llvmlcasolver.solve();
+  std::string Path = "lca_streamed_results.json";
+  {
+    JsonStreamWriter Writer(Path);
+    llvmlcasolver.writeJson(Writer);
+    Writer.close();
+  }
+  std::ifstream ifs(Path);
+  auto Streamed = nlohmann::json::parse(ifs);
+  ifs.close();
+  std::remove(Path.c_str());
+  // a duplicate key would lose facts when parsing, a different order of the
+  // facts would be kept
+  EXPECT_EQ(Streamed, llvmlcasolver.getAsJson());
+}
+
 // main function for the test case
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
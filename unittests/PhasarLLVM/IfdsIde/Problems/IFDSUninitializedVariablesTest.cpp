@@ -398,6 +398,23 @@ TEST_F(IFDSUninitializedVariablesTest, UninitTest_21_SHOULD_LEAK) {
   // 37 => {17}; actual leak
   compareResults(GroundTruth);
 }
+TEST_F(IFDSUninitializedVariablesTest, UninitTest_20_SPARSE) {
+
+  Initialize({pathToLLFiles + "recursion_cpp_dbg.ll"});
+  UninitProblem->solver_config.sparsePropagation = true;
+  LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> Solver(*UninitProblem,
+                                                              false, false);
+  Solver.solve();
+
+  // sparse propagation must find the same uses as UninitTest_20
+  map<int, set<string>> GroundTruth;
+  GroundTruth[11] = {"2"};
+  GroundTruth[14] = {"2"};
+  GroundTruth[31] = {"24"};
+  GroundTruth[20] = {"1"};
+  GroundTruth[29] = {"28"};
+  compareResults(GroundTruth);
+}
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
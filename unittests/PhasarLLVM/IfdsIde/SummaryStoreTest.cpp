@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+
+#include <phasar/PhasarLLVM/IfdsIde/SummaryStore.h>
+
+using namespace std;
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+
+class SummaryStoreTest : public ::testing::Test {
+protected:
+  std::string SummaryDirectory;
+
+  void SetUp() override {
+    SummaryDirectory =
+        boost::filesystem::unique_path(
+            boost::filesystem::temp_directory_path() / "summaries-%%%%-%%%%")
+            .string();
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove_all(SummaryDirectory);
+  }
+}; // Test Fixture
+
+TEST_F(SummaryStoreTest, MergesSummariesStoredByOtherProcesses) {
+  SummaryStore Store(SummaryDirectory);
+  const unsigned NumProcesses = 4;
+  const unsigned NumStoresPerProcess = 25;
+  for (unsigned Process = 0; Process < NumProcesses; ++Process) {
+    pid_t Pid = fork();
+    ASSERT_GE(Pid, 0);
+    if (Pid == 0) {
+      // each store adds a fact of its own, all of which have to survive
+      for (unsigned Idx = 0; Idx < NumStoresPerProcess; ++Idx) {
+        IDESummary S("foo", 42);
+        S.SourceFacts.insert(to_string(Process) + "." + to_string(Idx));
+        Store.store(S);
+      }
+      _exit(0);
+    }
+  }
+  for (unsigned Process = 0; Process < NumProcesses; ++Process) {
+    int Status;
+    ASSERT_GT(wait(&Status), 0);
+    EXPECT_TRUE(WIFEXITED(Status) && WEXITSTATUS(Status) == 0);
+  }
+  auto Stored = Store.load("foo", 42);
+  ASSERT_TRUE(Stored);
+  EXPECT_EQ(Stored->SourceFacts.size(), NumProcesses * NumStoresPerProcess);
+  EXPECT_FALSE(Store.load("foo", 43));
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <ios>
+#include <string>
+
+#include <phasar/Utils/ColumnarTable.h>
+#include <phasar/Utils/IO.h>
+#include <phasar/Utils/Table.h>
+
+using namespace psr;
+
+TEST(ColumnarTableTest, HandleLookup) {
+  Table<int, int, std::int64_t> T;
+  T.insert(3, 7, 37);
+  T.insert(1, 2, 12);
+  T.insert(1, 9, 19);
+  T.insert(3, 2, 32);
+  ColumnarTable<int, int, std::int64_t> CT(T);
+  EXPECT_EQ(CT.size(), 4u);
+  EXPECT_EQ(CT.numRows(), 2u);
+  EXPECT_EQ(CT.get(1, 9), 19);
+  EXPECT_EQ(CT.get(3, 2), 32);
+  EXPECT_FALSE(CT.contains(1, 7));
+  EXPECT_FALSE(CT.contains(2, 2));
+  EXPECT_EQ(CT.get(1, 7), 0);
+  EXPECT_EQ(CT.row(3), T.row(3));
+  EXPECT_TRUE(CT.row(2).empty());
+  // cells are visited sorted by row and column
+  std::string Visited;
+  CT.forEach([&](int, int, std::int64_t V) {
+    Visited += std::to_string(V) + " ";
+  });
+  EXPECT_EQ(Visited, "12 19 32 37 ");
+}
+
+TEST(ColumnarTableTest, HandleSaveAndLoad) {
+  Table<int, std::string, std::int64_t> T;
+  for (int R = 0; R < 100; ++R) {
+    for (int C = R % 3; C < 10; C += 3) {
+      T.insert(R, "c" + std::to_string(C), R * C);
+    }
+  }
+  std::string Path = "columnar_table_test.bin";
+  ColumnarTable<int, std::string, std::int64_t>(T).save(
+      Path, [](int R) { return std::to_string(R); },
+      [](std::string C) { return C; });
+  auto Loaded = ColumnarTable<int, std::string, std::int64_t>::load(
+      Path, [](const std::string &R) { return std::stoi(R); },
+      [](const std::string &C) { return C; });
+  EXPECT_EQ(Loaded.size(), T.cellVec().size());
+  for (auto &Cell : T.cellVec()) {
+    EXPECT_EQ(Loaded.get(Cell.r, Cell.c), Cell.v);
+  }
+  EXPECT_FALSE(Loaded.contains(5, "c0"));
+  EXPECT_EQ(Loaded.row(4), T.row(4));
+  // files that have not been saved by a ColumnarTable are rejected
+  writeFile(Path, "not a result file");
+  EXPECT_THROW((ColumnarTable<int, std::string, std::int64_t>::load(
+                   Path, [](const std::string &R) { return std::stoi(R); },
+                   [](const std::string &C) { return C; })),
+               std::ios_base::failure);
+  std::remove(Path.c_str());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
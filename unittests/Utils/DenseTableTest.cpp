@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include <phasar/Utils/ColumnarTable.h>
+#include <phasar/Utils/DenseTable.h>
+#include <phasar/Utils/Table.h>
+
+using namespace psr;
+
+// Every allocation of this test is counted, such that the memory held by a
+// table can be measured. The size of an allocation is kept in front of it.
+static std::atomic<std::size_t> LiveBytes{0};
+static std::atomic<std::size_t> LiveAllocations{0};
+
+void *operator new(std::size_t Size) {
+  auto *Header = static_cast<std::max_align_t *>(
+      std::malloc(Size + sizeof(std::max_align_t)));
+  if (!Header) {
+    throw std::bad_alloc();
+  }
+  *reinterpret_cast<std::size_t *>(Header) = Size;
+  LiveBytes += Size;
+  ++LiveAllocations;
+  return Header + 1;
+}
+
+void operator delete(void *Ptr) noexcept {
+  if (Ptr) {
+    auto *Header = static_cast<std::max_align_t *>(Ptr) - 1;
+    LiveBytes -= *reinterpret_cast<std::size_t *>(Header);
+    --LiveAllocations;
+    std::free(Header);
+  }
+}
+
+void operator delete(void *Ptr, std::size_t) noexcept { operator delete(Ptr); }
+
+void *operator new[](std::size_t Size) { return operator new(Size); }
+
+void operator delete[](void *Ptr) noexcept { operator delete(Ptr); }
+
+void operator delete[](void *Ptr, std::size_t) noexcept {
+  operator delete(Ptr);
+}
+
+TEST(DenseTableTest, HandleLookup) {
+  Interner<std::string> Rows;
+  Interner<int> Columns;
+  DenseTable<std::string, int, int> T(Rows, Columns);
+  EXPECT_TRUE(T.empty());
+  EXPECT_EQ(T.find("foo", 1), nullptr);
+  EXPECT_FALSE(T.containsRow("foo"));
+  T.insert("foo", 1, 11);
+  T.insert("foo", 2, 12);
+  T.insert("bar", 1, 21);
+  EXPECT_EQ(T.size(), 3u);
+  EXPECT_EQ(T.get("foo", 2), 12);
+  EXPECT_TRUE(T.contains("bar", 1));
+  EXPECT_FALSE(T.contains("bar", 2));
+  // get() inserts, find() does not
+  EXPECT_EQ(T.get("bar", 3), 0);
+  EXPECT_TRUE(T.contains("bar", 3));
+  EXPECT_EQ(T.find("baz", 1), nullptr);
+  EXPECT_FALSE(Rows.find("baz").has_value());
+  EXPECT_EQ(T.row("foo"), (std::unordered_map<int, int>{{1, 11}, {2, 12}}));
+  EXPECT_TRUE(T.row("baz").empty());
+}
+
+TEST(DenseTableTest, HandleRemoval) {
+  Interner<int> Ids;
+  DenseTable<int, int, int> T(Ids, Ids);
+  for (int Row = 0; Row < 4; ++Row) {
+    for (int Column = 0; Column < 4; ++Column) {
+      T.insert(Row, Column, Row * 10 + Column);
+    }
+  }
+  EXPECT_TRUE(T.remove(2, 3));
+  EXPECT_FALSE(T.remove(2, 3));
+  EXPECT_FALSE(T.remove(7, 3));
+  T.remove(1);
+  EXPECT_FALSE(T.containsRow(1));
+  EXPECT_EQ(T.size(), 11u);
+  // the row stays allocated and can be filled again
+  T.insert(1, 0, 100);
+  EXPECT_EQ(T.get(1, 0), 100);
+  T.clear();
+  EXPECT_TRUE(T.empty());
+  EXPECT_FALSE(T.contains(0, 0));
+}
+
+TEST(DenseTableTest, HandleIteration) {
+  Interner<int> Rows, Columns;
+  DenseTable<int, int, int> T(Rows, Columns);
+  Table<int, int, int> Expected;
+  for (int Row = 5; Row > 0; --Row) {
+    for (int Column = 0; Column < Row; ++Column) {
+      T.insert(Row, Column, Row * 10 + Column);
+      Expected.insert(Row, Column, Row * 10 + Column);
+    }
+  }
+  T.remove(3);
+  Expected.remove(3, 0);
+  Expected.remove(3, 1);
+  Expected.remove(3, 2);
+  std::size_t NumCells = 0;
+  T.forEachCell([&](int Row, int Column, int Value) {
+    EXPECT_EQ(Expected.get(Row, Column), Value);
+    ++NumCells;
+  });
+  EXPECT_EQ(NumCells, Expected.cellSet().size());
+  // rows are visited in the order of their IDs, empty rows are skipped
+  std::string Visited;
+  T.forEachRow([&](int Row, const DenseTable<int, int, int>::RowType &Cells) {
+    Visited += std::to_string(Row) + ":" + std::to_string(Cells.size()) + " ";
+  });
+  EXPECT_EQ(Visited, "5:5 4:4 2:2 1:1 ");
+  ColumnarTable<int, int, int> Compact(T);
+  EXPECT_EQ(Compact.size(), NumCells);
+  EXPECT_EQ(Compact.numRows(), 4u);
+  EXPECT_EQ(Compact.row(4), T.row(4));
+  EXPECT_FALSE(Compact.contains(3, 0));
+}
+
+TEST(DenseTableTest, HandleMemoryFootprint) {
+  // the shape of a value table: every node holds a few facts out of a small
+  // set of facts that is shared by many nodes
+  constexpr int NumNodes = 4000;
+  constexpr int NumFacts = 64;
+  constexpr int FactsPerNode = 8;
+  static char Nodes[NumNodes];
+  static char Facts[NumFacts];
+  std::size_t TableBytes, TableAllocations;
+  {
+    std::size_t BytesBefore = LiveBytes, AllocationsBefore = LiveAllocations;
+    Table<const void *, const void *, std::int64_t> T;
+    for (int Node = 0; Node < NumNodes; ++Node) {
+      for (int Fact = 0; Fact < FactsPerNode; ++Fact) {
+        T.insert(&Nodes[Node], &Facts[(Node + 7 * Fact) % NumFacts], Node);
+      }
+    }
+    TableBytes = LiveBytes - BytesBefore;
+    TableAllocations = LiveAllocations - AllocationsBefore;
+  }
+  std::size_t DenseBytes, DenseAllocations;
+  {
+    std::size_t BytesBefore = LiveBytes, AllocationsBefore = LiveAllocations;
+    // the interners are part of the footprint
+    Interner<const void *> NodeIds, FactIds;
+    DenseTable<const void *, const void *, std::int64_t> T(NodeIds, FactIds);
+    for (int Node = 0; Node < NumNodes; ++Node) {
+      for (int Fact = 0; Fact < FactsPerNode; ++Fact) {
+        T.insert(&Nodes[Node], &Facts[(Node + 7 * Fact) % NumFacts], Node);
+      }
+    }
+    EXPECT_EQ(T.size(), std::size_t(NumNodes * FactsPerNode));
+    DenseBytes = LiveBytes - BytesBefore;
+    DenseAllocations = LiveAllocations - AllocationsBefore;
+  }
+  std::cout << "Table: " << TableBytes << " bytes in " << TableAllocations
+            << " allocations, DenseTable: " << DenseBytes << " bytes in "
+            << DenseAllocations << " allocations\n";
+  EXPECT_LT(2 * DenseBytes, TableBytes);
+  EXPECT_LT(4 * DenseAllocations, TableAllocations);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
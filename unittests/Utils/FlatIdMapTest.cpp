@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <set>
+
+#include <phasar/Utils/FlatIdMap.h>
+
+using namespace psr;
+
+TEST(FlatIdMapTest, HandleInsertFindErase) {
+  FlatIdMap<std::uint32_t, int> M;
+  EXPECT_TRUE(M.empty());
+  EXPECT_EQ(M.find(3), nullptr);
+  EXPECT_FALSE(M.erase(3));
+  auto Slot = M.tryEmplace(3);
+  EXPECT_TRUE(Slot.second);
+  EXPECT_EQ(*Slot.first, 0);
+  *Slot.first = 30;
+  EXPECT_FALSE(M.tryEmplace(3).second);
+  M[7] = 70;
+  EXPECT_EQ(M.size(), 2u);
+  ASSERT_NE(M.find(3), nullptr);
+  EXPECT_EQ(*M.find(3), 30);
+  EXPECT_TRUE(M.erase(3));
+  EXPECT_FALSE(M.contains(3));
+  EXPECT_EQ(M[7], 70);
+  M.clear();
+  EXPECT_TRUE(M.empty());
+  EXPECT_EQ(M.find(7), nullptr);
+}
+
+TEST(FlatIdMapTest, HandleGrowthAndErasure) {
+  // small maps are filled completely before they grow, hence erasing must
+  // work without an empty slot to stop at
+  FlatIdMap<std::uint32_t, std::uint32_t> M;
+  std::map<std::uint32_t, std::uint32_t> Expected;
+  for (std::uint32_t Round = 0; Round < 64; ++Round) {
+    for (std::uint32_t Key = 0; Key < Round % 20; ++Key) {
+      M[Key * 8 + Round % 3] = Round;
+      Expected[Key * 8 + Round % 3] = Round;
+    }
+    for (std::uint32_t Key = Round % 5; Key < 160; Key += 3) {
+      EXPECT_EQ(M.erase(Key), Expected.erase(Key) == 1);
+    }
+    ASSERT_EQ(M.size(), Expected.size());
+    for (auto &KeyAndValue : Expected) {
+      ASSERT_NE(M.find(KeyAndValue.first), nullptr);
+      EXPECT_EQ(*M.find(KeyAndValue.first), KeyAndValue.second);
+    }
+    std::size_t NumVisited = 0;
+    for (auto &KeyAndValue : M) {
+      EXPECT_EQ(Expected[KeyAndValue.first], KeyAndValue.second);
+      ++NumVisited;
+    }
+    EXPECT_EQ(NumVisited, Expected.size());
+  }
+}
+
+TEST(FlatIdMapTest, HandleCopies) {
+  FlatIdMap<std::uint32_t, int> M;
+  for (std::uint32_t Key = 0; Key < 20; ++Key) {
+    M[Key] = Key;
+  }
+  FlatIdMap<std::uint32_t, int> Copy(M);
+  M.erase(4);
+  EXPECT_EQ(Copy.size(), 20u);
+  EXPECT_TRUE(Copy.contains(4));
+  FlatIdMap<std::uint32_t, int> Moved(std::move(Copy));
+  EXPECT_EQ(Moved.size(), 20u);
+  EXPECT_TRUE(Copy.empty());
+  Copy = Moved;
+  EXPECT_EQ(*Copy.find(19), 19);
+}
+
+TEST(FlatIdMapTest, HandleCombinedIds) {
+  FlatIdSet<std::uint64_t> S;
+  std::set<std::uint64_t> Expected;
+  for (std::uint32_t First = 0; First < 10; ++First) {
+    for (std::uint32_t Second = 0; Second < First; ++Second) {
+      EXPECT_TRUE(S.insert(combineIds(First, Second)));
+      Expected.insert(combineIds(First, Second));
+    }
+  }
+  EXPECT_FALSE(S.insert(combineIds(9, 8)));
+  EXPECT_EQ(S.size(), Expected.size());
+  EXPECT_EQ(S.count(combineIds(8, 9)), 0u);
+  std::set<std::uint64_t> Visited(S.begin(), S.end());
+  EXPECT_EQ(Visited, Expected);
+  EXPECT_EQ(firstIdOf(combineIds(5, 3)), 5u);
+  EXPECT_EQ(secondIdOf(combineIds(5, 3)), 3u);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
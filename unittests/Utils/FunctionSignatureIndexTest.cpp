@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <llvm/IR/Instructions.h>
+#include <phasar/Config/Configuration.h>
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/Utils/FunctionSignatureIndex.h>
+#include <phasar/Utils/LLVMShorthands.h>
+#include <set>
+
+using namespace std;
+using namespace psr;
+
+class FunctionSignatureIndexTest : public ::testing::Test {
+protected:
+  const std::string pathToLLFiles =
+      PhasarConfig::getPhasarConfig().PhasarDirectory() +
+      "build/test/llvm_test_code/";
+};
+
+TEST_F(FunctionSignatureIndexTest, HandlesIndirectCall) {
+  ProjectIRDB IRDB({pathToLLFiles + "call_graphs/function_pointer_1_c.ll"});
+  auto F = IRDB.getFunction("main");
+  auto Bar = IRDB.getFunction("bar");
+  ASSERT_TRUE(F);
+  ASSERT_TRUE(Bar);
+  const llvm::FunctionType *FType = nullptr;
+  for (auto &BB : *F) {
+    for (auto &I : BB) {
+      if (auto Call = llvm::dyn_cast<llvm::CallInst>(&I)) {
+        if (!Call->getCalledFunction()) {
+          FType = Call->getFunctionType();
+        }
+      }
+    }
+  }
+  ASSERT_TRUE(FType);
+  set<const llvm::Function *> Expected;
+  for (auto G : IRDB.getAllFunctions()) {
+    if (matchesSignature(G, FType)) {
+      Expected.insert(G);
+    }
+  }
+  auto Candidates = IRDB.getFunctionSignatureIndex().getCandidates(FType);
+  EXPECT_EQ(set<const llvm::Function *>(Candidates.begin(), Candidates.end()),
+            Expected);
+  EXPECT_TRUE(Expected.count(Bar));
+  // only bar has its address taken
+  auto AddressTaken =
+      IRDB.getFunctionSignatureIndex(true).getCandidates(FType);
+  ASSERT_EQ(AddressTaken.size(), 1);
+  EXPECT_EQ(AddressTaken[0], Bar);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <phasar/Utils/Interner.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace psr;
+
+TEST(InternerTest, HandleDenseIds) {
+  Interner<std::string> Strings;
+  EXPECT_EQ(Strings.getOrInsert("foo"), 0u);
+  EXPECT_EQ(Strings.getOrInsert("bar"), 1u);
+  EXPECT_EQ(Strings.getOrInsert("foo"), 0u);
+  EXPECT_EQ(Strings.size(), 2u);
+  EXPECT_EQ(Strings.get(1), "bar");
+  EXPECT_EQ(Strings.find("bar"), 1u);
+  EXPECT_FALSE(Strings.find("baz").has_value());
+  Strings.clear();
+  EXPECT_TRUE(Strings.empty());
+  EXPECT_EQ(Strings.getOrInsert("baz"), 0u);
+}
+
+TEST(InternerTest, HandleManyValues) {
+  Interner<int> Ints;
+  std::vector<const int *> Addresses;
+  for (int Value = 0; Value < 100000; ++Value) {
+    EXPECT_EQ(Ints.getOrInsert(3 * Value), unsigned(Value));
+    Addresses.push_back(&Ints.get(Value));
+  }
+  // values are never moved
+  for (int Value = 0; Value < 100000; ++Value) {
+    EXPECT_EQ(&Ints.get(Value), Addresses[Value]);
+    EXPECT_EQ(*Addresses[Value], 3 * Value);
+    EXPECT_EQ(Ints.find(3 * Value), unsigned(Value));
+  }
+  EXPECT_FALSE(Ints.find(1).has_value());
+}
+
+TEST(InternerTest, HandleConcurrentInsertion) {
+  Interner<int> Ints(/*Synchronized=*/true);
+  std::vector<std::thread> Threads;
+  for (int Thread = 0; Thread < 4; ++Thread) {
+    Threads.emplace_back([&Ints, Thread] {
+      for (int Value = 0; Value < 10000; ++Value) {
+        auto Id = Ints.getOrInsert((Value + 2500 * Thread) % 10000);
+        EXPECT_EQ(Ints.get(Id), (Value + 2500 * Thread) % 10000);
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+  EXPECT_EQ(Ints.size(), 10000u);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
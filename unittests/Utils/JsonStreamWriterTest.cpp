@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+#include <json.hpp>
+
+#include <phasar/Utils/IO.h>
+#include <phasar/Utils/JsonStreamWriter.h>
+
+using namespace psr;
+using json = nlohmann::json;
+
+TEST(JsonStreamWriterTest, HandleNestedScopes) {
+  std::string Path = "json_stream_writer_test.json";
+  {
+    JsonStreamWriter Writer(Path);
+    Writer.beginArray();
+    Writer.beginObject();
+    Writer.key("DataFlow");
+    Writer.beginObject();
+    Writer.key("main::x");
+    Writer.beginObject();
+    Writer.key("Facts");
+    Writer.beginArray();
+    Writer.value({"a", "1"});
+    Writer.value({"b \"quoted\"", "2"});
+    Writer.endArray();
+    Writer.endObject();
+    Writer.endObject();
+    Writer.endObject();
+    Writer.beginObject();
+    Writer.endObject();
+    Writer.value("EMPTY");
+    // the array that is still open is closed as well
+    Writer.close();
+  }
+  json Expected;
+  Expected[0]["DataFlow"]["main::x"]["Facts"] += {"a", "1"};
+  Expected[0]["DataFlow"]["main::x"]["Facts"] += {"b \"quoted\"", "2"};
+  Expected[1] = json::object();
+  Expected[2] = "EMPTY";
+  EXPECT_EQ(json::parse(readFile(Path)), Expected);
+  std::remove(Path.c_str());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
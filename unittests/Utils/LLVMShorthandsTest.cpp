@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <llvm/AsmParser/Parser.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/Support/SourceMgr.h>
 #include <phasar/DB/ProjectIRDB.h>
 #include <phasar/Utils/LLVMShorthands.h>
 #include <phasar/Utils/Macros.h>
@@ -112,6 +115,87 @@ TEST_F(LLVMGetterTest, HandleFunctionsContainingCodesInName) {
             SpecialMemberFunctionTy::NONE);
 }
 
+TEST_F(LLVMGetterTest, HandlesFunctionHash) {
+  // the IDs annotated to the second module differ between both databases
+  ProjectIRDB IRDB1({pathToLLFiles + "control_flow/if_else_cpp.ll"});
+  ProjectIRDB IRDB2({pathToLLFiles + "control_flow/global_stmt_cpp.ll",
+                     pathToLLFiles + "control_flow/if_else_cpp.ll"});
+  auto F1 = IRDB1.getModule(pathToLLFiles + "control_flow/if_else_cpp.ll")
+                ->getFunction("main");
+  auto F2 = IRDB2.getModule(pathToLLFiles + "control_flow/if_else_cpp.ll")
+                ->getFunction("main");
+  auto G = IRDB2.getModule(pathToLLFiles + "control_flow/global_stmt_cpp.ll")
+               ->getFunction("main");
+  ASSERT_EQ(computeFunctionHash(F1), computeFunctionHash(F2));
+  ASSERT_NE(computeFunctionHash(F1), computeFunctionHash(G));
+}
+
+TEST_F(LLVMGetterTest, HandlesFunctionHashOfFlagsAndAttributes) {
+  // pairs of functions that only differ in a flag, an attribute or the
+  // order of the incoming blocks of a PHI node
+  const char *IR = R"(
+define i32 @add(i32 %a, i32 %b) {
+  %r = add i32 %a, %b
+  ret i32 %r
+}
+define i32 @add_renamed(i32 %x, i32 %y) {
+  %s = add i32 %x, %y
+  ret i32 %s
+}
+define i32 @add_nsw(i32 %a, i32 %b) {
+  %r = add nsw i32 %a, %b
+  ret i32 %r
+}
+define i32 @add_readnone(i32 %a, i32 %b) readnone {
+  %r = add i32 %a, %b
+  ret i32 %r
+}
+define i32 @load(i32* %p) {
+  %v = load i32, i32* %p
+  ret i32 %v
+}
+define i32 @load_volatile(i32* %p) {
+  %v = load volatile i32, i32* %p
+  ret i32 %v
+}
+define i32 @phi(i1 %c) {
+entry:
+  br i1 %c, label %l, label %r
+l:
+  br label %join
+r:
+  br label %join
+join:
+  %v = phi i32 [ 1, %l ], [ 2, %r ]
+  ret i32 %v
+}
+define i32 @phi_swapped(i1 %c) {
+entry:
+  br i1 %c, label %l, label %r
+l:
+  br label %join
+r:
+  br label %join
+join:
+  %v = phi i32 [ 1, %r ], [ 2, %l ]
+  ret i32 %v
+}
+)";
+  llvm::LLVMContext Context;
+  llvm::SMDiagnostic Diag;
+  auto M = llvm::parseAssemblyString(IR, Diag, Context);
+  ASSERT_TRUE(M);
+  auto Hash = [&](const char *Name) {
+    return computeFunctionHash(M->getFunction(Name));
+  };
+  // value names do not matter
+  EXPECT_EQ(Hash("add"), Hash("add_renamed"));
+  EXPECT_NE(Hash("add"), Hash("add_nsw"));
+  EXPECT_NE(Hash("add"), Hash("add_readnone"));
+  EXPECT_NE(Hash("load"), Hash("load_volatile"));
+  EXPECT_NE(Hash("phi"), Hash("phi_swapped"));
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <phasar/Utils/HashedTuple.h>
+#include <phasar/Utils/LRUCache.h>
+#include <algorithm>
+#include <list>
+#include <string>
+
+using namespace psr;
+
+TEST(LRUCacheTest, HandleUnboundedCache) {
+  LRUCache<HashedTuple<int, std::string>, int> Cache;
+  EXPECT_FALSE(Cache.isBounded());
+  EXPECT_EQ(Cache.find(HashedTuple<int, std::string>(1, "foo")), nullptr);
+  Cache.insert(HashedTuple<int, std::string>(1, "foo"), 42);
+  Cache.insert(HashedTuple<int, std::string>(1, "bar"), 13);
+  // the first value cached for a key is kept
+  EXPECT_EQ(Cache.insert(HashedTuple<int, std::string>(1, "foo"), 0), 42);
+  EXPECT_EQ(*Cache.find(HashedTuple<int, std::string>(1, "foo")), 42);
+  EXPECT_EQ(*Cache.lookup(HashedTuple<int, std::string>(1, "bar")), 13);
+  EXPECT_EQ(Cache.size(), 2u);
+}
+
+TEST(LRUCacheTest, HandleEviction) {
+  LRUCache<int, int> Cache(2);
+  Cache.insert(1, 10);
+  Cache.insert(2, 20);
+  // marks 1 as used, hence 2 is the least recently used entry
+  EXPECT_EQ(*Cache.lookup(1), 10);
+  Cache.insert(3, 30);
+  EXPECT_EQ(Cache.size(), 2u);
+  EXPECT_EQ(Cache.find(2), nullptr);
+  EXPECT_EQ(*Cache.find(1), 10);
+  EXPECT_EQ(*Cache.find(3), 30);
+  // find() does not mark 1 as used
+  Cache.insert(4, 40);
+  EXPECT_EQ(Cache.find(1), nullptr);
+  EXPECT_EQ(Cache.getNumEvictions(), 2u);
+}
+
+TEST(LRUCacheTest, HandleManyEvictions) {
+  // a small capacity with colliding keys, such that evictions shift entries
+  // of long probe sequences, compared against a list in the order of use
+  LRUCache<int, int> Cache(13);
+  std::list<int> Uses;
+  for (int Round = 0; Round < 2000; ++Round) {
+    int Key = (Round * 7919) % 37 * 16;
+    if (Round % 3 == 0) {
+      int *Value = Cache.lookup(Key);
+      bool Cached = std::find(Uses.begin(), Uses.end(), Key) != Uses.end();
+      ASSERT_EQ(Value != nullptr, Cached);
+      if (Cached) {
+        EXPECT_EQ(*Value, Key + 1);
+        Uses.remove(Key);
+        Uses.push_front(Key);
+      }
+      continue;
+    }
+    EXPECT_EQ(Cache.insert(Key, Key + 1), Key + 1);
+    if (std::find(Uses.begin(), Uses.end(), Key) != Uses.end()) {
+      Uses.remove(Key);
+    } else if (Uses.size() == Cache.capacity()) {
+      Uses.pop_back();
+    }
+    Uses.push_front(Key);
+    ASSERT_EQ(Cache.size(), Uses.size());
+    for (int Cached : Uses) {
+      ASSERT_NE(Cache.find(Cached), nullptr);
+    }
+  }
+  EXPECT_GT(Cache.getNumEvictions(), 0u);
+  Cache.clear();
+  EXPECT_EQ(Cache.size(), 0u);
+  EXPECT_EQ(Cache.find(0), nullptr);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,65 @@
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <ios>
+#include <phasar/Utils/ProgressStream.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace psr;
+
+TEST(ProgressStreamTest, HandleFile) {
+  std::string Path = "progress_stream_test.jsonl";
+  std::remove(Path.c_str());
+  {
+    ProgressStream Stream(Path);
+    EXPECT_TRUE(Stream.writeLine("{\"a\":1}"));
+  }
+  {
+    // lines are appended
+    ProgressStream Stream(Path);
+    EXPECT_TRUE(Stream.writeLine("{\"a\":2}"));
+  }
+  std::ifstream In(Path);
+  std::string First, Second;
+  std::getline(In, First);
+  std::getline(In, Second);
+  EXPECT_EQ(First, "{\"a\":1}");
+  EXPECT_EQ(Second, "{\"a\":2}");
+  std::remove(Path.c_str());
+}
+
+TEST(ProgressStreamTest, HandleSocket) {
+  std::string Path = "progress_stream_test.sock";
+  unlink(Path.c_str());
+  int Listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  sockaddr_un Address{};
+  Address.sun_family = AF_UNIX;
+  Path.copy(Address.sun_path, sizeof(Address.sun_path) - 1);
+  ASSERT_EQ(bind(Listener, reinterpret_cast<sockaddr *>(&Address),
+                 sizeof(Address)),
+            0);
+  ASSERT_EQ(listen(Listener, 1), 0);
+  ProgressStream Stream("unix:" + Path);
+  int Connection = accept(Listener, nullptr, nullptr);
+  EXPECT_TRUE(Stream.writeLine("snapshot"));
+  char Buffer[16] = {};
+  EXPECT_EQ(read(Connection, Buffer, sizeof(Buffer) - 1), 9);
+  EXPECT_EQ(std::string(Buffer), "snapshot\n");
+  // a reader that went away closes the stream
+  close(Connection);
+  while (Stream.writeLine("snapshot")) {
+  }
+  EXPECT_FALSE(Stream.isOpen());
+  close(Listener);
+  unlink(Path.c_str());
+  EXPECT_THROW(ProgressStream("unix:" + Path), std::ios_base::failure);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
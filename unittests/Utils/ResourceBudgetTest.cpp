@@ -0,0 +1,59 @@
+#include <chrono>
+#include <gtest/gtest.h>
+#include <phasar/Utils/ResourceBudget.h>
+#include <thread>
+
+using namespace psr;
+
+TEST(ResourceBudgetTest, HandleUnbounded) {
+  ResourceBudget Budget;
+  Budget.start();
+  EXPECT_FALSE(Budget.isBounded());
+  for (unsigned I = 0; I < 10000; ++I) {
+    EXPECT_FALSE(Budget.exceeded(I));
+  }
+  EXPECT_EQ(Budget.getExceeded(), BudgetKind::None);
+}
+
+TEST(ResourceBudgetTest, HandlePathEdgeBudget) {
+  ResourceBudget Budget(std::chrono::milliseconds(0), 100);
+  Budget.start();
+  EXPECT_FALSE(Budget.exceeded(100));
+  EXPECT_TRUE(Budget.exceeded(101));
+  // stays exceeded
+  EXPECT_TRUE(Budget.exceeded(0));
+  EXPECT_EQ(Budget.getExceeded(), BudgetKind::PathEdges);
+  Budget.start();
+  EXPECT_EQ(Budget.getExceeded(), BudgetKind::None);
+}
+
+TEST(ResourceBudgetTest, HandleTimeBudget) {
+  ResourceBudget Budget(std::chrono::milliseconds(1));
+  Budget.start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  // the clock is only sampled every once in a while
+  bool Exceeded = false;
+  for (unsigned I = 0; I < 10000 && !Exceeded; ++I) {
+    Exceeded = Budget.exceeded(0);
+  }
+  EXPECT_TRUE(Exceeded);
+  EXPECT_EQ(Budget.getExceeded(), BudgetKind::Time);
+}
+
+TEST(ResourceBudgetTest, HandleMemoryBudget) {
+  EXPECT_GT(getResidentSetSize(), 0u);
+  ResourceBudget Budget(std::chrono::milliseconds(0), 0, 1);
+  Budget.start();
+  bool Exceeded = false;
+  for (unsigned I = 0; I < 10000 && !Exceeded; ++I) {
+    Exceeded = Budget.exceeded(0);
+  }
+  EXPECT_TRUE(Exceeded);
+  EXPECT_EQ(Budget.getExceeded(), BudgetKind::Memory);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,87 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <phasar/Utils/WorkStealingScheduler.h>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace psr;
+
+TEST(WorkStealingSchedulerTest, HandleTasksPushedDuringRun) {
+  for (unsigned NumWorkers : {1u, 2u, 8u}) {
+    WorkStealingScheduler<std::pair<unsigned, unsigned>> Scheduler(NumWorkers);
+    std::atomic<unsigned> HandledTasks(0);
+    // spans a binary tree of depth 12
+    Scheduler.push({0, 0});
+    Scheduler.run([&](std::pair<unsigned, unsigned> Task) {
+      ++HandledTasks;
+      if (Task.first < 12) {
+        Scheduler.push({Task.first + 1, 0});
+        Scheduler.push({Task.first + 1, 1});
+      }
+    });
+    EXPECT_EQ(HandledTasks, (1u << 13) - 1);
+    EXPECT_TRUE(Scheduler.empty());
+  }
+}
+
+TEST(WorkStealingSchedulerTest, HandleException) {
+  WorkStealingScheduler<unsigned> Scheduler(4);
+  Scheduler.push(0);
+  auto Handler = [&](unsigned Task) {
+    if (Task == 100) {
+      throw std::runtime_error("test");
+    }
+    Scheduler.push(Task + 1);
+  };
+  EXPECT_THROW(Scheduler.run(Handler), std::runtime_error);
+  EXPECT_TRUE(Scheduler.empty());
+}
+
+TEST(WorkStealingSchedulerTest, HandleAbort) {
+  WorkStealingScheduler<unsigned> Scheduler(4);
+  std::atomic<unsigned> HandledTasks(0);
+  Scheduler.push(0);
+  // would never terminate without the abort
+  Scheduler.run([&](unsigned Task) {
+    if (++HandledTasks == 100) {
+      Scheduler.abort();
+    }
+    Scheduler.push(Task + 1);
+    Scheduler.push(Task + 1);
+  });
+  EXPECT_GE(HandledTasks, 100u);
+  EXPECT_TRUE(Scheduler.empty());
+}
+
+TEST(WorkStealingSchedulerTest, HandleCurrentWorker) {
+  WorkStealingScheduler<unsigned> Scheduler(4);
+  EXPECT_EQ(Scheduler.getCurrentWorker(), 0u);
+  // every worker counts the tasks it handled in its own slot
+  std::vector<std::unique_ptr<std::atomic<unsigned>>> Handled;
+  for (unsigned Worker = 0; Worker < Scheduler.getNumWorkers(); ++Worker) {
+    Handled.push_back(std::make_unique<std::atomic<unsigned>>(0));
+  }
+  Scheduler.push(0);
+  Scheduler.run([&](unsigned Task) {
+    unsigned Worker = Scheduler.getCurrentWorker();
+    ASSERT_LT(Worker, Scheduler.getNumWorkers());
+    ++*Handled[Worker];
+    if (Task < 1000) {
+      Scheduler.push(Task + 1);
+    }
+  });
+  unsigned Total = 0;
+  for (auto &Count : Handled) {
+    Total += *Count;
+  }
+  EXPECT_EQ(Total, 1001u);
+  EXPECT_EQ(Scheduler.getCurrentWorker(), 0u);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}